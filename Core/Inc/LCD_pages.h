@@ -13,6 +13,9 @@
 #include "state.h"
 
 extern ILI9341_HandleTypeDef ili9341;
+void initPages(void);
 void renderPage(uint8_t state);
+// Switch through all the pages rounds times, with or without the page cache, and return the average switch time in us
+uint32_t measurePageSwitch(bool cached, uint32_t rounds);
 
 #endif /* INC_LCD_PAGES_H_ */
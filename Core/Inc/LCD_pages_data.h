@@ -0,0 +1,21 @@
+/*
+ * Generated by Tools/page_compile.py from LCD_pages.json, do not edit.
+ */
+
+#ifndef INC_LCD_PAGES_DATA_H_
+#define INC_LCD_PAGES_DATA_H_
+
+#include "ili9341_page.h"
+
+#define LCD_FIELD_IDLE_COINS_LEFT 0
+extern const ILI9341_Page LCD_Page_Idle;
+
+#define LCD_FIELD_WAIT_COIN_COINS_LEFT 0
+extern const ILI9341_Page LCD_Page_WaitCoin;
+
+#define LCD_FIELD_GAME_TIME_LEFT 0
+extern const ILI9341_Page LCD_Page_Game;
+
+extern const ILI9341_Page LCD_Page_Deposit;
+
+#endif /* INC_LCD_PAGES_DATA_H_ */
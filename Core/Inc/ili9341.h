@@ -46,6 +46,221 @@
 #define ILI9341_DRAW_IMAGE_BUFFER_SIZE 512  // pixels x 2 bytes per pixel = 1024 bytes
 #define ILI9341_DRAW_GLYPH_BUFFER_SIZE 512  // pixels x 2 bytes per pixel = 1024 bytes
 #define FALLBACK_CODEPOINT 0x7F
+#define ILI9341_LAYOUT_MAX_LINES 8          // max lines of a word-wrapped layout
+#define ILI9341_LAYOUT_MAX_LINE_LENGTH 64   // max characters drawn per layout line
+#define ILI9341_LAYOUT_CACHE_SIZE 8         // number of memoized layouts
+#define ILI9341_CLIP_STACK_DEPTH 8          // max nested clip rectangles
+#define ILI9341_PATH_MAX_POINTS 256         // max points of a flattened path, 2 x 2 bytes per point on the stack
+#define ILI9341_PATH_MAX_CONTOURS 16        // max contours of a path
+
+// Text alignment for ILI9341_WriteStringLayout
+#define ILI9341_ALIGN_LEFT 0
+#define ILI9341_ALIGN_CENTER 1
+#define ILI9341_ALIGN_RIGHT 2
+
+// Filters of scaled images
+#define ILI9341_FILTER_NEAREST 0
+#define ILI9341_FILTER_BILINEAR 1
+
+// Paint types of the fill primitives
+#define ILI9341_PAINT_LINEAR 0   // gradient along a line, the colors are extended before the start and after the end
+#define ILI9341_PAINT_RADIAL 1   // gradient out from a center, the end color is extended beyond the radius
+#define ILI9341_PAINT_PATTERN 2  // image repeated in both directions
+
+// Fill rules of paths
+#define ILI9341_FILL_EVEN_ODD 0  // inside where a ray to the left crosses an odd number of edges
+#define ILI9341_FILL_NON_ZERO 1  // inside where the edges crossed going down and going up do not cancel out
+
+// Path bytecode ops, followed by their coordinates as int16 MSB first
+#define ILI9341_PATH_END 0    // end of the path
+#define ILI9341_PATH_MOVE 1   // x, y: start a new contour at the point
+#define ILI9341_PATH_LINE 2   // x, y: straight edge to the point
+#define ILI9341_PATH_QUAD 3   // cx, cy, x, y: quadratic curve to the point, pulled toward the control point
+#define ILI9341_PATH_CLOSE 4  // close the contour, the next edge starts from its first point
+
+// Display list op types
+#define ILI9341_OP_PIXEL 0
+#define ILI9341_OP_FILL_RECTANGLE 1
+#define ILI9341_OP_STRING 2
+#define ILI9341_OP_STRING_TRANSPARENT 3
+#define ILI9341_OP_IMAGE 4
+#define ILI9341_OP_LINE 5
+#define ILI9341_OP_RECTANGLE 6
+#define ILI9341_OP_CIRCLE 7
+#define ILI9341_OP_CIRCLE_THICK 8
+#define ILI9341_OP_FILL_CIRCLE 9
+#define ILI9341_OP_ELLIPSE 10
+#define ILI9341_OP_ELLIPSE_THICK 11
+#define ILI9341_OP_FILL_ELLIPSE 12
+#define ILI9341_OP_POLYGON 13
+#define ILI9341_OP_FILL_POLYGON 14
+#define ILI9341_OP_IMAGE_TRANSPARENT 15
+#define ILI9341_OP_GLYPH 16
+#define ILI9341_OP_IMAGE_COMPRESSED 17
+#define ILI9341_OP_IMAGE_SCALED 18
+#define ILI9341_OP_FILL_PATH 19
+
+/**
+ * @brief Image compressed with ILI9341_CompressImage or Tools/image_encode.py
+ * @note The data is a stream of ops on RGB565 colors, each op gives the next pixels left to right then top to bottom:
+ * 00iiiiii the color at index i of a table of 64 colors last seen, put at (r * 3 + g * 5 + b * 7) % 64;
+ * 01rrggbb the previous color plus r - 2, g - 2 and b - 2;
+ * 10gggggg rrrrbbbb the previous color plus g - 32 to green, floor((g - 32) / 2) + r - 8 to red and floor((g - 32) / 2)
+ * + b - 8 to blue;
+ * 11nnnnnn (n < 62) the previous color repeated n + 1 times;
+ * 0xFE then the color in 2 bytes, MSB first;
+ * 0xFF then n in 2 bytes, MSB first, the previous color repeated n + 1 times.
+ * Channels wrap around, the previous color and the table start black. Nothing is read past size, data that ends
+ * early is finished with the last color.
+ */
+typedef struct {
+    uint16_t width;
+    uint16_t height;
+    /** Size of data in bytes */
+    uint32_t size;
+    const uint8_t* data;
+} ILI9341_CompressedImage;
+
+/**
+ * @brief Vector shape such as an icon, made with Tools/path_encode.py
+ * @note The data is a sequence of ILI9341_PATH_* ops in design units, contours are closed when they are filled. Points
+ * and control points are in the box from (0, 0) to (width, height), which is scaled to the size the path is drawn at.
+ * Clipping, display list diffing and bands take the box as the bounds of the path.
+ */
+typedef struct {
+    uint16_t width;
+    uint16_t height;
+    /** Size of data in bytes */
+    uint32_t size;
+    const uint8_t* data;
+} ILI9341_Path;
+
+/**
+ * @brief Rectangle in drawing coordinates, corners inclusive
+ */
+typedef struct {
+    int16_t x0;
+    int16_t y0;
+    int16_t x1;
+    int16_t y1;
+} ILI9341_Rect;
+
+/**
+ * @brief RAM surface that the drawing primitives write to instead of the panel
+ */
+typedef struct {
+    /** Pixels, row-major with width pixels per row, rows of indexed surfaces start on a byte */
+    void* buffer;
+    /** Bits per pixel, 0 for RGB565 with the 2 bytes swapped, 1, 2, 4 or 8 for palette indices packed MSB first */
+    uint_fast8_t bpp;
+    /** Palette of indexed surfaces in RGB565 format with the 2 bytes swapped, colors not in it use the nearest entry */
+    const uint16_t* palette;
+    uint_fast16_t paletteSize;
+    /** Drawing coordinates of the top-left pixel of the buffer */
+    int_fast16_t x;
+    int_fast16_t y;
+    int_fast16_t width;
+    int_fast16_t height;
+    /** Address window and write position of the primitive being drawn, in drawing coordinates */
+    int_fast16_t windowX0;
+    int_fast16_t windowX1;
+    int_fast16_t cursorX;
+    int_fast16_t cursorY;
+} ILI9341_Surface;
+
+/**
+ * @brief One recorded primitive call, followed by its string, polygon points, image mask pointer or path paint pointer
+ */
+typedef struct {
+    uint8_t type;
+    /** Wrap flag of strings, filter of scaled images, fill rule of paths */
+    uint8_t flags;
+    /** Size of the op including the trailing data, multiple of 4 bytes */
+    uint16_t size;
+    /** Drawing coordinates of the pixels the op can touch, inclusive */
+    int16_t x0;
+    int16_t y0;
+    int16_t x1;
+    int16_t y1;
+    /** Arguments of the primitive in declaration order, after the coordinates come sizes, radii, thickness, or the
+     * scale, tracking and leading of strings */
+    int16_t args[6];
+    uint16_t color;
+    uint16_t bgColor;
+    /** Image pixels, font glyphs, glyph, compressed image, path or paint of fills */
+    const void* data;
+    /** Font metrics of strings */
+    uint8_t fontStartCodepoint;
+    uint8_t fontEndCodepoint;
+    int16_t fontAverageWidth;
+    int8_t fontAscent;
+    int8_t fontDescent;
+} ILI9341_DisplayOp;
+
+/**
+ * @brief Arena of recorded primitive calls
+ */
+typedef struct {
+    uint8_t* buffer;
+    size_t capacity;
+    size_t used;
+    size_t count;
+    /** Set when an op did not fit, the list is incomplete */
+    bool overflow;
+} ILI9341_DisplayList;
+
+/**
+ * @brief Stack of clip rectangles, zero-initialize before use
+ */
+typedef struct {
+    /** Clip rectangle after each push, already intersected with the ones below */
+    ILI9341_Rect rects[ILI9341_CLIP_STACK_DEPTH];
+    uint_fast8_t depth;
+    /** Set while the address window of the primitive being drawn is partly clipped */
+    bool filtering;
+    /** Address window requested by the primitive being drawn, and its write position */
+    int_fast16_t windowX0;
+    int_fast16_t windowX1;
+    int_fast16_t cursorX;
+    int_fast16_t cursorY;
+    /** Part of the address window inside the clip rectangle, the pixels outside are dropped */
+    ILI9341_Rect visible;
+} ILI9341_ClipStack;
+
+/**
+ * @brief Gradient or pattern that the fill primitives use instead of their color, see ILI9341_LinearGradient,
+ * ILI9341_RadialGradient and ILI9341_Pattern
+ * @note The paint is anchored to drawing coordinates, shapes filled with one paint show parts of the same gradient.
+ */
+typedef struct {
+    /** One of ILI9341_PAINT_* values */
+    uint_fast8_t type;
+    /** Ordered dithering of gradients, hides the bands between the shades of RGB565 */
+    bool dither;
+    /** Start of linear gradients, center of radial gradients, top-left pixel of a pattern tile */
+    int_fast16_t x;
+    int_fast16_t y;
+    /** From the start to the end of linear gradients */
+    int_fast32_t dx;
+    int_fast32_t dy;
+    /** dx * dx + dy * dy of linear gradients */
+    int_fast64_t length2;
+    /** Radius of radial gradients, and 2^27 / radius */
+    int_fast32_t radius;
+    uint_fast32_t scale;
+    /** Start and end colors in RGB565 format with the 2 bytes swapped */
+    uint16_t color0;
+    uint16_t color1;
+    /** Red, green and blue of the start color, and their change to the end color */
+    int_fast32_t levels[3];
+    int_fast32_t deltas[3];
+    /** Change of red, green and blue per pixel to the right along linear gradients, in 2^-24 of a shade */
+    int_fast32_t steps[3];
+    /** Pixels of a pattern tile in RGB565 format with the 2 bytes swapped, width * height elements */
+    const uint16_t* pixels;
+    int_fast16_t width;
+    int_fast16_t height;
+} ILI9341_Paint;
 
 /**
  * @brief ILI9341 handle structure
@@ -61,8 +276,52 @@ typedef struct {
     int_fast8_t rotation;
     int_fast16_t width;
     int_fast16_t height;
+    int_fast16_t scrollStart;
+    int_fast16_t scrollLength;
+    int_fast16_t scrollOffset;
+    /** Surface drawn to instead of the panel, NULL for the panel */
+    ILI9341_Surface* surface;
+    /** Display list recording the drawing primitives instead of running them, NULL to draw */
+    ILI9341_DisplayList* displayList;
+    /** Clip rectangles all primitives are confined to, NULL to only clip to the display */
+    ILI9341_ClipStack* clip;
+    /** Paint of ILI9341_FillRectangle, ILI9341_FillScreen, ILI9341_FillCircle, ILI9341_FillEllipse,
+     * ILI9341_FillPolygon and ILI9341_FillPath instead of their color, NULL for a solid color */
+    const ILI9341_Paint* paint;
 } ILI9341_HandleTypeDef;
 
+/**
+ * @brief Text bounding box, relative to the string origin (left of the first character, baseline of the first line)
+ */
+typedef struct {
+    /** X offset of the leftmost drawn pixel */
+    int_fast16_t x;
+    /** Y offset of the top of the first line (font ascent) */
+    int_fast16_t y;
+    /** Width from the leftmost to the rightmost drawn pixel */
+    int_fast16_t width;
+    /** Height from the ascent of the first line to the descent of the last line */
+    int_fast16_t height;
+    /** Horizontal advance of the widest line, without trailing tracking */
+    int_fast16_t advance;
+} ILI9341_TextBounds;
+
+/**
+ * @brief Word-wrapped text layout
+ */
+typedef struct {
+    /** Bounding box of all lines */
+    ILI9341_TextBounds bounds;
+    /** Number of lines */
+    uint_fast8_t lineCount;
+    /** Index of the first character of each line in the string */
+    uint16_t lineStart[ILI9341_LAYOUT_MAX_LINES];
+    /** Number of characters of each line, without the line break and trailing spaces */
+    uint16_t lineLength[ILI9341_LAYOUT_MAX_LINES];
+    /** Bounding box of each line, relative to the line origin */
+    ILI9341_TextBounds lineBounds[ILI9341_LAYOUT_MAX_LINES];
+} ILI9341_TextLayout;
+
 /**
  * @brief Deselect the ILI9341 display, call before using other SPI peripherals on the same bus
  * @param ili9341 Pointer to ILI9341 handle structure
@@ -118,6 +377,133 @@ void ILI9341_SetBrightness(const ILI9341_HandleTypeDef* ili9341, uint_fast8_t br
  */
 void ILI9341_InvertColors(const ILI9341_HandleTypeDef* ili9341, bool invert);
 
+/**
+ * @brief Define the hardware scroll area
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @param start First screen position of the scroll area along the scroll axis
+ * @param length Size of the scroll area in pixels along the scroll axis, the rest of the axis stays fixed
+ * @note The panel scrolls along its 320 pixel scan axis, which is Y for ILI9341_ROTATION_VERTICAL_* and X for
+ * ILI9341_ROTATION_HORIZONTAL_*, over the full size of the other axis. The scroll offset is reset to 0.
+ */
+void ILI9341_SetScrollArea(ILI9341_HandleTypeDef* ili9341, int_fast16_t start, int_fast16_t length);
+
+/**
+ * @brief Scroll the content of the scroll area without redrawing it
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @param offset Scroll offset in pixels, the content moves towards the start of the scroll area (up or left)
+ * @note Drawing coordinates are not scrolled, use ILI9341_GetScrollPosition to find where to draw so the pixels
+ * appear at a given screen position.
+ */
+void ILI9341_SetScrollOffset(ILI9341_HandleTypeDef* ili9341, int_fast16_t offset);
+
+/**
+ * @brief Map a screen position along the scroll axis to the drawing coordinate currently shown there
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @param position Screen position along the scroll axis
+ * @return Coordinate to draw at so that the pixels appear at the screen position
+ */
+int_fast16_t ILI9341_GetScrollPosition(const ILI9341_HandleTypeDef* ili9341, int_fast16_t position);
+
+/**
+ * @brief Disable hardware scrolling and return to normal display mode
+ * @param ili9341 Pointer to ILI9341 handle structure
+ */
+void ILI9341_ResetScroll(ILI9341_HandleTypeDef* ili9341);
+
+/**
+ * @brief Define the area shown in partial mode, the rest of the display is black
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @param start First screen position of the area along the scroll axis
+ * @param end Last screen position (inclusive) of the area along the scroll axis
+ * @note Like scrolling, the area is a band along the panel's 320 pixel scan axis (Y in vertical rotations, X in
+ * horizontal rotations).
+ */
+void ILI9341_SetPartialArea(const ILI9341_HandleTypeDef* ili9341, int_fast16_t start, int_fast16_t end);
+
+/**
+ * @brief Enable or disable partial mode
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @param partial true to show only the partial area, false for normal mode
+ * @note Hardware scrolling is restored afterwards since the panel leaves scroll mode on both commands.
+ */
+void ILI9341_SetPartialMode(ILI9341_HandleTypeDef* ili9341, bool partial);
+
+/**
+ * @brief Enable or disable idle mode (8 colors, each channel reduced to its MSB)
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @param idle true to enable idle mode, false to disable
+ */
+void ILI9341_SetIdleMode(const ILI9341_HandleTypeDef* ili9341, bool idle);
+
+/**
+ * @brief Turn the display output on or off without touching the frame memory
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @param on true to show the frame memory, false to blank the display
+ */
+void ILI9341_SetDisplayOn(const ILI9341_HandleTypeDef* ili9341, bool on);
+
+/**
+ * @brief Confine drawing to a rectangle, inside the current clip rectangle
+ * @param ili9341 Pointer to ILI9341 handle structure, with a clip stack
+ * @param x X coordinate of the top-left corner of the rectangle
+ * @param y Y coordinate of the top-left corner of the rectangle
+ * @param w Width of the rectangle
+ * @param h Height of the rectangle
+ * @return false if the handle has no clip stack or the stack is full, nothing is pushed
+ * @note Primitives entirely outside the clip rectangle return before any drawing, primitives partly inside only send
+ * their pixels inside it. Recording to a display list is not clipped.
+ */
+bool ILI9341_PushClip(
+    const ILI9341_HandleTypeDef* ili9341,
+    int_fast16_t x,
+    int_fast16_t y,
+    int_fast16_t w,
+    int_fast16_t h
+);
+
+/**
+ * @brief Restore the clip rectangle before the last ILI9341_PushClip
+ * @param ili9341 Pointer to ILI9341 handle structure, with a clip stack
+ */
+void ILI9341_PopClip(const ILI9341_HandleTypeDef* ili9341);
+
+/**
+ * @brief Start sending a block of pixels to the panel, with DMA if the SPI handle has a TX DMA channel
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @param x0 X coordinate of the top-left corner of the block
+ * @param y0 Y coordinate of the top-left corner of the block
+ * @param x1 X coordinate of the bottom-right corner of the block
+ * @param y1 Y coordinate of the bottom-right corner of the block
+ * @param data Pixels in RGB565 format with the 2 bytes swapped, must stay unchanged until the transfer is done
+ * @note Call ILI9341_WaitTransfer before any other access to the panel. Without DMA or for more than 32K pixels the
+ * transfer is blocking.
+ */
+void ILI9341_StartTransfer(
+    const ILI9341_HandleTypeDef* ili9341,
+    int_fast16_t x0,
+    int_fast16_t y0,
+    int_fast16_t x1,
+    int_fast16_t y1,
+    const uint16_t* data
+);
+
+/**
+ * @brief Wait for the transfer started by ILI9341_StartTransfer and deselect the display
+ * @param ili9341 Pointer to ILI9341 handle structure
+ */
+void ILI9341_WaitTransfer(const ILI9341_HandleTypeDef* ili9341);
+
+/**
+ * @brief Get the blend palette used for anti-aliased glyphs
+ * @param color 16-bit foreground color in RGB565 format
+ * @param bgColor 16-bit background color in RGB565 format
+ * @param bpp Bits per pixel of the coverage, 2 or 4
+ * @return Palette with (1 << bpp) entries in RGB565 format with the 2 bytes swapped, index 0 is the background color
+ * and the last index is the foreground color
+ * @note The palette is shared and only valid until the next call with different arguments.
+ */
+const uint16_t* ILI9341_GetBlendPalette(uint16_t color, uint16_t bgColor, uint_fast8_t bpp);
+
 /**
  * @brief Draw a single pixel at specified coordinates
  * @param ili9341 Pointer to ILI9341 handle structure
@@ -152,6 +538,80 @@ void ILI9341_FillRectangle(
  */
 void ILI9341_FillScreen(const ILI9341_HandleTypeDef* ili9341, uint16_t color);
 
+/**
+ * @brief Make a linear gradient paint
+ * @param x0 X coordinate of the start of the gradient
+ * @param y0 Y coordinate of the start of the gradient
+ * @param x1 X coordinate of the end of the gradient
+ * @param y1 Y coordinate of the end of the gradient
+ * @param color0 16-bit color at the start in RGB565 format
+ * @param color1 16-bit color at the end in RGB565 format
+ * @param dither true to dither the shades between the colors
+ * @return The paint, set it as the paint of the handle to fill with it
+ * @note The colors step by a fixed amount per pixel along each span, the lines across the gradient have one color.
+ */
+ILI9341_Paint ILI9341_LinearGradient(
+    int_fast16_t x0,
+    int_fast16_t y0,
+    int_fast16_t x1,
+    int_fast16_t y1,
+    uint16_t color0,
+    uint16_t color1,
+    bool dither
+);
+
+/**
+ * @brief Make a radial gradient paint
+ * @param xc X coordinate of the center, where the gradient starts
+ * @param yc Y coordinate of the center
+ * @param r Radius where the gradient ends, 1 to 4095
+ * @param color0 16-bit color at the center in RGB565 format
+ * @param color1 16-bit color at the radius and beyond in RGB565 format
+ * @param dither true to dither the shades between the colors
+ * @return The paint, set it as the paint of the handle to fill with it
+ * @note The distance to the center is tracked in 1/16 of a pixel from one pixel of a span to the next, without square
+ * roots.
+ */
+ILI9341_Paint ILI9341_RadialGradient(
+    int_fast16_t xc,
+    int_fast16_t yc,
+    int_fast16_t r,
+    uint16_t color0,
+    uint16_t color1,
+    bool dither
+);
+
+/**
+ * @brief Make a pattern paint, an image tiled over the fills
+ * @param x X coordinate of the top-left pixel of one tile
+ * @param y Y coordinate of the top-left pixel of one tile
+ * @param w Width of the tile in pixels
+ * @param h Height of the tile in pixels
+ * @param pixels Pixels of the tile in RGB565 format with the 2 bytes swapped, w*h elements, referenced by the paint
+ * @return The paint, set it as the paint of the handle to fill with it
+ */
+ILI9341_Paint ILI9341_Pattern(int_fast16_t x, int_fast16_t y, int_fast16_t w, int_fast16_t h, const uint16_t* pixels);
+
+/**
+ * @brief Draw one glyph, for text laid out ahead of time
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @param x X coordinate of the left of the character
+ * @param y Y coordinate of the baseline of the character
+ * @param glyph Glyph to draw, from the glyph table of a font
+ * @param color 16-bit character color in RGB565 format
+ * @param bgColor 16-bit background color in RGB565 format
+ * @param scale Integer scaling factor for the glyph, must be >= 1
+ */
+void ILI9341_DrawGlyph(
+    const ILI9341_HandleTypeDef* ili9341,
+    int_fast16_t x,
+    int_fast16_t y,
+    const ILI9341_GlyphDef* glyph,
+    uint16_t color,
+    uint16_t bgColor,
+    int_fast16_t scale
+);
+
 /**
  * @brief Write a string to the display with specified font and colors
  * @param ili9341 Pointer to ILI9341 handle structure
@@ -167,6 +627,7 @@ void ILI9341_FillScreen(const ILI9341_HandleTypeDef* ili9341, uint16_t color);
  *                 with ILI9341_WriteStringTransparent to avoid background overlap)
  * @param leading Additional space in pixels between lines when wrapping, can be negative (negative leading should only
  *                be used with ILI9341_WriteStringTransparent to avoid background overlap)
+ * @note Anti-aliased (2bpp/4bpp) glyphs are blended between color and bgcolor through a precomputed palette.
  */
 void ILI9341_WriteString(
     const ILI9341_HandleTypeDef* ili9341,
@@ -194,6 +655,7 @@ void ILI9341_WriteString(
  * @param scale Integer scaling factor for the font, must be >= 1
  * @param tracking Additional space in pixels between characters, can be negative
  * @param leading Additional space in pixels between lines when wrapping, can be negative
+ * @note Anti-aliased (2bpp/4bpp) glyphs have no background to blend with, their coverage is thresholded at half.
  */
 void ILI9341_WriteStringTransparent(
     const ILI9341_HandleTypeDef* ili9341,
@@ -208,6 +670,76 @@ void ILI9341_WriteStringTransparent(
     int_fast16_t leading
 );
 
+/**
+ * @brief Measure the bounding box of a string as drawn by ILI9341_WriteString without wrapping
+ * @param str Null-terminated string to measure, may contain '\n'
+ * @param font Font definition used for rendering the string
+ * @param scale Integer scaling factor for the font, must be >= 1
+ * @param tracking Additional space in pixels between characters
+ * @param leading Additional space in pixels between lines
+ * @return Bounding box relative to the string origin
+ * @note Results are memoized, see ILI9341_LayoutString.
+ */
+ILI9341_TextBounds ILI9341_MeasureString(
+    const char* str,
+    ILI9341_FontDef font,
+    int_fast16_t scale,
+    int_fast16_t tracking,
+    int_fast16_t leading
+);
+
+/**
+ * @brief Break a string into lines at spaces so that every line fits in the specified width
+ * @param str Null-terminated string to lay out, '\n' forces a line break
+ * @param font Font definition used for rendering the string
+ * @param scale Integer scaling factor for the font, must be >= 1
+ * @param tracking Additional space in pixels between characters
+ * @param leading Additional space in pixels between lines
+ * @param maxWidth Max line width in pixels, 0 to only break at '\n'
+ * @return Line breaks and bounding boxes, at most ILI9341_LAYOUT_MAX_LINES lines
+ * @note Words longer than maxWidth are broken between characters. Results are memoized per (string pointer, string
+ * hash, font, scale, tracking, leading, maxWidth) in a ILI9341_LAYOUT_CACHE_SIZE entry cache, so laying out the
+ * same text again only costs hashing the string.
+ */
+ILI9341_TextLayout ILI9341_LayoutString(
+    const char* str,
+    ILI9341_FontDef font,
+    int_fast16_t scale,
+    int_fast16_t tracking,
+    int_fast16_t leading,
+    int_fast16_t maxWidth
+);
+
+/**
+ * @brief Write a string using a layout from ILI9341_LayoutString
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @param x X coordinate of the left of the layout block
+ * @param y Y coordinate of the baseline of the first line
+ * @param str Null-terminated string the layout was computed for
+ * @param layout Pointer to the layout of str
+ * @param font Font definition used for the layout
+ * @param color 16-bit text color in RGB565 format
+ * @param bgcolor 16-bit background color in RGB565 format
+ * @param scale Integer scaling factor used for the layout
+ * @param tracking Tracking used for the layout
+ * @param leading Leading used for the layout
+ * @param align Alignment of each line inside the block, one of ILI9341_ALIGN_* values
+ */
+void ILI9341_WriteStringLayout(
+    const ILI9341_HandleTypeDef* ili9341,
+    int_fast16_t x,
+    int_fast16_t y,
+    const char* str,
+    const ILI9341_TextLayout* layout,
+    ILI9341_FontDef font,
+    uint16_t color,
+    uint16_t bgcolor,
+    int_fast16_t scale,
+    int_fast16_t tracking,
+    int_fast16_t leading,
+    uint_fast8_t align
+);
+
 /**
  * @brief Draw an image (bitmap) at specified coordinates
  * @param ili9341 Pointer to ILI9341 handle structure
@@ -227,6 +759,93 @@ void ILI9341_DrawImage(
     const uint16_t* data
 );
 
+/**
+ * @brief Draw an image (bitmap) at specified coordinates, skipping its transparent pixels
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @param x X coordinate of the top-left corner of the image
+ * @param y Y coordinate of the top-left corner of the image
+ * @param w Width of the image in pixels
+ * @param h Height of the image in pixels
+ * @param data Pointer to the image pixel data in RGB565 format with the 2 bytes swapped, must contain at least w*h
+ * elements
+ * @param mask 1bpp opacity mask, rows of (w + 7) / 8 bytes, MSB first, 1 is opaque, NULL to use colorKey
+ * @param colorKey 16-bit color in RGB565 format of the transparent pixels, used when mask is NULL
+ */
+void ILI9341_DrawImageTransparent(
+    const ILI9341_HandleTypeDef* ili9341,
+    int_fast16_t x,
+    int_fast16_t y,
+    int_fast16_t w,
+    int_fast16_t h,
+    const uint16_t* data,
+    const uint8_t* mask,
+    uint16_t colorKey
+);
+
+/**
+ * @brief Draw a compressed image at specified coordinates, decoded while it is sent
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @param x X coordinate of the top-left corner of the image
+ * @param y Y coordinate of the top-left corner of the image
+ * @param image Pointer to the compressed image
+ * @note Only the visible part is sent, with DMA while the next pixels are decoded when the handle has a TX DMA
+ * channel. The rows below the visible part are not decoded.
+ */
+void ILI9341_DrawImageCompressed(
+    const ILI9341_HandleTypeDef* ili9341,
+    int_fast16_t x,
+    int_fast16_t y,
+    const ILI9341_CompressedImage* image
+);
+
+/**
+ * @brief Draw an image stretched or shrunk to a size, scaled while it is sent
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @param x X coordinate of the top-left corner of the scaled image
+ * @param y Y coordinate of the top-left corner of the scaled image
+ * @param w Width of the scaled image in pixels, negative extends to the left like ILI9341_DrawImage
+ * @param h Height of the scaled image in pixels, negative extends up like ILI9341_DrawImage
+ * @param data Pointer to the image pixel data in RGB565 format with the 2 bytes swapped, must contain at least
+ * srcW*srcH elements
+ * @param srcW Width of the image in pixels
+ * @param srcH Height of the image in pixels
+ * @param filter ILI9341_FILTER_NEAREST or ILI9341_FILTER_BILINEAR
+ * @note The source is stepped in 16.16 fixed point from the centers of the scaled pixels. Bilinear filtering blends
+ * the 4 nearest pixels, so shrinking below half the size skips pixels like nearest-neighbor. Each row is built in a
+ * line buffer and sent with DMA while the next row is built when the handle has a TX DMA channel, a row that samples
+ * the same source rows as the previous one is sent again without being rebuilt.
+ */
+void ILI9341_DrawImageScaled(
+    const ILI9341_HandleTypeDef* ili9341,
+    int_fast16_t x,
+    int_fast16_t y,
+    int_fast16_t w,
+    int_fast16_t h,
+    const uint16_t* data,
+    int_fast16_t srcW,
+    int_fast16_t srcH,
+    uint_fast8_t filter
+);
+
+/**
+ * @brief Compress an image, for images rendered at runtime, images in flash are compressed by Tools/image_encode.py
+ * @param image Pointer to the compressed image to set
+ * @param data Pointer to the image pixel data in RGB565 format with the 2 bytes swapped, w*h elements
+ * @param w Width of the image in pixels
+ * @param h Height of the image in pixels
+ * @param buffer Memory the compressed data is written to
+ * @param capacity Size of the buffer in bytes
+ * @return false if the compressed data does not fit in the buffer, the image is then not set
+ */
+bool ILI9341_CompressImage(
+    ILI9341_CompressedImage* image,
+    const uint16_t* data,
+    int_fast16_t w,
+    int_fast16_t h,
+    uint8_t* buffer,
+    size_t capacity
+);
+
 /**
  * @brief Draw a thin line between two points
  * @param ili9341 Pointer to ILI9341 handle structure
@@ -455,4 +1074,27 @@ void ILI9341_DrawPolygonThick(
  */
 void ILI9341_FillPolygon(const ILI9341_HandleTypeDef* ili9341, int16_t* x, int16_t* y, size_t n, uint16_t color);
 
+/**
+ * @brief Fill a path, e.g. an icon, at any scale
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @param x X coordinate of the top-left corner of the path box
+ * @param y Y coordinate of the top-left corner of the path box
+ * @param path Path to fill
+ * @param scale Pixels per design unit in 1/256, 256 draws the path at its design size
+ * @param rule ILI9341_FILL_EVEN_ODD or ILI9341_FILL_NON_ZERO
+ * @param color 16-bit fill color in RGB565 format
+ * @note Curves are flattened into as many lines as their bend needs at this scale, within 1/4 pixel. The flattened
+ * path is filled like ILI9341_FillPolygon, up to ILI9341_PATH_MAX_POINTS points and ILI9341_PATH_MAX_CONTOURS
+ * contours, the rest of a larger path is dropped.
+ */
+void ILI9341_FillPath(
+    const ILI9341_HandleTypeDef* ili9341,
+    int_fast16_t x,
+    int_fast16_t y,
+    const ILI9341_Path* path,
+    uint_fast16_t scale,
+    uint_fast8_t rule,
+    uint16_t color
+);
+
 #endif  // __ILI9341_H__
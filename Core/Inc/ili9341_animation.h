@@ -0,0 +1,93 @@
+#ifndef __ILI9341_ANIMATION_H__
+#define __ILI9341_ANIMATION_H__
+
+#include "ili9341.h"
+#include "stdbool.h"
+#include "stdint.h"
+
+/**
+ * @brief Changed rectangle of a frame, relative to the top-left corner of the animation
+ */
+typedef struct {
+    uint16_t x;
+    uint16_t y;
+    uint16_t width;
+    uint16_t height;
+    /** Index of the first pixel of the rectangle in the pixels of the animation */
+    uint32_t offset;
+} ILI9341_AnimationRect;
+
+/**
+ * @brief Animation stored as a keyframe and the rectangles changed by each following frame, generated with
+ * Tools/anim_encode.py
+ * @note Frame 0 is the keyframe. The rectangles of frame i (rects[frames[i]] to rects[frames[i + 1] - 1]) turn frame
+ * i - 1 into frame i, the rectangles of frame 0 turn the last frame back into the keyframe when the animation loops.
+ * Pixels are in RGB565 format with the 2 bytes swapped, each rectangle row by row.
+ */
+typedef struct {
+    uint16_t width;
+    uint16_t height;
+    /** Duration of each frame in milliseconds */
+    uint16_t frameTime;
+    uint16_t frameCount;
+    const uint16_t* keyframe;
+    /** frameCount + 1 indexes in rects */
+    const uint16_t* frames;
+    const ILI9341_AnimationRect* rects;
+    const uint16_t* pixels;
+} ILI9341_Animation;
+
+/**
+ * @brief Playback of an animation at its fixed frame rate, each frame only sends its changed rectangles
+ */
+typedef struct {
+    const ILI9341_HandleTypeDef* ili9341;
+    const ILI9341_Animation* animation;
+    int_fast16_t x;
+    int_fast16_t y;
+    /** Frame on the display */
+    uint_fast16_t frame;
+    /** Plays left, 0 to loop until stopped */
+    uint_fast16_t repeat;
+    /** Time the frame on the display was due */
+    uint32_t frameTick;
+    bool running;
+} ILI9341_AnimationPlayer;
+
+/**
+ * @brief Start an animation, its keyframe is drawn at once
+ * @param player Pointer to the player
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @param animation Pointer to the animation
+ * @param x X coordinate of the top-left corner of the animation
+ * @param y Y coordinate of the top-left corner of the animation
+ * @param repeat Number of times the frames are played, 0 to loop until stopped
+ * @param tick Current time in milliseconds, usually HAL_GetTick()
+ */
+void ILI9341_Animation_Start(
+    ILI9341_AnimationPlayer* player,
+    const ILI9341_HandleTypeDef* ili9341,
+    const ILI9341_Animation* animation,
+    int_fast16_t x,
+    int_fast16_t y,
+    uint_fast16_t repeat,
+    uint32_t tick
+);
+
+/**
+ * @brief Stop the animation, its current frame stays on the display
+ * @param player Pointer to the player
+ */
+void ILI9341_Animation_Stop(ILI9341_AnimationPlayer* player);
+
+/**
+ * @brief Draw the frames due, call often from the main loop
+ * @param player Pointer to the player
+ * @param tick Current time in milliseconds, usually HAL_GetTick()
+ * @return true while the animation is running
+ * @note Each frame builds on the previous one, so frames missed by a late call are all drawn. When a whole loop or
+ * more was missed, the keyframe is drawn instead, the current play ends there and the next one starts.
+ */
+bool ILI9341_Animation_Update(ILI9341_AnimationPlayer* player, uint32_t tick);
+
+#endif  // __ILI9341_ANIMATION_H__
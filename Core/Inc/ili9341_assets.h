@@ -0,0 +1,140 @@
+#ifndef __ILI9341_ASSETS_H__
+#define __ILI9341_ASSETS_H__
+
+#include "ili9341.h"
+#include "ili9341_fonts.h"
+#include "stdbool.h"
+#include "stdint.h"
+
+// "ILIA" in the first 4 bytes of a bundle
+#define ILI9341_ASSETS_MAGIC 0x41494C49
+#define ILI9341_ASSETS_VERSION 1
+
+// Asset types
+#define ILI9341_ASSET_FONT 1              // ILI9341_AssetFont, then the glyph table, then the glyph bitmaps
+#define ILI9341_ASSET_IMAGE 2             // uint16_t width, height, then the pixels as ILI9341_DrawImage takes them
+#define ILI9341_ASSET_COMPRESSED_IMAGE 3  // uint16_t width, height, then the data of an ILI9341_CompressedImage
+#define ILI9341_ASSET_STRING 4            // NUL-terminated string
+
+/**
+ * @brief Header at the start of an asset bundle, assets linked into their own flash section, generated with
+ * Tools/asset_bundle.py and looked up by id
+ * @note A bundle is this header, an index of entries sorted by id and the payloads aligned to 4 bytes. Everything
+ * returned points into the bundle, nothing is copied, and the firmware only references the bundle itself, so the
+ * assets can be updated by flashing the section alone.
+ */
+typedef struct {
+    uint32_t magic;
+    uint8_t version;
+    /** Size of the pointers in the glyph tables of the fonts, sizeof(void*) of the target */
+    uint8_t pointerSize;
+    /** Number of entries in the index */
+    uint16_t count;
+    /** Size of the whole bundle in bytes */
+    uint32_t size;
+    /** Address the bundle was built for, the glyph tables of its fonts hold absolute pointers */
+    uint32_t base;
+} ILI9341_AssetHeader;
+
+/**
+ * @brief Entry of the index of an asset bundle, the entries follow the header sorted by id
+ */
+typedef struct {
+    /** ILI9341_Assets_Hash of the asset name */
+    uint32_t id;
+    uint16_t type;
+    uint16_t reserved;
+    /** Offset of the payload from the start of the bundle, a multiple of 4 */
+    uint32_t offset;
+    uint32_t size;
+} ILI9341_AssetEntry;
+
+/**
+ * @brief Metrics of a font asset, followed by its glyph table
+ */
+typedef struct {
+    uint8_t startCodepoint;
+    uint8_t endCodepoint;
+    /** Average char width in 10 pixels, as in ILI9341_FontDef */
+    int16_t averageWidth;
+    int8_t ascent;
+    int8_t descent;
+    uint8_t reserved[2];
+} ILI9341_AssetFont;
+
+/**
+ * @brief Uncompressed image in an asset bundle
+ */
+typedef struct {
+    uint16_t width;
+    uint16_t height;
+    /** Pixels in RGB565 format with the 2 bytes swapped, in the bundle */
+    const uint16_t* pixels;
+} ILI9341_AssetImage;
+
+/**
+ * @brief Hash of an asset name, FNV-1a 32-bit, the id of the asset
+ * @param name Name of the asset
+ * @return Id of the asset
+ */
+uint32_t ILI9341_Assets_Hash(const char* name);
+
+/**
+ * @brief Check an asset bundle
+ * @param address Start of the bundle, usually _sassets (extern const uint8_t _sassets[]), the start of the ASSETS
+ * flash region of the linker script
+ * @return Pointer to the bundle, NULL if there is no valid bundle at the address or it was built for another address
+ * or target
+ */
+const ILI9341_AssetHeader* ILI9341_Assets_Open(const void* address);
+
+/**
+ * @brief Find an asset, with a binary search of the index
+ * @param bundle Pointer to the bundle, may be NULL
+ * @param id Id of the asset
+ * @param type One of ILI9341_ASSET_* values
+ * @return Pointer to the entry of the asset, NULL if there is no asset of this id and type
+ */
+const ILI9341_AssetEntry* ILI9341_Assets_Find(const ILI9341_AssetHeader* bundle, uint32_t id, uint_fast16_t type);
+
+/**
+ * @brief Get a font of a bundle
+ * @param bundle Pointer to the bundle, may be NULL
+ * @param id Id of the font
+ * @param fallback Font returned if the bundle has no font of this id, or its entry is too small for its glyph table
+ * @return The font, its glyphs point into the bundle
+ */
+ILI9341_FontDef ILI9341_Assets_GetFont(const ILI9341_AssetHeader* bundle, uint32_t id, ILI9341_FontDef fallback);
+
+/**
+ * @brief Get an uncompressed image of a bundle
+ * @param bundle Pointer to the bundle, may be NULL
+ * @param id Id of the image
+ * @param image Filled with the size of the image and a pointer to its pixels in the bundle
+ * @return false if the bundle has no uncompressed image of this id, or its entry is too small for its pixels
+ */
+bool ILI9341_Assets_GetImage(const ILI9341_AssetHeader* bundle, uint32_t id, ILI9341_AssetImage* image);
+
+/**
+ * @brief Get a compressed image of a bundle
+ * @param bundle Pointer to the bundle, may be NULL
+ * @param id Id of the image
+ * @param image Filled with the image, its data points into the bundle
+ * @return false if the bundle has no compressed image of this id
+ */
+bool ILI9341_Assets_GetCompressedImage(
+    const ILI9341_AssetHeader* bundle,
+    uint32_t id,
+    ILI9341_CompressedImage* image
+);
+
+/**
+ * @brief Get a string of a bundle
+ * @param bundle Pointer to the bundle, may be NULL
+ * @param id Id of the string
+ * @param fallback String returned if the bundle has no string of this id, or it is not terminated within its entry
+ * @return The string, in the bundle
+ */
+const char* ILI9341_Assets_GetString(const ILI9341_AssetHeader* bundle, uint32_t id, const char* fallback);
+
+#endif  // __ILI9341_ASSETS_H__
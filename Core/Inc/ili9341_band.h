@@ -0,0 +1,75 @@
+#ifndef __ILI9341_BAND_H__
+#define __ILI9341_BAND_H__
+
+#include "ili9341.h"
+#include "ili9341_displaylist.h"
+#include "stdbool.h"
+#include "stdint.h"
+
+// Rows rendered at once, two bands of ILI9341_BAND_MAX_WIDTH pixels are buffered
+#define ILI9341_BAND_HEIGHT 16
+#define ILI9341_BAND_MAX_WIDTH 320
+// Size of each of the two display list arenas (current and previous frame) in bytes
+#define ILI9341_BAND_LIST_SIZE 4096
+// Max areas redrawn by ILI9341_Band_Update, more changes are merged together
+#define ILI9341_BAND_MAX_RECTS 8
+
+/**
+ * @brief Band renderer, a frame is recorded then rasterized band by band in RAM, one band is sent with DMA while the
+ * next one is rendered
+ * @note About 28.8 KB of RAM, keep it static. The panel has no tearing effect line wired, the frame is not synchronized
+ * to the refresh, but every band reaches the panel fully composed so nothing is ever seen half drawn.
+ */
+typedef struct {
+    const ILI9341_HandleTypeDef* ili9341;
+    /** Copy of the panel handle recording to the current display list */
+    ILI9341_HandleTypeDef recorder;
+    /** Display lists of the current and the previous frame */
+    ILI9341_DisplayList lists[2];
+    uint_fast8_t current;
+    /** Set when the panel shows the previous frame */
+    bool valid;
+    /** Line buffer to render next, and whether the other one is being sent */
+    uint_fast8_t buffer;
+    bool sending;
+    uint8_t listBuffers[2][ILI9341_BAND_LIST_SIZE] __attribute__((aligned(4)));
+    uint16_t buffers[2][ILI9341_BAND_HEIGHT * ILI9341_BAND_MAX_WIDTH];
+} ILI9341_Band;
+
+/**
+ * @brief Initialize a band renderer
+ * @param band Pointer to the band renderer
+ * @param ili9341 Pointer to ILI9341 handle structure of the panel
+ */
+void ILI9341_Band_Init(ILI9341_Band* band, const ILI9341_HandleTypeDef* ili9341);
+
+/**
+ * @brief Start recording a frame
+ * @param band Pointer to the band renderer
+ * @return Handle to draw the frame with, valid until ILI9341_Band_End or ILI9341_Band_Update
+ * @note The frame starts black. Drawing with the returned handle only records the primitives.
+ */
+ILI9341_HandleTypeDef* ILI9341_Band_Begin(ILI9341_Band* band);
+
+/**
+ * @brief Render the whole recorded frame and send it to the panel
+ * @param band Pointer to the band renderer
+ * @return false if the display list overflowed, the ops that did not fit are missing from the frame
+ */
+bool ILI9341_Band_End(ILI9341_Band* band);
+
+/**
+ * @brief Render and send only the areas of the recorded frame that changed since the previous frame
+ * @param band Pointer to the band renderer
+ * @return false if the display list overflowed, the ops that did not fit are missing from the frame
+ * @note The whole frame is sent after ILI9341_Band_Invalidate or when a display list overflowed.
+ */
+bool ILI9341_Band_Update(ILI9341_Band* band);
+
+/**
+ * @brief Send the whole next frame, call after drawing to the panel without the band renderer or rotating it
+ * @param band Pointer to the band renderer
+ */
+void ILI9341_Band_Invalidate(ILI9341_Band* band);
+
+#endif  // __ILI9341_BAND_H__
@@ -0,0 +1,137 @@
+#ifndef __ILI9341_BLEND_H__
+#define __ILI9341_BLEND_H__
+
+#include "ili9341.h"
+#include "stdbool.h"
+#include "stdint.h"
+
+// Alpha of a fully opaque source, alpha is in 256ths and rounded to 32ths by the kernels
+#define ILI9341_BLEND_OPAQUE 255
+
+/**
+ * @brief Blend pixels over pixels with one alpha
+ * @param dst Pixels blended over in RGB565 format with the 2 bytes swapped, the result is written back
+ * @param src Pixels blended in RGB565 format with the 2 bytes swapped
+ * @param count Number of pixels
+ * @param alpha Opacity of src, 0 to ILI9341_BLEND_OPAQUE
+ * @note The kernels process two pixels per 32-bit word, red and blue of one pixel and green of the other are spread
+ * over one word with room above each component for the product with the alpha, the other three over a second word.
+ */
+void ILI9341_Blend_Constant(uint16_t* dst, const uint16_t* src, size_t count, uint_fast8_t alpha);
+
+/**
+ * @brief Blend a color over pixels with one alpha, to dim or tint a background
+ * @param dst Pixels blended over in RGB565 format with the 2 bytes swapped, the result is written back
+ * @param color 16-bit color in RGB565 format
+ * @param count Number of pixels
+ * @param alpha Opacity of the color, 0 to ILI9341_BLEND_OPAQUE
+ */
+void ILI9341_Blend_Color(uint16_t* dst, uint16_t color, size_t count, uint_fast8_t alpha);
+
+/**
+ * @brief Blend pixels over pixels with an alpha per pixel
+ * @param dst Pixels blended over in RGB565 format with the 2 bytes swapped, the result is written back
+ * @param src Pixels blended in RGB565 format with the 2 bytes swapped
+ * @param alpha Opacity of each pixel of src, 0 to ILI9341_BLEND_OPAQUE
+ * @param count Number of pixels
+ * @note Two neighbors with the same alpha, as in the inside and outside of a shape, are blended together.
+ */
+void ILI9341_Blend_Alpha(uint16_t* dst, const uint16_t* src, const uint8_t* alpha, size_t count);
+
+/**
+ * @brief Blend a color over pixels through a 4-bit coverage mask, for soft shadows and anti-aliased shapes
+ * @param dst Pixels blended over in RGB565 format with the 2 bytes swapped, the result is written back
+ * @param color 16-bit color in RGB565 format
+ * @param alpha Opacity of each pixel, 0 to 15, 2 pixels per byte with the first one in the high 4 bits
+ * @param offset Position of the first pixel in alpha, in pixels
+ * @param count Number of pixels
+ */
+void ILI9341_Blend_Alpha4(uint16_t* dst, uint16_t color, const uint8_t* alpha, size_t offset, size_t count);
+
+/**
+ * @brief Blend a rectangle of color over a surface
+ * @param target Pointer to ILI9341 handle structure drawing to a surface, usually a canvas or a framebuffer
+ * @param x X coordinate of the top-left corner of the rectangle
+ * @param y Y coordinate of the top-left corner of the rectangle
+ * @param w Width of the rectangle
+ * @param h Height of the rectangle
+ * @param color 16-bit color in RGB565 format
+ * @param alpha Opacity of the color, 0 to ILI9341_BLEND_OPAQUE
+ * @return false if the handle draws to the panel or records a display list, the pixels below cannot be read back
+ * @note The result is clipped like the other primitives. Indexed surfaces store the nearest palette entry of each
+ * blended pixel, so their palette needs the blended shades.
+ */
+bool ILI9341_Blend_FillRectangle(
+    const ILI9341_HandleTypeDef* target,
+    int_fast16_t x,
+    int_fast16_t y,
+    int_fast16_t w,
+    int_fast16_t h,
+    uint16_t color,
+    uint_fast8_t alpha
+);
+
+/**
+ * @brief Blend an image over a surface with one alpha
+ * @param target Pointer to ILI9341 handle structure drawing to a surface, usually a canvas or a framebuffer
+ * @param x X coordinate of the top-left corner of the image
+ * @param y Y coordinate of the top-left corner of the image
+ * @param w Width of the image in pixels
+ * @param h Height of the image in pixels
+ * @param data Pointer to the image pixel data in RGB565 format with the 2 bytes swapped, w*h elements
+ * @param alpha Opacity of the image, 0 to ILI9341_BLEND_OPAQUE
+ * @return false if the handle draws to the panel or records a display list
+ */
+bool ILI9341_Blend_DrawImage(
+    const ILI9341_HandleTypeDef* target,
+    int_fast16_t x,
+    int_fast16_t y,
+    int_fast16_t w,
+    int_fast16_t h,
+    const uint16_t* data,
+    uint_fast8_t alpha
+);
+
+/**
+ * @brief Blend an image over a surface with an alpha per pixel
+ * @param target Pointer to ILI9341 handle structure drawing to a surface, usually a canvas or a framebuffer
+ * @param x X coordinate of the top-left corner of the image
+ * @param y Y coordinate of the top-left corner of the image
+ * @param w Width of the image in pixels
+ * @param h Height of the image in pixels
+ * @param data Pointer to the image pixel data in RGB565 format with the 2 bytes swapped, w*h elements
+ * @param alpha Opacity of each pixel, 0 to ILI9341_BLEND_OPAQUE, w*h elements
+ * @return false if the handle draws to the panel or records a display list
+ */
+bool ILI9341_Blend_DrawImageAlpha(
+    const ILI9341_HandleTypeDef* target,
+    int_fast16_t x,
+    int_fast16_t y,
+    int_fast16_t w,
+    int_fast16_t h,
+    const uint16_t* data,
+    const uint8_t* alpha
+);
+
+/**
+ * @brief Blend a color over a surface through a 4-bit coverage mask, e.g. the soft shadow of a panel
+ * @param target Pointer to ILI9341 handle structure drawing to a surface, usually a canvas or a framebuffer
+ * @param x X coordinate of the top-left corner of the mask
+ * @param y Y coordinate of the top-left corner of the mask
+ * @param w Width of the mask in pixels
+ * @param h Height of the mask in pixels
+ * @param mask Opacity of each pixel, 0 to 15, rows of (w + 1) / 2 bytes with the first pixel in the high 4 bits
+ * @param color 16-bit color in RGB565 format
+ * @return false if the handle draws to the panel or records a display list
+ */
+bool ILI9341_Blend_DrawMask(
+    const ILI9341_HandleTypeDef* target,
+    int_fast16_t x,
+    int_fast16_t y,
+    int_fast16_t w,
+    int_fast16_t h,
+    const uint8_t* mask,
+    uint16_t color
+);
+
+#endif  // __ILI9341_BLEND_H__
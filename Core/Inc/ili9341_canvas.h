@@ -0,0 +1,49 @@
+#ifndef __ILI9341_CANVAS_H__
+#define __ILI9341_CANVAS_H__
+
+#include "ili9341.h"
+#include "stdint.h"
+
+/**
+ * @brief Off-screen RGB565 drawing surface of any size, drawn once and blitted with one address window
+ */
+typedef struct {
+    /** Handle drawing to the canvas, coordinates and clipping are relative to the canvas */
+    ILI9341_HandleTypeDef drawer;
+    ILI9341_Surface surface;
+} ILI9341_Canvas;
+
+/**
+ * @brief Initialize a canvas
+ * @param canvas Pointer to the canvas
+ * @param ili9341 Pointer to ILI9341 handle structure of the panel
+ * @param pixels Pixel buffer of width * height pixels, not cleared
+ * @param width Width of the canvas
+ * @param height Height of the canvas
+ * @return Handle to draw to the canvas with, strings wrap at the canvas width
+ */
+ILI9341_HandleTypeDef* ILI9341_Canvas_Init(
+    ILI9341_Canvas* canvas,
+    const ILI9341_HandleTypeDef* ili9341,
+    uint16_t* pixels,
+    int_fast16_t width,
+    int_fast16_t height
+);
+
+/**
+ * @brief Copy a canvas to the panel or to another canvas, clipped to the target
+ * @param canvas Pointer to the canvas to copy
+ * @param target Pointer to ILI9341 handle structure to draw with, the panel, a canvas or any other surface
+ * @param x X coordinate of the top-left corner of the canvas on the target
+ * @param y Y coordinate of the top-left corner of the canvas on the target
+ * @note A canvas fully inside the panel is sent with DMA when available. The canvas pixels must stay unchanged until
+ * a display list the blit is recorded to is executed.
+ */
+void ILI9341_Canvas_Blit(
+    const ILI9341_Canvas* canvas,
+    const ILI9341_HandleTypeDef* target,
+    int_fast16_t x,
+    int_fast16_t y
+);
+
+#endif  // __ILI9341_CANVAS_H__
@@ -0,0 +1,115 @@
+#ifndef __ILI9341_DISPLAYLIST_H__
+#define __ILI9341_DISPLAYLIST_H__
+
+#include "ili9341.h"
+#include "stdbool.h"
+#include "stdint.h"
+
+// Serialized display list magic, "ILDL" in little endian
+#define ILI9341_DISPLAYLIST_MAGIC 0x4C444C49
+
+/**
+ * @brief Header of a serialized display list, followed by the ops as recorded
+ */
+typedef struct {
+    uint32_t magic;
+    /** Number of ops */
+    uint32_t count;
+    /** Size of the ops in bytes */
+    uint32_t size;
+} ILI9341_DisplayListHeader;
+
+/**
+ * @brief Initialize an empty display list
+ * @param list Pointer to the display list to initialize
+ * @param buffer Arena the ops are stored in, 4-byte aligned
+ * @param capacity Size of the arena in bytes
+ * @note Set the displayList member of a handle to the list to record the drawing primitives called with that handle.
+ * Strings and polygon points are copied, images, fonts, paths and the paints of fills are referenced and must stay
+ * valid until the list is executed.
+ */
+void ILI9341_DisplayList_Init(ILI9341_DisplayList* list, uint8_t* buffer, size_t capacity);
+
+/**
+ * @brief Remove all ops from a display list
+ * @param list Pointer to the display list
+ */
+void ILI9341_DisplayList_Clear(ILI9341_DisplayList* list);
+
+/**
+ * @brief Get the op following another op
+ * @param list Pointer to the display list
+ * @param op Pointer to an op of the list, NULL to get the first op
+ * @return Pointer to the next op, NULL after the last op
+ */
+const ILI9341_DisplayOp* ILI9341_DisplayList_Next(const ILI9341_DisplayList* list, const ILI9341_DisplayOp* op);
+
+/**
+ * @brief Run a single op
+ * @param op Pointer to the op
+ * @param ili9341 Pointer to ILI9341 handle structure to draw with
+ */
+void ILI9341_DisplayList_ExecuteOp(const ILI9341_DisplayOp* op, const ILI9341_HandleTypeDef* ili9341);
+
+/**
+ * @brief Run all ops of a display list in order
+ * @param list Pointer to the display list
+ * @param ili9341 Pointer to ILI9341 handle structure to draw with
+ */
+void ILI9341_DisplayList_Execute(const ILI9341_DisplayList* list, const ILI9341_HandleTypeDef* ili9341);
+
+/**
+ * @brief Run the ops of a display list whose bounds intersect a rectangle
+ * @param list Pointer to the display list
+ * @param ili9341 Pointer to ILI9341 handle structure to draw with, usually drawing to a surface covering the rectangle
+ * @param x0 X coordinate of the top-left corner of the rectangle
+ * @param y0 Y coordinate of the top-left corner of the rectangle
+ * @param x1 X coordinate of the bottom-right corner of the rectangle (inclusive)
+ * @param y1 Y coordinate of the bottom-right corner of the rectangle (inclusive)
+ */
+void ILI9341_DisplayList_ExecuteRegion(
+    const ILI9341_DisplayList* list,
+    const ILI9341_HandleTypeDef* ili9341,
+    int_fast16_t x0,
+    int_fast16_t y0,
+    int_fast16_t x1,
+    int_fast16_t y1
+);
+
+/**
+ * @brief Find the areas that differ between two frames
+ * @param previous Pointer to the display list of the previous frame
+ * @param current Pointer to the display list of the current frame
+ * @param rects Output array of areas to redraw, overlapping areas are merged
+ * @param maxRects Size of the rects array, more areas are merged into the closest ones
+ * @return Number of areas written to rects
+ * @note Ops are compared by position in the lists, an op added or removed in the middle of a frame marks all the ops
+ * after it. Areas can extend outside the display. Both lists must not have overflowed.
+ */
+size_t ILI9341_DisplayList_Diff(
+    const ILI9341_DisplayList* previous,
+    const ILI9341_DisplayList* current,
+    ILI9341_Rect* rects,
+    size_t maxRects
+);
+
+/**
+ * @brief Serialize a display list, e.g. to capture a frame for benchmarks
+ * @param list Pointer to the display list
+ * @param buffer Output buffer
+ * @param size Size of the output buffer in bytes
+ * @return Number of bytes written, 0 if the buffer is too small or the list overflowed
+ * @note Images and fonts are stored as addresses, a serialized list can only be loaded by the same firmware build.
+ */
+size_t ILI9341_DisplayList_Serialize(const ILI9341_DisplayList* list, uint8_t* buffer, size_t size);
+
+/**
+ * @brief Load a serialized display list, replacing the ops of a list
+ * @param list Pointer to the display list, initialized with ILI9341_DisplayList_Init
+ * @param data Serialized display list, 4-byte aligned
+ * @param size Size of the serialized data in bytes
+ * @return false if the data is invalid or does not fit, the list is then empty
+ */
+bool ILI9341_DisplayList_Deserialize(ILI9341_DisplayList* list, const uint8_t* data, size_t size);
+
+#endif  // __ILI9341_DISPLAYLIST_H__
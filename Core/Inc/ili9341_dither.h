@@ -0,0 +1,75 @@
+#ifndef __ILI9341_DITHER_H__
+#define __ILI9341_DITHER_H__
+
+#include "ili9341.h"
+#include "stdbool.h"
+#include "stdint.h"
+
+// Dithering modes of ILI9341_Dither_ConvertRow
+#define ILI9341_DITHER_NONE 0       // rounded to the nearest RGB565 color
+#define ILI9341_DITHER_ORDERED 1    // 4x4 Bayer matrix, rows and pixels in any order
+#define ILI9341_DITHER_DIFFUSION 2  // Floyd-Steinberg, rows in order from the top, the same columns in every row
+
+// Size of the error buffer of diffusion dithering, in int16_t, for rows up to width pixels
+#define ILI9341_DITHER_ERRORS_SIZE(width) (3 * (width))
+
+/**
+ * @brief Converter of RGB888 rows to RGB565
+ * @note The output byte order follows the transport: the panel is driven over 8-bit SPI, which sends the high byte
+ * first, so pixels for ILI9341_DrawImage, surfaces and canvases have the 2 bytes swapped. Native order is for other
+ * consumers, such as a 16-bit transport or arithmetic on the colors.
+ */
+typedef struct {
+    uint_fast8_t mode;
+    /** Swap the 2 bytes of the output pixels */
+    bool swap;
+    /** Errors carried to the next row by diffusion dithering, in 16ths, 3 per pixel, NULL for the other modes */
+    int16_t* errors;
+    /** Width of the rows of diffusion dithering */
+    int_fast16_t width;
+} ILI9341_Dither;
+
+/**
+ * @brief Initialize a converter
+ * @param dither Pointer to the converter
+ * @param mode One of ILI9341_DITHER_* values
+ * @param swap true for pixels sent to the panel or drawn to a surface, false for native RGB565
+ * @param errors ILI9341_DITHER_ERRORS_SIZE(width) elements for ILI9341_DITHER_DIFFUSION, otherwise unused
+ * @param width Width of the image for ILI9341_DITHER_DIFFUSION, otherwise unused
+ */
+void ILI9341_Dither_Init(
+    ILI9341_Dither* dither,
+    uint_fast8_t mode,
+    bool swap,
+    int16_t* errors,
+    int_fast16_t width
+);
+
+/**
+ * @brief Forget the errors of diffusion dithering, to start a new image with the same converter
+ * @param dither Pointer to the converter
+ */
+void ILI9341_Dither_Reset(ILI9341_Dither* dither);
+
+/**
+ * @brief Convert a run of a row of RGB888 pixels to RGB565
+ * @param dither Pointer to the converter
+ * @param pixels Output pixels, count elements
+ * @param rgb Input pixels, 3 bytes per pixel in R, G, B order
+ * @param x X coordinate of the first pixel in the image, selects the column of the Bayer matrix or of the errors
+ * @param y Y coordinate of the row in the image, selects the row of the Bayer matrix
+ * @param count Number of pixels, x + count must not exceed the width of diffusion dithering
+ * @note Diffusion carries the error of each pixel to its right neighbor and to the row below, the rows must be
+ * converted in order. The ordered mode matches Tools/image_encode.py, so images converted at runtime and offline look
+ * the same.
+ */
+void ILI9341_Dither_ConvertRow(
+    ILI9341_Dither* dither,
+    uint16_t* pixels,
+    const uint8_t* rgb,
+    int_fast16_t x,
+    int_fast16_t y,
+    size_t count
+);
+
+#endif  // __ILI9341_DITHER_H__
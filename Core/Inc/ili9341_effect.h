@@ -0,0 +1,103 @@
+#ifndef __ILI9341_EFFECT_H__
+#define __ILI9341_EFFECT_H__
+
+#include "ili9341.h"
+#include "stdbool.h"
+#include "stdint.h"
+
+// Max steps of one effect
+#define ILI9341_EFFECT_MAX_STEPS 8
+
+// Effect step types, value is the argument of the step
+#define ILI9341_EFFECT_INVERT 0      // value: 0 normal, 1 inverted colors
+#define ILI9341_EFFECT_BRIGHTNESS 1  // value: brightness
+#define ILI9341_EFFECT_FADE 2        // value: brightness reached linearly at the end of the step
+#define ILI9341_EFFECT_IDLE 3        // value: 0 full colors, 1 idle mode (8 colors)
+#define ILI9341_EFFECT_PARTIAL 4     // value: 0 normal mode, 1 partial mode (area set with ILI9341_SetPartialArea)
+#define ILI9341_EFFECT_DISPLAY 5     // value: 0 blank, 1 display on
+
+/**
+ * @brief One step of an effect, the step is applied and then held for its duration
+ */
+typedef struct {
+    uint8_t type;
+    uint8_t value;
+    uint16_t duration;
+} ILI9341_EffectStep;
+
+/**
+ * @brief Timed sequence of panel commands, the frame memory is never touched
+ */
+typedef struct {
+    ILI9341_HandleTypeDef* ili9341;
+    ILI9341_EffectStep steps[ILI9341_EFFECT_MAX_STEPS];
+    size_t count;
+    size_t index;
+    uint_fast16_t repeat;
+    uint32_t stepTick;
+    bool running;
+    /** Last brightness sent */
+    uint_fast8_t brightness;
+    /** Brightness at the start of the current fade step */
+    uint_fast8_t fadeFrom;
+    /** Bit mask of step types changed by the effect, restored on stop */
+    uint_fast8_t touched;
+} ILI9341_Effect;
+
+/**
+ * @brief Initialize an effect engine
+ * @param effect Pointer to the effect to initialize
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @note The brightness is assumed to be 0xFF.
+ */
+void ILI9341_Effect_Init(ILI9341_Effect* effect, ILI9341_HandleTypeDef* ili9341);
+
+/**
+ * @brief Start an effect, stopping the running one
+ * @param effect Pointer to the effect
+ * @param steps Steps of the effect, copied
+ * @param count Number of steps, at most ILI9341_EFFECT_MAX_STEPS
+ * @param repeat Number of times the steps are played
+ * @param tick Current time in milliseconds, usually HAL_GetTick()
+ */
+void ILI9341_Effect_Start(
+    ILI9341_Effect* effect,
+    const ILI9341_EffectStep* steps,
+    size_t count,
+    uint_fast16_t repeat,
+    uint32_t tick
+);
+
+/**
+ * @brief Flash the display by inverting the colors
+ * @param effect Pointer to the effect
+ * @param times Number of flashes
+ * @param period Duration of one flash (inverted then normal) in milliseconds
+ * @param tick Current time in milliseconds, usually HAL_GetTick()
+ */
+void ILI9341_Effect_Flash(ILI9341_Effect* effect, uint_fast16_t times, uint16_t period, uint32_t tick);
+
+/**
+ * @brief Fade the brightness down and back up
+ * @param effect Pointer to the effect
+ * @param brightness Brightness at the bottom of the fade
+ * @param duration Duration of the whole fade in milliseconds
+ * @param tick Current time in milliseconds, usually HAL_GetTick()
+ */
+void ILI9341_Effect_Fade(ILI9341_Effect* effect, uint_fast8_t brightness, uint16_t duration, uint32_t tick);
+
+/**
+ * @brief Stop the running effect and restore everything it changed
+ * @param effect Pointer to the effect
+ */
+void ILI9341_Effect_Stop(ILI9341_Effect* effect);
+
+/**
+ * @brief Advance the running effect, sends only the commands due, call often from the main loop
+ * @param effect Pointer to the effect
+ * @param tick Current time in milliseconds, usually HAL_GetTick()
+ * @return true while the effect is running
+ */
+bool ILI9341_Effect_Update(ILI9341_Effect* effect, uint32_t tick);
+
+#endif  // __ILI9341_EFFECT_H__
@@ -22,6 +22,9 @@ typedef struct {
     /** Pointer to the actual glyph data, the data format is binary bitmap stored as uint8_t array.
      * Order is left-to-right, bottom-to-top. 1 is foreground, 0 is background (or none for transparent mode) */
     const uint8_t* data;
+    /** Bits per pixel of the glyph data, 0 or 1 for binary bitmap, 2 or 4 for anti-aliased coverage (MSB first,
+     * 0 is background, all ones is foreground) */
+    const uint8_t bpp;
 } ILI9341_GlyphDef;
 
 /**
@@ -34,7 +37,7 @@ typedef struct {
     /** End codepoint (inclusive) */
     const uint_fast8_t endCodepoint;
     /** Average char width of the font, in 10 pixels (eg. average width 80 -> 80 / 10 = 8 pixels) */
-    const int_fast8_t averageWidth;
+    const int_fast16_t averageWidth;
     /** Font ascent (how far up does the font extend from baseline) */
     const int_fast8_t ascent;
     /** Font descent (how far down does the font extend from baseline) */
@@ -43,6 +46,26 @@ typedef struct {
     const ILI9341_GlyphDef* glyphs;
 } ILI9341_FontDef;
 
+/**
+ * @brief Signed distance field font definition structure
+ * @note Glyph metrics are in texels, one texel is one pixel when rendered at height ascent + descent. Glyph data is
+ * one byte per texel (bpp 8) holding the distance to the glyph outline, 128 is the edge and larger values are inside.
+ */
+typedef struct {
+    /** Start codepoint (inclusive) */
+    const uint_fast8_t startCodepoint;
+    /** End codepoint (inclusive) */
+    const uint_fast8_t endCodepoint;
+    /** Font ascent in texels */
+    const int_fast8_t ascent;
+    /** Font descent in texels */
+    const int_fast8_t descent;
+    /** Distance in texels between the edge (128) and the end of the field range (0 or 255) */
+    const int_fast8_t spread;
+    /** Glyphs data */
+    const ILI9341_GlyphDef* glyphs;
+} ILI9341_SDFFontDef;
+
 extern const ILI9341_FontDef ILI9341_Font_Terminus6x12b;
 extern const ILI9341_FontDef ILI9341_Font_Terminus6x12;
 extern const ILI9341_FontDef ILI9341_Font_Terminus8x14b;
@@ -70,6 +93,8 @@ extern const ILI9341_FontDef ILI9341_Font_Spleen8x16;
 extern const ILI9341_FontDef ILI9341_Font_Spleen12x24;
 extern const ILI9341_FontDef ILI9341_Font_Spleen16x32;
 extern const ILI9341_FontDef ILI9341_Font_Spleen32x64;
+extern const ILI9341_FontDef ILI9341_Font_Spleen16x32aa;
+extern const ILI9341_SDFFontDef ILI9341_Font_SpleenSDF;
 
 extern const ILI9341_FontDef ILI9341_Font_Manop6x14;
 extern const ILI9341_FontDef ILI9341_Font_Manop7x18;
@@ -0,0 +1,86 @@
+#ifndef __ILI9341_FRAMEBUFFER_H__
+#define __ILI9341_FRAMEBUFFER_H__
+
+#include "ili9341.h"
+#include "stdbool.h"
+#include "stdint.h"
+
+// Rows expanded to RGB565 at once, two line buffers of ILI9341_FRAMEBUFFER_MAX_WIDTH pixels are used
+#define ILI9341_FRAMEBUFFER_LINES 8
+#define ILI9341_FRAMEBUFFER_MAX_WIDTH 320
+
+// Size in bytes of the pixels of an indexed framebuffer, 9600 bytes at 1 bpp to 76800 bytes at 8 bpp for 320x240
+#define ILI9341_FRAMEBUFFER_SIZE(width, height, bpp) ((((width) * (bpp) + 7) / 8) * (height))
+
+/**
+ * @brief Full-screen framebuffer of palette indices, expanded to RGB565 when sent to the panel
+ * @note Draw with the handle returned by ILI9341_Framebuffer_Init, using colors of the palette. Other colors (e.g.
+ * anti-aliased glyph edges) are stored as the nearest palette entry.
+ */
+typedef struct {
+    const ILI9341_HandleTypeDef* ili9341;
+    /** Copy of the panel handle drawing to the framebuffer */
+    ILI9341_HandleTypeDef drawer;
+    ILI9341_Surface surface;
+    /** Palette in RGB565 format with the 2 bytes swapped */
+    uint16_t palette[256];
+    uint16_t lines[2][ILI9341_FRAMEBUFFER_LINES * ILI9341_FRAMEBUFFER_MAX_WIDTH];
+} ILI9341_Framebuffer;
+
+/**
+ * @brief Initialize an indexed framebuffer covering the display
+ * @param framebuffer Pointer to the framebuffer
+ * @param ili9341 Pointer to ILI9341 handle structure of the panel, the size of the framebuffer is its current size
+ * @param pixels Pixel buffer of ILI9341_FRAMEBUFFER_SIZE(width, height, bpp) bytes, cleared to index 0
+ * @param bpp Bits per pixel: 1, 2, 4 or 8
+ * @param palette Colors in RGB565 format, up to 2^bpp entries, copied
+ * @param count Number of colors in the palette
+ * @return Handle to draw to the framebuffer with, NULL if the parameters are invalid
+ */
+ILI9341_HandleTypeDef* ILI9341_Framebuffer_Init(
+    ILI9341_Framebuffer* framebuffer,
+    const ILI9341_HandleTypeDef* ili9341,
+    uint8_t* pixels,
+    uint_fast8_t bpp,
+    const uint16_t* palette,
+    uint_fast16_t count
+);
+
+/**
+ * @brief Replace palette entries, the pixels keep their indices so the colors change at the next flush
+ * @param framebuffer Pointer to the framebuffer
+ * @param first Index of the first entry to replace
+ * @param colors Colors in RGB565 format
+ * @param count Number of entries to replace
+ * @note Drawing after the swap must use the new colors.
+ */
+void ILI9341_Framebuffer_SetPalette(
+    ILI9341_Framebuffer* framebuffer,
+    uint_fast16_t first,
+    const uint16_t* colors,
+    uint_fast16_t count
+);
+
+/**
+ * @brief Send an area of the framebuffer to the panel, the next rows are expanded while the previous ones are sent
+ * @param framebuffer Pointer to the framebuffer
+ * @param x0 X coordinate of the top-left corner of the area
+ * @param y0 Y coordinate of the top-left corner of the area
+ * @param x1 X coordinate of the bottom-right corner of the area (inclusive)
+ * @param y1 Y coordinate of the bottom-right corner of the area (inclusive)
+ */
+void ILI9341_Framebuffer_FlushRect(
+    ILI9341_Framebuffer* framebuffer,
+    int_fast16_t x0,
+    int_fast16_t y0,
+    int_fast16_t x1,
+    int_fast16_t y1
+);
+
+/**
+ * @brief Send the whole framebuffer to the panel
+ * @param framebuffer Pointer to the framebuffer
+ */
+void ILI9341_Framebuffer_Flush(ILI9341_Framebuffer* framebuffer);
+
+#endif  // __ILI9341_FRAMEBUFFER_H__
@@ -0,0 +1,129 @@
+#ifndef __ILI9341_IMAGECACHE_H__
+#define __ILI9341_IMAGECACHE_H__
+
+#include "ili9341.h"
+#include "ili9341_assets.h"
+#include "ili9341_jpeg.h"
+#include "stdbool.h"
+#include "stdint.h"
+
+// Max images of one cache
+#define ILI9341_IMAGECACHE_MAX_ENTRIES 16
+
+/**
+ * @brief Image decoded in the arena of a cache
+ */
+typedef struct {
+    /** Id of the image, usually its asset id */
+    uint32_t id;
+    uint8_t scale;
+    uint16_t width;
+    uint16_t height;
+    /** Start of the pixels in the arena, in pixels */
+    size_t offset;
+    /** Value of the use counter of the cache when the image was last drawn */
+    uint32_t lastUse;
+} ILI9341_ImageCacheEntry;
+
+/**
+ * @brief Fixed-budget RAM cache of decoded images, keyed by id and scale, the least recently drawn image is evicted
+ * when a new one does not fit
+ * @note Cached pixels are in RGB565 format with the 2 bytes swapped, drawn with ILI9341_DrawImage. The images are
+ * packed at the start of the arena, a new image goes after the last one, evictions leave gaps that are closed by
+ * moving the following images down when the space at the end is too small.
+ */
+typedef struct {
+    uint16_t* arena;
+    /** Size of the arena in pixels */
+    size_t capacity;
+    /** End of the last image in the arena, in pixels */
+    size_t top;
+    ILI9341_ImageCacheEntry entries[ILI9341_IMAGECACHE_MAX_ENTRIES];
+    size_t count;
+    uint32_t useCounter;
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t evictions;
+} ILI9341_ImageCache;
+
+/**
+ * @brief Initialize an image cache
+ * @param cache Pointer to the cache
+ * @param arena Memory the decoded images are kept in
+ * @param capacity Size of the arena in pixels
+ */
+void ILI9341_ImageCache_Init(ILI9341_ImageCache* cache, uint16_t* arena, size_t capacity);
+
+/**
+ * @brief Remove all images from the cache, the counters are kept
+ * @param cache Pointer to the cache
+ */
+void ILI9341_ImageCache_Clear(ILI9341_ImageCache* cache);
+
+/**
+ * @brief Draw a compressed image through the cache, decoding it on a miss
+ * @param cache Pointer to the cache
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @param x X coordinate of the top-left corner of the image
+ * @param y Y coordinate of the top-left corner of the image
+ * @param id Id of the image
+ * @param image Pointer to the compressed image
+ * @param scale 0 for the full size, 1, 2 or 3 for 1/2, 1/4 or 1/8 of the size, box filtered
+ * @return false if the image is larger than the arena at full size, it is then drawn without the cache, shrunk band by
+ * band in the free space of the arena at the other scales, or not drawn if even 1 << scale rows are larger than the
+ * arena
+ */
+bool ILI9341_ImageCache_DrawCompressed(
+    ILI9341_ImageCache* cache,
+    const ILI9341_HandleTypeDef* ili9341,
+    int_fast16_t x,
+    int_fast16_t y,
+    uint32_t id,
+    const ILI9341_CompressedImage* image,
+    uint_fast8_t scale
+);
+
+/**
+ * @brief Draw a JPEG image through the cache, decoding it on a miss
+ * @param cache Pointer to the cache
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @param x X coordinate of the top-left corner of the image
+ * @param y Y coordinate of the top-left corner of the image
+ * @param id Id of the image
+ * @param jpeg Pointer to the decoder with the image opened
+ * @param scale One of ILI9341_JPEG_SCALE_* values
+ * @return false if the scaled image is larger than the arena, it is then drawn without the cache, or if the JPEG data
+ * is corrupt, a corrupt image is not cached
+ */
+bool ILI9341_ImageCache_DrawJpeg(
+    ILI9341_ImageCache* cache,
+    const ILI9341_HandleTypeDef* ili9341,
+    int_fast16_t x,
+    int_fast16_t y,
+    uint32_t id,
+    ILI9341_Jpeg* jpeg,
+    uint_fast8_t scale
+);
+
+/**
+ * @brief Draw a compressed image asset of a bundle through the cache
+ * @param cache Pointer to the cache
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @param x X coordinate of the top-left corner of the image
+ * @param y Y coordinate of the top-left corner of the image
+ * @param bundle Pointer to the bundle
+ * @param id Id of the image asset
+ * @param scale 0 for the full size, 1, 2 or 3 for 1/2, 1/4 or 1/8 of the size
+ * @return false if the bundle has no compressed image of this id or it is not cached
+ */
+bool ILI9341_ImageCache_DrawAsset(
+    ILI9341_ImageCache* cache,
+    const ILI9341_HandleTypeDef* ili9341,
+    int_fast16_t x,
+    int_fast16_t y,
+    const ILI9341_AssetHeader* bundle,
+    uint32_t id,
+    uint_fast8_t scale
+);
+
+#endif  // __ILI9341_IMAGECACHE_H__
@@ -0,0 +1,111 @@
+#ifndef __ILI9341_JPEG_H__
+#define __ILI9341_JPEG_H__
+
+#include "ili9341.h"
+#include "ili9341_dither.h"
+#include "stdbool.h"
+#include "stdint.h"
+
+// Scale factors of ILI9341_Jpeg_Draw, the image is drawn 1 / (1 << scale) of its size
+#define ILI9341_JPEG_SCALE_1 0
+#define ILI9341_JPEG_SCALE_1_2 1
+#define ILI9341_JPEG_SCALE_1_4 2
+#define ILI9341_JPEG_SCALE_1_8 3
+
+// Bits of the Huffman codes decoded with one table lookup, longer codes are searched
+#define ILI9341_JPEG_FAST_BITS 7
+// Pixels of each of the two output buffers, one 16x16 MCU, or several smaller ones side by side
+#define ILI9341_JPEG_BUFFER_SIZE 256
+
+/**
+ * @brief Huffman table of a JPEG image
+ */
+typedef struct {
+    /** Largest code of each length, -1 without codes of that length */
+    int32_t maxCode[17];
+    /** Index in values of code 0 of each length */
+    int32_t valueOffset[17];
+    /** Length << 8 | value of the codes up to ILI9341_JPEG_FAST_BITS long, by their first bits, 0 for longer codes */
+    uint16_t fast[1 << ILI9341_JPEG_FAST_BITS];
+    uint8_t values[256];
+} ILI9341_JpegHuffman;
+
+/**
+ * @brief Color component of a JPEG image
+ */
+typedef struct {
+    uint8_t id;
+    /** Sampling factors, blocks per MCU horizontally and vertically */
+    uint8_t h;
+    uint8_t v;
+    uint8_t quantTable;
+    uint8_t dcTable;
+    uint8_t acTable;
+    /** DC coefficient of the previous block */
+    int16_t dc;
+} ILI9341_JpegComponent;
+
+/**
+ * @brief Baseline JPEG image decoded MCU by MCU straight to the panel, about 5 KB of working memory with no heap
+ * @note Grayscale and YCbCr images with one interleaved scan are supported, with any chroma subsampling up to 2x2
+ * and restart markers. Progressive and arithmetic coded images are not.
+ */
+typedef struct {
+    uint16_t width;
+    uint16_t height;
+    ILI9341_JpegComponent components[3];
+    uint_fast8_t componentCount;
+    uint_fast8_t maxH;
+    uint_fast8_t maxV;
+    /** MCUs between restart markers, 0 without restart markers */
+    uint_fast16_t restartInterval;
+    /** Dither the pixels with ILI9341_DITHER_ORDERED instead of truncating them, cleared by ILI9341_Jpeg_Open */
+    bool dither;
+    uint16_t quantTables[4][64];
+    /** DC tables 0 and 1, then AC tables 0 and 1 */
+    ILI9341_JpegHuffman huffmanTables[4];
+    /** Entropy-coded data of the scan */
+    const uint8_t* scan;
+    const uint8_t* end;
+    /** Bit reader */
+    const uint8_t* position;
+    uint32_t bits;
+    int_fast8_t bitCount;
+    bool marker;
+    int16_t coefficients[64];
+    /** Samples of the current MCU, one plane per component */
+    uint8_t samples[3][256];
+    uint16_t buffers[2][ILI9341_JPEG_BUFFER_SIZE];
+} ILI9341_Jpeg;
+
+/**
+ * @brief Read the headers of a JPEG image, up to the start of its scan
+ * @param jpeg Pointer to the decoder
+ * @param data JPEG file contents, must stay available while the image is drawn
+ * @param size Size of the data in bytes
+ * @return false if the data is not a supported JPEG image
+ */
+bool ILI9341_Jpeg_Open(ILI9341_Jpeg* jpeg, const uint8_t* data, size_t size);
+
+/**
+ * @brief Decode an opened JPEG image and draw it at specified coordinates
+ * @param jpeg Pointer to the decoder
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @param x X coordinate of the top-left corner of the image
+ * @param y Y coordinate of the top-left corner of the image
+ * @param scale One of ILI9341_JPEG_SCALE_* values, the image is drawn (width >> scale) x (height >> scale) rounded up
+ * @return false if the data is corrupt, the part decoded so far is drawn
+ * @note Each MCU is sent to its own address window, with DMA while the next one is decoded when the handle has a TX
+ * DMA channel. MCUs outside the display and the clip rectangle are only entropy decoded, decoding stops after the
+ * last visible MCU row. At 1/8 only the DC coefficients are used, without IDCT, 2x2 subsampled chroma keeps the
+ * resolution of the output and is decoded at twice the scale.
+ */
+bool ILI9341_Jpeg_Draw(
+    ILI9341_Jpeg* jpeg,
+    const ILI9341_HandleTypeDef* ili9341,
+    int_fast16_t x,
+    int_fast16_t y,
+    uint_fast8_t scale
+);
+
+#endif  // __ILI9341_JPEG_H__
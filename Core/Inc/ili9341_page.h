@@ -0,0 +1,67 @@
+#ifndef __ILI9341_PAGE_H__
+#define __ILI9341_PAGE_H__
+
+#include "ili9341.h"
+#include "ili9341_fonts.h"
+#include "stdint.h"
+
+// Page op types
+#define ILI9341_PAGE_OP_FILL 0   // rectangle x, y, w, h of color
+#define ILI9341_PAGE_OP_GLYPH 1  // glyph of data (font) at x (left), y (baseline), color over bgColor
+#define ILI9341_PAGE_OP_IMAGE 2  // image data (pixels) of w * h at x, y
+
+/**
+ * @brief One pre-computed drawing step of a page, generated by Tools/page_compile.py
+ */
+typedef struct {
+    uint8_t type;
+    /** Index of the glyph in the glyph table of the font */
+    uint8_t glyph;
+    int16_t x;
+    int16_t y;
+    int16_t w;
+    int16_t h;
+    uint16_t color;
+    uint16_t bgColor;
+    /** Font of glyphs, pixels of images in RGB565 format with the 2 bytes swapped */
+    const void* data;
+} ILI9341_PageOp;
+
+/**
+ * @brief Box of a value shown on a page, filled at runtime
+ */
+typedef struct {
+    int16_t x;
+    int16_t y;
+    int16_t width;
+    int16_t height;
+    const ILI9341_FontDef* font;
+    uint16_t color;
+    uint16_t bgColor;
+    /** Horizontal alignment of the value inside the box, one of ILI9341_ALIGN_* values */
+    uint8_t align;
+    /** Text after the value, may be NULL */
+    const char* suffix;
+} ILI9341_PageField;
+
+/**
+ * @brief Static content of a page laid out at build time, the first op fills the whole page
+ */
+typedef struct {
+    int16_t width;
+    int16_t height;
+    const ILI9341_PageOp* ops;
+    size_t opCount;
+    const ILI9341_PageField* fields;
+    size_t fieldCount;
+} ILI9341_Page;
+
+/**
+ * @brief Draw the static content of a page, the ops are run in order without any layout
+ * @param page Pointer to the page
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @note With a clip stack the ops outside the clip rectangle return before any drawing.
+ */
+void ILI9341_Page_Draw(const ILI9341_Page* page, const ILI9341_HandleTypeDef* ili9341);
+
+#endif  // __ILI9341_PAGE_H__
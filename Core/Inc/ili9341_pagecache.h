@@ -0,0 +1,76 @@
+#ifndef __ILI9341_PAGECACHE_H__
+#define __ILI9341_PAGECACHE_H__
+
+#include "ili9341.h"
+#include "ili9341_page.h"
+#include "stdbool.h"
+#include "stdint.h"
+
+// Max pages of one cache
+#define ILI9341_PAGECACHE_MAX_PAGES 8
+// Rows decoded at once, two strips of ILI9341_PAGECACHE_MAX_WIDTH pixels are buffered
+#define ILI9341_PAGECACHE_STRIP_HEIGHT 8
+#define ILI9341_PAGECACHE_MAX_WIDTH 320
+
+/**
+ * @brief Page rasterized and compressed in the arena of a cache
+ */
+typedef struct {
+    const ILI9341_Page* page;
+    /** Start of the page in the arena: one offset per row from this start, then the rows */
+    const uint16_t* data;
+} ILI9341_PageCacheEntry;
+
+/**
+ * @brief Static content of pages rasterized once and kept run-length encoded in RAM, drawing a page or a part of it
+ * only decodes rows into a strip buffer sent with DMA
+ * @note Rows are runs of 16-bit words: n (1 to 0x7FFF) then one pixel repeated n times, or 0x8000 | n then n
+ * pixels, pixels in RGB565 format with the 2 bytes swapped. Mostly flat pages take a few KB each.
+ */
+typedef struct {
+    const ILI9341_HandleTypeDef* ili9341;
+    uint16_t* arena;
+    size_t capacity;
+    size_t used;
+    ILI9341_PageCacheEntry entries[ILI9341_PAGECACHE_MAX_PAGES];
+    size_t count;
+    uint16_t buffers[2][ILI9341_PAGECACHE_STRIP_HEIGHT * ILI9341_PAGECACHE_MAX_WIDTH];
+} ILI9341_PageCache;
+
+/**
+ * @brief Initialize a page cache
+ * @param cache Pointer to the cache
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @param arena Memory the pages are kept in
+ * @param capacity Size of the arena in 16-bit words
+ */
+void ILI9341_PageCache_Init(
+    ILI9341_PageCache* cache,
+    const ILI9341_HandleTypeDef* ili9341,
+    uint16_t* arena,
+    size_t capacity
+);
+
+/**
+ * @brief Rasterize a page and keep it in the cache, nothing is sent to the panel
+ * @param cache Pointer to the cache
+ * @param page Pointer to the page, at most ILI9341_PAGECACHE_MAX_WIDTH pixels wide
+ * @return false if the cache is full or the page does not fit in the arena, the page is then not cached
+ */
+bool ILI9341_PageCache_Add(ILI9341_PageCache* cache, const ILI9341_Page* page);
+
+/**
+ * @brief Draw a cached page, only the part inside the clip rectangle of the handle
+ * @param cache Pointer to the cache
+ * @param page Pointer to the page
+ * @param ili9341 Pointer to ILI9341 handle structure to draw with, the handle of the cache or a copy of it
+ * @return false if the page is not cached or the handle records to a display list or draws to a surface, nothing is
+ * drawn then
+ */
+bool ILI9341_PageCache_Draw(
+    ILI9341_PageCache* cache,
+    const ILI9341_Page* page,
+    const ILI9341_HandleTypeDef* ili9341
+);
+
+#endif  // __ILI9341_PAGECACHE_H__
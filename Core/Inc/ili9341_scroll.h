@@ -0,0 +1,151 @@
+#ifndef __ILI9341_SCROLL_H__
+#define __ILI9341_SCROLL_H__
+
+#include "ili9341.h"
+#include "ili9341_fonts.h"
+#include "stdbool.h"
+#include "stdint.h"
+
+// Max band height in pixels ((ascent + descent) * scale) of a ticker
+#define ILI9341_TICKER_MAX_HEIGHT 128
+
+// Columns drawn at once by a ticker without hardware scrolling, 2 bytes per pixel of the band on the stack
+#define ILI9341_TICKER_COLUMNS 8
+
+// Number of lines kept by a console, also the max number of visible lines
+#define ILI9341_CONSOLE_LINES 16
+
+// Max characters per console line, longer lines are wrapped
+#define ILI9341_CONSOLE_LINE_LENGTH 52
+
+/**
+ * @brief Horizontal marquee
+ * @note With hardware scrolling the whole scroll area scrolls, only the band of the text is redrawn and the rest of the
+ * area wraps around. The panel scrolls whole columns of the screen, so anything above or below the band moves with it.
+ * Without hardware scrolling only the band is drawn again on each step, the rest of the screen stays in place. The
+ * panel cannot shift pixels, so the whole band is sent instead of the newly exposed columns: a 320x32 band is 20.8 KB
+ * per step, about 3.1 ms at 54 Mbit/s, against 74 bytes with hardware scrolling. A marquee over part of a landscape
+ * screen therefore costs a full band per step.
+ */
+typedef struct {
+    ILI9341_HandleTypeDef* ili9341;
+    bool hardware;
+    /** Columns of the band, for redrawing it without hardware scrolling */
+    int_fast16_t x;
+    int_fast16_t width;
+    const char* str;
+    ILI9341_FontDef font;
+    uint16_t color;
+    uint16_t bgColor;
+    int_fast16_t y;
+    int_fast16_t scale;
+    int_fast16_t gap;
+    /** Length of one repetition (string advance + gap) in pixels */
+    int_fast16_t length;
+    /** Next text column to draw with hardware scrolling, text column at the left of the band without */
+    int_fast16_t position;
+    /** Index and start column of the character containing position */
+    size_t charIndex;
+    int_fast16_t charStart;
+} ILI9341_Ticker;
+
+/**
+ * @brief Log console using hardware scrolling
+ * @note Scrolling needs a vertical rotation (ILI9341_ROTATION_VERTICAL_*), in horizontal rotations the console falls
+ * back to redrawing all visible lines on update.
+ */
+typedef struct {
+    ILI9341_HandleTypeDef* ili9341;
+    ILI9341_FontDef font;
+    uint16_t color;
+    uint16_t bgColor;
+    int_fast16_t y;
+    int_fast16_t lineHeight;
+    int_fast16_t visibleLines;
+    bool hardware;
+    char lines[ILI9341_CONSOLE_LINES][ILI9341_CONSOLE_LINE_LENGTH + 1];
+    /** Number of completed lines */
+    volatile uint_fast32_t written;
+    /** Number of completed lines drawn */
+    uint_fast32_t drawn;
+    /** Characters in the line being written */
+    size_t column;
+} ILI9341_Console;
+
+/**
+ * @brief Initialize a ticker and set the scroll area
+ * @param ticker Pointer to the ticker to initialize
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @param hardware true to scroll the columns of the area with the panel, false to redraw only the text band
+ * @param x X coordinate of the left of the scroll area
+ * @param width Width of the scroll area in pixels
+ * @param y Y coordinate of the baseline of the text
+ * @param str Null-terminated string to scroll, must stay valid while the ticker is used
+ * @param font Font to use for the text
+ * @param color 16-bit text color in RGB565 format
+ * @param bgColor 16-bit background color in RGB565 format
+ * @param scale Scaling factor (integer) to enlarge the text
+ * @param gap Blank pixels between repetitions of the string
+ * @return false if hardware scrolling is asked and the display is not in a horizontal rotation, or the text band is too
+ * high
+ * @note Without hardware scrolling, the scroll area is not set and a step sends the whole band instead of the new
+ * columns, width * (ascent + descent) * scale pixels.
+ */
+bool ILI9341_Ticker_Init(
+    ILI9341_Ticker* ticker,
+    ILI9341_HandleTypeDef* ili9341,
+    bool hardware,
+    int_fast16_t x,
+    int_fast16_t width,
+    int_fast16_t y,
+    const char* str,
+    ILI9341_FontDef font,
+    uint16_t color,
+    uint16_t bgColor,
+    int_fast16_t scale,
+    int_fast16_t gap
+);
+
+/**
+ * @brief Scroll the ticker to the left and draw the newly exposed columns, or the whole band without hardware
+ * scrolling
+ * @param ticker Pointer to the ticker
+ * @param pixels Number of pixels to scroll
+ */
+void ILI9341_Ticker_Step(ILI9341_Ticker* ticker, int_fast16_t pixels);
+
+/**
+ * @brief Initialize a console, set the scroll area and clear it
+ * @param console Pointer to the console to initialize
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @param y Y coordinate of the top of the console
+ * @param height Height of the console in pixels, rounded down to whole lines
+ * @param font Font to use for the text
+ * @param color 16-bit text color in RGB565 format
+ * @param bgColor 16-bit background color in RGB565 format
+ */
+void ILI9341_Console_Init(
+    ILI9341_Console* console,
+    ILI9341_HandleTypeDef* ili9341,
+    int_fast16_t y,
+    int_fast16_t height,
+    ILI9341_FontDef font,
+    uint16_t color,
+    uint16_t bgColor
+);
+
+/**
+ * @brief Append text to the console without drawing, lines are completed by '\n'
+ * @param console Pointer to the console
+ * @param str Null-terminated string to append, '\r' is ignored
+ * @note Safe to call from an interrupt as long as the calls don't interleave with each other.
+ */
+void ILI9341_Console_Print(ILI9341_Console* console, const char* str);
+
+/**
+ * @brief Draw the lines completed since the last update
+ * @param console Pointer to the console
+ */
+void ILI9341_Console_Update(ILI9341_Console* console);
+
+#endif  // __ILI9341_SCROLL_H__
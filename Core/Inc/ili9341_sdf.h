@@ -0,0 +1,62 @@
+#ifndef __ILI9341_SDF_H__
+#define __ILI9341_SDF_H__
+
+#include "ili9341.h"
+#include "ili9341_fonts.h"
+#include "stdbool.h"
+#include "stdint.h"
+
+// Number of (font, height) pairs kept rasterized at the same time
+#define ILI9341_SDF_CACHE_SLOTS 2
+
+// Rasterized 4bpp glyph data per slot, a 64 pixel high glyph takes about 1 KB
+#define ILI9341_SDF_CACHE_BUFFER_SIZE 16384
+
+// Max glyphs per font (endCodepoint - startCodepoint + 1)
+#define ILI9341_SDF_CACHE_GLYPHS 96
+
+// Largest pixel height, the ascent, descent and glyph boxes of the rendered font are int8_t
+#define ILI9341_SDF_MAX_HEIGHT 127
+
+/**
+ * @brief Get a bitmap font of the SDF font rasterized at the specified pixel height
+ * @param font Pointer to the SDF font definition
+ * @param height Pixel height of the rendered font (ascent + descent), clamped to 1..ILI9341_SDF_MAX_HEIGHT
+ * @param str Null-terminated string whose glyphs must be rasterized, can be NULL
+ * @return 4bpp anti-aliased font usable with ILI9341_WriteString and the other text functions
+ * @note Glyphs are rasterized on first use and cached per (font, height). Glyphs that are not in str (or in a string
+ * given before for the same font and height) have correct advance but are drawn empty. The returned font stays valid
+ * until the cache slot is reused for another (font, height) pair.
+ */
+ILI9341_FontDef ILI9341_SDF_GetFont(const ILI9341_SDFFontDef* font, int_fast16_t height, const char* str);
+
+/**
+ * @brief Write a string rendered from an SDF font at arbitrary pixel height
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @param x X coordinate of the left of the string
+ * @param y Y coordinate of the baseline of the string
+ * @param str Null-terminated string to write
+ * @param font Pointer to the SDF font definition
+ * @param height Pixel height of the rendered font (ascent + descent), nothing is drawn below 1, clamped to
+ * ILI9341_SDF_MAX_HEIGHT
+ * @param color 16-bit text color in RGB565 format
+ * @param bgcolor 16-bit background color in RGB565 format
+ * @param wrap Whether to wrap text to the next line if it exceeds display width
+ * @param tracking Additional space in pixels between characters
+ * @param leading Additional space in pixels between lines when wrapping
+ */
+void ILI9341_WriteStringSDF(
+    const ILI9341_HandleTypeDef* ili9341,
+    int_fast16_t x,
+    int_fast16_t y,
+    const char* str,
+    const ILI9341_SDFFontDef* font,
+    int_fast16_t height,
+    uint16_t color,
+    uint16_t bgcolor,
+    bool wrap,
+    int_fast16_t tracking,
+    int_fast16_t leading
+);
+
+#endif  // __ILI9341_SDF_H__
@@ -0,0 +1,131 @@
+#ifndef __ILI9341_SPRITE_H__
+#define __ILI9341_SPRITE_H__
+
+#include "ili9341.h"
+#include "stdbool.h"
+#include "stdint.h"
+
+// Max sprites of one layer
+#define ILI9341_SPRITE_MAX 8
+
+// Pixels of each of the two strip buffers, a moved area is rendered in strips of this size
+#define ILI9341_SPRITE_BUFFER_SIZE 2048
+
+/**
+ * @brief Draws the background under the sprites
+ * @param target Handle to draw with, drawing is clipped to the area
+ * @param area Area to draw, inclusive
+ * @param context Context given to ILI9341_SpriteLayer_Init
+ * @note The panel cannot be read back fast enough, the background is drawn again instead of saved. A fill, a canvas
+ * blit or the replay of a display list with ILI9341_DisplayList_ExecuteRegion are all fine.
+ */
+typedef void (*ILI9341_SpriteBackground)(const ILI9341_HandleTypeDef* target, const ILI9341_Rect* area, void* context);
+
+/**
+ * @brief Image moved over a background, drawn with transparency
+ */
+typedef struct {
+    /** Pixels in RGB565 format with the 2 bytes swapped */
+    const uint16_t* image;
+    /** 1bpp opacity mask, see ILI9341_DrawImageTransparent, NULL to use the color key */
+    const uint8_t* mask;
+    uint16_t colorKey;
+    int16_t x;
+    int16_t y;
+    int16_t width;
+    int16_t height;
+    /** Position the sprite is shown at on the panel */
+    int16_t drawnX;
+    int16_t drawnY;
+    bool drawn;
+    bool visible;
+    bool dirty;
+} ILI9341_Sprite;
+
+/**
+ * @brief Set of sprites over one background, only the areas of the sprites that changed are sent
+ */
+typedef struct {
+    const ILI9341_HandleTypeDef* ili9341;
+    ILI9341_SpriteBackground background;
+    void* context;
+    /** Sprites from bottom to top */
+    ILI9341_Sprite* sprites[ILI9341_SPRITE_MAX];
+    size_t count;
+    uint_fast8_t buffer;
+    bool sending;
+    uint16_t buffers[2][ILI9341_SPRITE_BUFFER_SIZE];
+} ILI9341_SpriteLayer;
+
+/**
+ * @brief Initialize a sprite layer
+ * @param layer Pointer to the layer
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @param background Function drawing the background under the sprites
+ * @param context Passed to the background function
+ */
+void ILI9341_SpriteLayer_Init(
+    ILI9341_SpriteLayer* layer,
+    const ILI9341_HandleTypeDef* ili9341,
+    ILI9341_SpriteBackground background,
+    void* context
+);
+
+/**
+ * @brief Initialize a hidden sprite
+ * @param sprite Pointer to the sprite
+ * @param image Pixels in RGB565 format with the 2 bytes swapped, must contain at least width*height elements
+ * @param mask 1bpp opacity mask, rows of (width + 7) / 8 bytes, MSB first, 1 is opaque, NULL to use colorKey
+ * @param colorKey 16-bit color in RGB565 format of the transparent pixels, used when mask is NULL
+ * @param width Width of the image, at least 1
+ * @param height Height of the image, at least 1
+ */
+void ILI9341_Sprite_Init(
+    ILI9341_Sprite* sprite,
+    const uint16_t* image,
+    const uint8_t* mask,
+    uint16_t colorKey,
+    int_fast16_t width,
+    int_fast16_t height
+);
+
+/**
+ * @brief Add a sprite on top of the sprites of a layer
+ * @param layer Pointer to the layer
+ * @param sprite Pointer to the sprite, must stay valid while in the layer
+ * @return false if the layer is full
+ */
+bool ILI9341_SpriteLayer_Add(ILI9341_SpriteLayer* layer, ILI9341_Sprite* sprite);
+
+/**
+ * @brief Move a sprite, shown on the next update
+ * @param sprite Pointer to the sprite
+ * @param x X coordinate of the top-left corner
+ * @param y Y coordinate of the top-left corner
+ */
+void ILI9341_Sprite_MoveTo(ILI9341_Sprite* sprite, int_fast16_t x, int_fast16_t y);
+
+/**
+ * @brief Show or hide a sprite, shown on the next update
+ * @param sprite Pointer to the sprite
+ * @param visible true to show the sprite
+ */
+void ILI9341_Sprite_Show(ILI9341_Sprite* sprite, bool visible);
+
+/**
+ * @brief Change the image of a sprite, for animation frames, shown on the next update
+ * @param sprite Pointer to the sprite
+ * @param image Pixels of the same size as the previous image
+ * @param mask Opacity mask of the image, NULL to use the color key
+ */
+void ILI9341_Sprite_SetImage(ILI9341_Sprite* sprite, const uint16_t* image, const uint8_t* mask);
+
+/**
+ * @brief Send the changes of the sprites of a layer
+ * @param layer Pointer to the layer
+ * @note For each changed sprite only its previous and new areas are sent, as one area when they overlap, with the
+ * background and every sprite over them drawn in order.
+ */
+void ILI9341_SpriteLayer_Update(ILI9341_SpriteLayer* layer);
+
+#endif  // __ILI9341_SPRITE_H__
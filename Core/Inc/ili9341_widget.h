@@ -0,0 +1,287 @@
+#ifndef __ILI9341_WIDGET_H__
+#define __ILI9341_WIDGET_H__
+
+#include "ili9341.h"
+#include "ili9341_page.h"
+#include "ili9341_pagecache.h"
+#include "stdbool.h"
+#include "stdint.h"
+
+// Widget types
+#define ILI9341_WIDGET_CONTAINER 0
+#define ILI9341_WIDGET_LABEL 1
+#define ILI9341_WIDGET_NUMBER 2
+#define ILI9341_WIDGET_IMAGE 3
+#define ILI9341_WIDGET_PROGRESS 4
+#define ILI9341_WIDGET_PAGE 5
+
+// Max length of the text of labels and numbers, including the null terminator
+#define ILI9341_WIDGET_TEXT_SIZE 32
+
+// Max areas redrawn by one update, more are merged
+#define ILI9341_UI_MAX_RECTS 8
+
+/**
+ * @brief Node of a widget tree, drawn inside its box over its parent, children in z-order after their parent
+ */
+typedef struct ILI9341_Widget {
+    uint8_t type;
+    bool visible;
+    /** The whole box is drawn again on the next update */
+    bool dirty;
+    /** Only the previous and new text areas are drawn again on the next update */
+    bool textDirty;
+    /** Horizontal alignment of the text inside the box, one of ILI9341_ALIGN_* values */
+    uint8_t align;
+    /** Box on the display, the widget never draws outside of it */
+    int16_t x;
+    int16_t y;
+    int16_t width;
+    int16_t height;
+    /** Text color, or filled part color of progress bars */
+    uint16_t color;
+    /** Box color of containers, labels and numbers, or empty part color of progress bars */
+    uint16_t bgColor;
+    ILI9341_FontDef font;
+    /** Text of labels, formatted from the value and the suffix for numbers */
+    char text[ILI9341_WIDGET_TEXT_SIZE];
+    /** Area covered by the text when last drawn */
+    ILI9341_Rect textArea;
+    /** Text after the value of numbers, may be NULL */
+    const char* suffix;
+    /** Value of numbers and progress bars */
+    int32_t value;
+    /** Value of a full progress bar */
+    int32_t max;
+    /** Pixels of images in RGB565 format with the 2 bytes swapped, width * height elements */
+    const uint16_t* image;
+    /** Static content of pages */
+    const ILI9341_Page* page;
+    /** Cache the page is drawn from when it holds it, may be NULL */
+    ILI9341_PageCache* cache;
+    struct ILI9341_Widget* firstChild;
+    struct ILI9341_Widget* nextSibling;
+} ILI9341_Widget;
+
+/**
+ * @brief Widget tree shown on the display, only the boxes of the changed widgets are redrawn
+ */
+typedef struct {
+    /** Handle drawing the widgets, clipped to the redrawn areas */
+    ILI9341_HandleTypeDef drawer;
+    ILI9341_ClipStack clip;
+    ILI9341_Widget* root;
+    /** false until the whole tree is drawn */
+    bool valid;
+} ILI9341_Ui;
+
+/**
+ * @brief Initialize a container, a filled box other widgets are added to
+ * @param widget Pointer to the widget
+ * @param x X coordinate of the top-left corner of the box
+ * @param y Y coordinate of the top-left corner of the box
+ * @param width Width of the box
+ * @param height Height of the box
+ * @param bgColor 16-bit color of the box in RGB565 format
+ */
+void ILI9341_Widget_InitContainer(
+    ILI9341_Widget* widget,
+    int_fast16_t x,
+    int_fast16_t y,
+    int_fast16_t width,
+    int_fast16_t height,
+    uint16_t bgColor
+);
+
+/**
+ * @brief Initialize a label, a line of text vertically centered in its box
+ * @param widget Pointer to the widget
+ * @param x X coordinate of the top-left corner of the box
+ * @param y Y coordinate of the top-left corner of the box
+ * @param width Width of the box
+ * @param height Height of the box
+ * @param text Null-terminated text, copied, truncated to ILI9341_WIDGET_TEXT_SIZE - 1 characters
+ * @param font Font definition to use for rendering the text
+ * @param color 16-bit text color in RGB565 format
+ * @param bgColor 16-bit color of the box in RGB565 format
+ * @param align Horizontal alignment of the text, one of ILI9341_ALIGN_* values
+ */
+void ILI9341_Widget_InitLabel(
+    ILI9341_Widget* widget,
+    int_fast16_t x,
+    int_fast16_t y,
+    int_fast16_t width,
+    int_fast16_t height,
+    const char* text,
+    ILI9341_FontDef font,
+    uint16_t color,
+    uint16_t bgColor,
+    uint_fast8_t align
+);
+
+/**
+ * @brief Initialize a number, a label showing a decimal value followed by a suffix
+ * @param widget Pointer to the widget
+ * @param x X coordinate of the top-left corner of the box
+ * @param y Y coordinate of the top-left corner of the box
+ * @param width Width of the box
+ * @param height Height of the box
+ * @param value Value to show
+ * @param suffix Null-terminated text after the value, not copied, NULL for none
+ * @param font Font definition to use for rendering the text
+ * @param color 16-bit text color in RGB565 format
+ * @param bgColor 16-bit color of the box in RGB565 format
+ * @param align Horizontal alignment of the text, one of ILI9341_ALIGN_* values
+ */
+void ILI9341_Widget_InitNumber(
+    ILI9341_Widget* widget,
+    int_fast16_t x,
+    int_fast16_t y,
+    int_fast16_t width,
+    int_fast16_t height,
+    int32_t value,
+    const char* suffix,
+    ILI9341_FontDef font,
+    uint16_t color,
+    uint16_t bgColor,
+    uint_fast8_t align
+);
+
+/**
+ * @brief Initialize an image, the box is the size of the image
+ * @param widget Pointer to the widget
+ * @param x X coordinate of the top-left corner of the image
+ * @param y Y coordinate of the top-left corner of the image
+ * @param width Width of the image
+ * @param height Height of the image
+ * @param image Pixels in RGB565 format with the 2 bytes swapped, must contain at least width*height elements
+ */
+void ILI9341_Widget_InitImage(
+    ILI9341_Widget* widget,
+    int_fast16_t x,
+    int_fast16_t y,
+    int_fast16_t width,
+    int_fast16_t height,
+    const uint16_t* image
+);
+
+/**
+ * @brief Initialize a horizontal progress bar, filled from the left
+ * @param widget Pointer to the widget
+ * @param x X coordinate of the top-left corner of the box
+ * @param y Y coordinate of the top-left corner of the box
+ * @param width Width of the box
+ * @param height Height of the box
+ * @param value Current value, clamped to [0, max]
+ * @param max Value of a full bar, at least 1
+ * @param color 16-bit color of the filled part in RGB565 format
+ * @param bgColor 16-bit color of the empty part in RGB565 format
+ */
+void ILI9341_Widget_InitProgress(
+    ILI9341_Widget* widget,
+    int_fast16_t x,
+    int_fast16_t y,
+    int_fast16_t width,
+    int_fast16_t height,
+    int32_t value,
+    int32_t max,
+    uint16_t color,
+    uint16_t bgColor
+);
+
+/**
+ * @brief Initialize a page, the static content of a ILI9341_Page, the box is the size of the page
+ * @param widget Pointer to the widget
+ * @param page Pointer to the page, usually generated by Tools/page_compile.py
+ * @note Values are shown on a page by adding numbers initialized with ILI9341_Widget_InitField.
+ */
+void ILI9341_Widget_InitPage(ILI9341_Widget* widget, const ILI9341_Page* page);
+
+/**
+ * @brief Draw a page from a cache instead of running its ops, when the cache holds it
+ * @param widget Pointer to the page
+ * @param cache Pointer to the cache, NULL to run the ops again
+ */
+void ILI9341_Widget_SetPageCache(ILI9341_Widget* widget, ILI9341_PageCache* cache);
+
+/**
+ * @brief Initialize a number at a field of a page
+ * @param widget Pointer to the widget
+ * @param field Pointer to the field, box, font, colors, alignment and suffix are taken from it
+ * @param value Value to show
+ */
+void ILI9341_Widget_InitField(ILI9341_Widget* widget, const ILI9341_PageField* field, int32_t value);
+
+/**
+ * @brief Add a widget on top of the children of a container
+ * @param parent Pointer to the container
+ * @param child Pointer to the widget, not already in a tree
+ */
+void ILI9341_Widget_Add(ILI9341_Widget* parent, ILI9341_Widget* child);
+
+/**
+ * @brief Change the text of a label, the old and new text areas are redrawn on the next update if it changed
+ * @param widget Pointer to the label
+ * @param text Null-terminated text, copied, truncated to ILI9341_WIDGET_TEXT_SIZE - 1 characters
+ */
+void ILI9341_Widget_SetText(ILI9341_Widget* widget, const char* text);
+
+/**
+ * @brief Change the value of a number or a progress bar, redrawn on the next update if it changed
+ * @param widget Pointer to the number or progress bar
+ * @param value New value
+ */
+void ILI9341_Widget_SetValue(ILI9341_Widget* widget, int32_t value);
+
+/**
+ * @brief Change the pixels of an image, redrawn on the next update if they changed
+ * @param widget Pointer to the image
+ * @param image Pixels of the same size as the previous ones
+ */
+void ILI9341_Widget_SetImage(ILI9341_Widget* widget, const uint16_t* image);
+
+/**
+ * @brief Change the colors of a widget, redrawn on the next update if they changed
+ * @param widget Pointer to the widget
+ * @param color 16-bit text or filled part color in RGB565 format
+ * @param bgColor 16-bit box or empty part color in RGB565 format
+ */
+void ILI9341_Widget_SetColor(ILI9341_Widget* widget, uint16_t color, uint16_t bgColor);
+
+/**
+ * @brief Show or hide a widget and its children, its box is redrawn on the next update if it changed
+ * @param widget Pointer to the widget
+ * @param visible true to show the widget
+ */
+void ILI9341_Widget_SetVisible(ILI9341_Widget* widget, bool visible);
+
+/**
+ * @brief Redraw the box of a widget on the next update
+ * @param widget Pointer to the widget
+ */
+void ILI9341_Widget_Invalidate(ILI9341_Widget* widget);
+
+/**
+ * @brief Initialize a widget tree display
+ * @param ui Pointer to the widget tree display
+ * @param ili9341 Pointer to ILI9341 handle structure
+ */
+void ILI9341_Ui_Init(ILI9341_Ui* ui, const ILI9341_HandleTypeDef* ili9341);
+
+/**
+ * @brief Show another widget tree, fully drawn on the next update
+ * @param ui Pointer to the widget tree display
+ * @param root Root of the tree, usually a container covering the display, NULL to draw nothing
+ */
+void ILI9341_Ui_SetRoot(ILI9341_Ui* ui, ILI9341_Widget* root);
+
+/**
+ * @brief Redraw the boxes of the changed widgets, with every widget over them in z-order
+ * @param ui Pointer to the widget tree display
+ * @return true if anything was drawn
+ * @note Nothing is sent when no widget changed. Trees deeper than ILI9341_CLIP_STACK_DEPTH - 1 are not clipped to the
+ * boxes of their deepest containers.
+ */
+bool ILI9341_Ui_Update(ILI9341_Ui* ui);
+
+#endif  // __ILI9341_WIDGET_H__
@@ -7,58 +7,132 @@
 #include "LCD_pages.h"
 #include "usart.h"
 #include "state.h"
+#include "ili9341_scroll.h"
+#include "ili9341_widget.h"
+#include "LCD_pages_data.h"
+
+// Attract mode marquee speed
+#define TICKER_STEP_MS 20
 
 uint8_t previousState = 255;
-uint8_t previousTime = 255;
+
+static ILI9341_Ticker ticker;
+static bool tickerRunning = false;
+static uint32_t tickerTick = 0;
+
+// One widget tree per page, only the widgets whose value changed are drawn again
+static ILI9341_Ui ui;
+
+static ILI9341_Widget idlePage, idleCoinsLeft;
+static ILI9341_Widget waitCoinPage, waitCoinCoinsLeft;
+static ILI9341_Widget gamePage, gameTimeLeft;
+static ILI9341_Widget depositPage;
+
+// The static content of all pages rasterized at boot, a page switch is then one streamed blit and the fields
+#define PAGE_CACHE_SIZE 16384
+static ILI9341_PageCache pageCache;
+static uint16_t pageCacheArena[PAGE_CACHE_SIZE];
+
+// The static content of the pages is laid out at build time from Tools/LCD_pages.json, only the fields are widgets
+static void initPage(ILI9341_Widget* widget, const ILI9341_Page* page){
+	ILI9341_Widget_InitPage(widget, page);
+	// pages not fitting in the arena are drawn from their ops
+	if (ILI9341_PageCache_Add(&pageCache, page)) ILI9341_Widget_SetPageCache(widget, &pageCache);
+}
+
+static void initField(ILI9341_Widget* page, ILI9341_Widget* field, size_t index){
+	ILI9341_Widget_InitField(field, &page->page->fields[index], 0);
+	ILI9341_Widget_Add(page, field);
+}
+
+void initPages(void){
+	ILI9341_Ui_Init(&ui, &ili9341);
+	ILI9341_PageCache_Init(&pageCache, &ili9341, pageCacheArena, PAGE_CACHE_SIZE);
+
+	initPage(&idlePage, &LCD_Page_Idle);
+	initField(&idlePage, &idleCoinsLeft, LCD_FIELD_IDLE_COINS_LEFT);
+
+	initPage(&waitCoinPage, &LCD_Page_WaitCoin);
+	initField(&waitCoinPage, &waitCoinCoinsLeft, LCD_FIELD_WAIT_COIN_COINS_LEFT);
+
+	initPage(&gamePage, &LCD_Page_Game);
+	initField(&gamePage, &gameTimeLeft, LCD_FIELD_GAME_TIME_LEFT);
+
+	initPage(&depositPage, &LCD_Page_Deposit);
+}
+
+uint32_t measurePageSwitch(bool cached, uint32_t rounds){
+	ILI9341_Widget* const pages[] = {&idlePage, &waitCoinPage, &gamePage, &depositPage};
+	const uint32_t count = sizeof(pages) / sizeof(pages[0]);
+
+	for (uint32_t i = 0; i < count; i++) ILI9341_Widget_SetPageCache(pages[i], cached ? &pageCache : NULL);
+
+	// the whole page and its fields are sent on every switch, same as on a state change
+	uint32_t start = HAL_GetTick();
+	for (uint32_t round = 0; round < rounds; round++){
+		for (uint32_t i = 0; i < count; i++){
+			ILI9341_Ui_SetRoot(&ui, pages[i]);
+			ILI9341_Ui_Update(&ui);
+		}
+	}
+	uint32_t elapsed = HAL_GetTick() - start;
+
+	// pages that didn't fit in the arena keep being drawn from their ops
+	for (uint32_t i = 0; i < count; i++) ILI9341_Widget_SetPageCache(pages[i], &pageCache);
+	previousState = 255;
+
+	return rounds > 0 ? elapsed * 1000 / (rounds * count) : 0;
+}
 
 void renderPage(uint8_t state){
-	char coinAmountBuf[60];
 	extern uint8_t currentCoinAmount;
 	extern uint8_t TARGET_COIN_AMOUNT;
+	extern int timeCount;
+
+	if (state != previousState && tickerRunning) {
+		if (ticker.hardware) ILI9341_ResetScroll(&ili9341);
+		tickerRunning = false;
+	}
 
 	switch (state){
 		case IDLE:
 			if (state != previousState) {
-				ILI9341_FillScreen(&ili9341, ILI9341_COLOR_WHITE);
-				ILI9341_WriteString(&ili9341, 80, ili9341.height/2, "INSERT COIN", ILI9341_Font_Spleen16x32, ILI9341_COLOR_BLACK, ILI9341_COLOR_WHITE, 1, 1, 0, 0);
+				ILI9341_Widget_SetValue(&idleCoinsLeft, TARGET_COIN_AMOUNT - currentCoinAmount);
+				ILI9341_Ui_SetRoot(&ui, &idlePage);
+				ILI9341_Ui_Update(&ui);
 
-				sprintf(coinAmountBuf, "%d Bath Remaining", TARGET_COIN_AMOUNT - currentCoinAmount);
-				ILI9341_WriteString(&ili9341, 25, ili9341.height/2 + 30 , coinAmountBuf, ILI9341_Font_Spleen16x32, ILI9341_COLOR_RED, ILI9341_COLOR_WHITE, 1, 1, 0, 0);
+				// hardware scrolling would move the title and the coins left with the marquee, only its band is redrawn,
+				// 20.8 KB per step, about 3.1 ms of the 20 ms step at 54 Mbit/s instead of one new column
+				tickerRunning = ILI9341_Ticker_Init(&ticker, &ili9341, false, 0, ili9341.width, 50, "CLAW MACHINE * INSERT COIN TO PLAY * ", ILI9341_Font_Spleen16x32, ILI9341_COLOR_BLUE, ILI9341_COLOR_WHITE, 1, 0);
+				tickerTick = HAL_GetTick();
+			}
+			else if (tickerRunning && HAL_GetTick() - tickerTick >= TICKER_STEP_MS) {
+				uint32_t steps = (HAL_GetTick() - tickerTick) / TICKER_STEP_MS;
+				ILI9341_Ticker_Step(&ticker, steps);
+				tickerTick += steps * TICKER_STEP_MS;
 			}
 			break;
 
 		case WAIT_COIN:
-			if (state != previousState) {
-				ILI9341_FillScreen(&ili9341, ILI9341_COLOR_WHITE);
-				ILI9341_WriteString(&ili9341, 80, ili9341.height/2, "INSERT COIN", ILI9341_Font_Spleen16x32, ILI9341_COLOR_BLACK, ILI9341_COLOR_WHITE, 1, 1, 0, 0);
+			if (state != previousState) ILI9341_Ui_SetRoot(&ui, &waitCoinPage);
 
-				sprintf(coinAmountBuf, "%d Bath Remaining", TARGET_COIN_AMOUNT - currentCoinAmount);
-				ILI9341_WriteString(&ili9341, 25+16, ili9341.height/2 + 30 , coinAmountBuf, ILI9341_Font_Spleen16x32, ILI9341_COLOR_RED, ILI9341_COLOR_WHITE, 1, 1, 0, 0);
-			}
+			// only the counter is drawn again when a coin is inserted
+			ILI9341_Widget_SetValue(&waitCoinCoinsLeft, TARGET_COIN_AMOUNT - currentCoinAmount);
+			ILI9341_Ui_Update(&ui);
 			break;
 
 		case GAME:
-			extern int timeCount;
-//			int timeCount = 0;
-			if (state != previousState || timeCount != previousTime) {
-				ILI9341_FillScreen(&ili9341, ILI9341_COLOR_WHITE);
-				ILI9341_WriteString(&ili9341, 40, ili9341.height/2 - 50, "TIME REMAINING", ILI9341_Font_Spleen16x32, ILI9341_COLOR_BLACK, ILI9341_COLOR_WHITE, 1, 1, 0, 0);
-
+			if (state != previousState) ILI9341_Ui_SetRoot(&ui, &gamePage);
 
-				char timeRemainingBuf[32];
-				sprintf(timeRemainingBuf, "%d", 30-timeCount);
-				ILI9341_WriteString(&ili9341, 120, ili9341.height/2 + 30, timeRemainingBuf, ILI9341_Font_Spleen32x64, ILI9341_COLOR_RED, ILI9341_COLOR_WHITE, 1, 1, 0, 0);
-			}
-
-			previousTime = timeCount;
+			// only the countdown is drawn again every second
+			ILI9341_Widget_SetValue(&gameTimeLeft, 30 - timeCount);
+			ILI9341_Ui_Update(&ui);
 			break;
 
 		case DEPOSIT:
 			if (state != previousState) {
-				ILI9341_FillScreen(&ili9341, ILI9341_COLOR_WHITE);
-				ILI9341_WriteString(&ili9341, 85, ili9341.height/2 - 30, "Game Ended", ILI9341_Font_Spleen16x32, ILI9341_COLOR_RED, ILI9341_COLOR_WHITE, 1, 1, 0, 0);
-
-				ILI9341_WriteString(&ili9341, 60, ili9341.height/2, "Please wait...", ILI9341_Font_Spleen16x32, ILI9341_COLOR_BLACK, ILI9341_COLOR_WHITE, 1, 1, 0, 0);
+				ILI9341_Ui_SetRoot(&ui, &depositPage);
+				ILI9341_Ui_Update(&ui);
 			}
 			break;
 	}
@@ -0,0 +1,96 @@
+/*
+ * Generated by Tools/page_compile.py from LCD_pages.json, do not edit.
+ */
+
+#include "LCD_pages_data.h"
+
+static const ILI9341_PageOp LCD_Page_Idle_Ops[] = {
+    {ILI9341_PAGE_OP_FILL, 0, 0, 0, 320, 240, ILI9341_COLOR_WHITE, ILI9341_COLOR_WHITE, NULL},
+    {ILI9341_PAGE_OP_GLYPH, 41, 71, 120, 0, 0, ILI9341_COLOR_BLACK, ILI9341_COLOR_WHITE, &ILI9341_Font_Spleen16x32},
+    {ILI9341_PAGE_OP_GLYPH, 46, 87, 120, 0, 0, ILI9341_COLOR_BLACK, ILI9341_COLOR_WHITE, &ILI9341_Font_Spleen16x32},
+    {ILI9341_PAGE_OP_GLYPH, 51, 103, 120, 0, 0, ILI9341_COLOR_BLACK, ILI9341_COLOR_WHITE, &ILI9341_Font_Spleen16x32},
+    {ILI9341_PAGE_OP_GLYPH, 37, 119, 120, 0, 0, ILI9341_COLOR_BLACK, ILI9341_COLOR_WHITE, &ILI9341_Font_Spleen16x32},
+    {ILI9341_PAGE_OP_GLYPH, 50, 135, 120, 0, 0, ILI9341_COLOR_BLACK, ILI9341_COLOR_WHITE, &ILI9341_Font_Spleen16x32},
+    {ILI9341_PAGE_OP_GLYPH, 52, 151, 120, 0, 0, ILI9341_COLOR_BLACK, ILI9341_COLOR_WHITE, &ILI9341_Font_Spleen16x32},
+    {ILI9341_PAGE_OP_GLYPH, 35, 183, 120, 0, 0, ILI9341_COLOR_BLACK, ILI9341_COLOR_WHITE, &ILI9341_Font_Spleen16x32},
+    {ILI9341_PAGE_OP_GLYPH, 47, 199, 120, 0, 0, ILI9341_COLOR_BLACK, ILI9341_COLOR_WHITE, &ILI9341_Font_Spleen16x32},
+    {ILI9341_PAGE_OP_GLYPH, 41, 215, 120, 0, 0, ILI9341_COLOR_BLACK, ILI9341_COLOR_WHITE, &ILI9341_Font_Spleen16x32},
+    {ILI9341_PAGE_OP_GLYPH, 46, 231, 120, 0, 0, ILI9341_COLOR_BLACK, ILI9341_COLOR_WHITE, &ILI9341_Font_Spleen16x32}
+};
+
+static const ILI9341_PageField LCD_Page_Idle_Fields[] = {
+    {0, 125, 320, 32, &ILI9341_Font_Spleen16x32, ILI9341_COLOR_RED, ILI9341_COLOR_WHITE, ILI9341_ALIGN_CENTER, " Bath Remaining"}
+};
+
+const ILI9341_Page LCD_Page_Idle = {320, 240, LCD_Page_Idle_Ops, 11, LCD_Page_Idle_Fields, 1};
+
+static const ILI9341_PageOp LCD_Page_WaitCoin_Ops[] = {
+    {ILI9341_PAGE_OP_FILL, 0, 0, 0, 320, 240, ILI9341_COLOR_WHITE, ILI9341_COLOR_WHITE, NULL},
+    {ILI9341_PAGE_OP_GLYPH, 41, 71, 120, 0, 0, ILI9341_COLOR_BLACK, ILI9341_COLOR_WHITE, &ILI9341_Font_Spleen16x32},
+    {ILI9341_PAGE_OP_GLYPH, 46, 87, 120, 0, 0, ILI9341_COLOR_BLACK, ILI9341_COLOR_WHITE, &ILI9341_Font_Spleen16x32},
+    {ILI9341_PAGE_OP_GLYPH, 51, 103, 120, 0, 0, ILI9341_COLOR_BLACK, ILI9341_COLOR_WHITE, &ILI9341_Font_Spleen16x32},
+    {ILI9341_PAGE_OP_GLYPH, 37, 119, 120, 0, 0, ILI9341_COLOR_BLACK, ILI9341_COLOR_WHITE, &ILI9341_Font_Spleen16x32},
+    {ILI9341_PAGE_OP_GLYPH, 50, 135, 120, 0, 0, ILI9341_COLOR_BLACK, ILI9341_COLOR_WHITE, &ILI9341_Font_Spleen16x32},
+    {ILI9341_PAGE_OP_GLYPH, 52, 151, 120, 0, 0, ILI9341_COLOR_BLACK, ILI9341_COLOR_WHITE, &ILI9341_Font_Spleen16x32},
+    {ILI9341_PAGE_OP_GLYPH, 35, 183, 120, 0, 0, ILI9341_COLOR_BLACK, ILI9341_COLOR_WHITE, &ILI9341_Font_Spleen16x32},
+    {ILI9341_PAGE_OP_GLYPH, 47, 199, 120, 0, 0, ILI9341_COLOR_BLACK, ILI9341_COLOR_WHITE, &ILI9341_Font_Spleen16x32},
+    {ILI9341_PAGE_OP_GLYPH, 41, 215, 120, 0, 0, ILI9341_COLOR_BLACK, ILI9341_COLOR_WHITE, &ILI9341_Font_Spleen16x32},
+    {ILI9341_PAGE_OP_GLYPH, 46, 231, 120, 0, 0, ILI9341_COLOR_BLACK, ILI9341_COLOR_WHITE, &ILI9341_Font_Spleen16x32}
+};
+
+static const ILI9341_PageField LCD_Page_WaitCoin_Fields[] = {
+    {0, 125, 320, 32, &ILI9341_Font_Spleen16x32, ILI9341_COLOR_RED, ILI9341_COLOR_WHITE, ILI9341_ALIGN_CENTER, " Bath Remaining"}
+};
+
+const ILI9341_Page LCD_Page_WaitCoin = {320, 240, LCD_Page_WaitCoin_Ops, 11, LCD_Page_WaitCoin_Fields, 1};
+
+static const ILI9341_PageOp LCD_Page_Game_Ops[] = {
+    {ILI9341_PAGE_OP_FILL, 0, 0, 0, 320, 240, ILI9341_COLOR_WHITE, ILI9341_COLOR_WHITE, NULL},
+    {ILI9341_PAGE_OP_GLYPH, 52, 48, 70, 0, 0, ILI9341_COLOR_BLACK, ILI9341_COLOR_WHITE, &ILI9341_Font_Spleen16x32},
+    {ILI9341_PAGE_OP_GLYPH, 41, 64, 70, 0, 0, ILI9341_COLOR_BLACK, ILI9341_COLOR_WHITE, &ILI9341_Font_Spleen16x32},
+    {ILI9341_PAGE_OP_GLYPH, 45, 80, 70, 0, 0, ILI9341_COLOR_BLACK, ILI9341_COLOR_WHITE, &ILI9341_Font_Spleen16x32},
+    {ILI9341_PAGE_OP_GLYPH, 37, 96, 70, 0, 0, ILI9341_COLOR_BLACK, ILI9341_COLOR_WHITE, &ILI9341_Font_Spleen16x32},
+    {ILI9341_PAGE_OP_GLYPH, 50, 128, 70, 0, 0, ILI9341_COLOR_BLACK, ILI9341_COLOR_WHITE, &ILI9341_Font_Spleen16x32},
+    {ILI9341_PAGE_OP_GLYPH, 37, 144, 70, 0, 0, ILI9341_COLOR_BLACK, ILI9341_COLOR_WHITE, &ILI9341_Font_Spleen16x32},
+    {ILI9341_PAGE_OP_GLYPH, 45, 160, 70, 0, 0, ILI9341_COLOR_BLACK, ILI9341_COLOR_WHITE, &ILI9341_Font_Spleen16x32},
+    {ILI9341_PAGE_OP_GLYPH, 33, 176, 70, 0, 0, ILI9341_COLOR_BLACK, ILI9341_COLOR_WHITE, &ILI9341_Font_Spleen16x32},
+    {ILI9341_PAGE_OP_GLYPH, 41, 192, 70, 0, 0, ILI9341_COLOR_BLACK, ILI9341_COLOR_WHITE, &ILI9341_Font_Spleen16x32},
+    {ILI9341_PAGE_OP_GLYPH, 46, 208, 70, 0, 0, ILI9341_COLOR_BLACK, ILI9341_COLOR_WHITE, &ILI9341_Font_Spleen16x32},
+    {ILI9341_PAGE_OP_GLYPH, 41, 224, 70, 0, 0, ILI9341_COLOR_BLACK, ILI9341_COLOR_WHITE, &ILI9341_Font_Spleen16x32},
+    {ILI9341_PAGE_OP_GLYPH, 46, 240, 70, 0, 0, ILI9341_COLOR_BLACK, ILI9341_COLOR_WHITE, &ILI9341_Font_Spleen16x32},
+    {ILI9341_PAGE_OP_GLYPH, 39, 256, 70, 0, 0, ILI9341_COLOR_BLACK, ILI9341_COLOR_WHITE, &ILI9341_Font_Spleen16x32}
+};
+
+static const ILI9341_PageField LCD_Page_Game_Fields[] = {
+    {0, 99, 320, 64, &ILI9341_Font_Spleen32x64, ILI9341_COLOR_RED, ILI9341_COLOR_WHITE, ILI9341_ALIGN_CENTER, NULL}
+};
+
+const ILI9341_Page LCD_Page_Game = {320, 240, LCD_Page_Game_Ops, 14, LCD_Page_Game_Fields, 1};
+
+static const ILI9341_PageOp LCD_Page_Deposit_Ops[] = {
+    {ILI9341_PAGE_OP_FILL, 0, 0, 0, 320, 240, ILI9341_COLOR_WHITE, ILI9341_COLOR_WHITE, NULL},
+    {ILI9341_PAGE_OP_GLYPH, 39, 80, 90, 0, 0, ILI9341_COLOR_RED, ILI9341_COLOR_WHITE, &ILI9341_Font_Spleen16x32},
+    {ILI9341_PAGE_OP_GLYPH, 65, 96, 90, 0, 0, ILI9341_COLOR_RED, ILI9341_COLOR_WHITE, &ILI9341_Font_Spleen16x32},
+    {ILI9341_PAGE_OP_GLYPH, 77, 112, 90, 0, 0, ILI9341_COLOR_RED, ILI9341_COLOR_WHITE, &ILI9341_Font_Spleen16x32},
+    {ILI9341_PAGE_OP_GLYPH, 69, 128, 90, 0, 0, ILI9341_COLOR_RED, ILI9341_COLOR_WHITE, &ILI9341_Font_Spleen16x32},
+    {ILI9341_PAGE_OP_GLYPH, 37, 160, 90, 0, 0, ILI9341_COLOR_RED, ILI9341_COLOR_WHITE, &ILI9341_Font_Spleen16x32},
+    {ILI9341_PAGE_OP_GLYPH, 78, 176, 90, 0, 0, ILI9341_COLOR_RED, ILI9341_COLOR_WHITE, &ILI9341_Font_Spleen16x32},
+    {ILI9341_PAGE_OP_GLYPH, 68, 192, 90, 0, 0, ILI9341_COLOR_RED, ILI9341_COLOR_WHITE, &ILI9341_Font_Spleen16x32},
+    {ILI9341_PAGE_OP_GLYPH, 69, 208, 90, 0, 0, ILI9341_COLOR_RED, ILI9341_COLOR_WHITE, &ILI9341_Font_Spleen16x32},
+    {ILI9341_PAGE_OP_GLYPH, 68, 224, 90, 0, 0, ILI9341_COLOR_RED, ILI9341_COLOR_WHITE, &ILI9341_Font_Spleen16x32},
+    {ILI9341_PAGE_OP_GLYPH, 48, 50, 120, 0, 0, ILI9341_COLOR_BLACK, ILI9341_COLOR_WHITE, &ILI9341_Font_Spleen16x32},
+    {ILI9341_PAGE_OP_GLYPH, 76, 66, 120, 0, 0, ILI9341_COLOR_BLACK, ILI9341_COLOR_WHITE, &ILI9341_Font_Spleen16x32},
+    {ILI9341_PAGE_OP_GLYPH, 69, 82, 120, 0, 0, ILI9341_COLOR_BLACK, ILI9341_COLOR_WHITE, &ILI9341_Font_Spleen16x32},
+    {ILI9341_PAGE_OP_GLYPH, 65, 98, 120, 0, 0, ILI9341_COLOR_BLACK, ILI9341_COLOR_WHITE, &ILI9341_Font_Spleen16x32},
+    {ILI9341_PAGE_OP_GLYPH, 83, 114, 120, 0, 0, ILI9341_COLOR_BLACK, ILI9341_COLOR_WHITE, &ILI9341_Font_Spleen16x32},
+    {ILI9341_PAGE_OP_GLYPH, 69, 130, 120, 0, 0, ILI9341_COLOR_BLACK, ILI9341_COLOR_WHITE, &ILI9341_Font_Spleen16x32},
+    {ILI9341_PAGE_OP_GLYPH, 87, 162, 120, 0, 0, ILI9341_COLOR_BLACK, ILI9341_COLOR_WHITE, &ILI9341_Font_Spleen16x32},
+    {ILI9341_PAGE_OP_GLYPH, 65, 178, 120, 0, 0, ILI9341_COLOR_BLACK, ILI9341_COLOR_WHITE, &ILI9341_Font_Spleen16x32},
+    {ILI9341_PAGE_OP_GLYPH, 73, 194, 120, 0, 0, ILI9341_COLOR_BLACK, ILI9341_COLOR_WHITE, &ILI9341_Font_Spleen16x32},
+    {ILI9341_PAGE_OP_GLYPH, 84, 210, 120, 0, 0, ILI9341_COLOR_BLACK, ILI9341_COLOR_WHITE, &ILI9341_Font_Spleen16x32},
+    {ILI9341_PAGE_OP_GLYPH, 14, 226, 120, 0, 0, ILI9341_COLOR_BLACK, ILI9341_COLOR_WHITE, &ILI9341_Font_Spleen16x32},
+    {ILI9341_PAGE_OP_GLYPH, 14, 242, 120, 0, 0, ILI9341_COLOR_BLACK, ILI9341_COLOR_WHITE, &ILI9341_Font_Spleen16x32},
+    {ILI9341_PAGE_OP_GLYPH, 14, 258, 120, 0, 0, ILI9341_COLOR_BLACK, ILI9341_COLOR_WHITE, &ILI9341_Font_Spleen16x32}
+};
+
+const ILI9341_Page LCD_Page_Deposit = {320, 240, LCD_Page_Deposit_Ops, 23, NULL, 0};
@@ -1,16 +1,19 @@
 #include "ili9341.h"
 
 #include "stm32f7xx_hal.h"
+#include "string.h"
 
 /**
  * @brief Select the ILI9341 display
  * @param ili9341 Pointer to ILI9341 handle structure
  */
 static void ILI9341_Select(const ILI9341_HandleTypeDef* ili9341) {
+    if (ili9341->surface) return;
     HAL_GPIO_WritePin(ili9341->cs_port, ili9341->cs_pin, GPIO_PIN_RESET);
 }
 
 void ILI9341_Deselect(const ILI9341_HandleTypeDef* ili9341) {
+    if (ili9341->surface) return;
     HAL_GPIO_WritePin(ili9341->cs_port, ili9341->cs_pin, GPIO_PIN_SET);
 }
 
@@ -52,6 +55,381 @@ static void ILI9341_WriteData(const ILI9341_HandleTypeDef* ili9341, uint8_t* buf
     }
 }
 
+/**
+ * @brief Find the palette entry nearest to a color
+ * @param palette Palette in RGB565 format with the 2 bytes swapped
+ * @param size Number of palette entries
+ * @param color Color in RGB565 format with the 2 bytes swapped
+ * @return Index of the nearest entry
+ */
+static uint_fast8_t ILI9341_FindPaletteIndex(const uint16_t* palette, uint_fast16_t size, uint16_t color) {
+    const int_fast32_t r = (color >> 3) & 0x1F, g = ((color & 0x07) << 3) | (color >> 13), b = (color >> 8) & 0x1F;
+    int_fast32_t bestDistance = INT32_MAX;
+    uint_fast8_t best = 0;
+
+    for (uint_fast16_t i = 0; i < size; i++) {
+        if (palette[i] == color) return i;
+
+        const uint16_t entry = palette[i];
+        // green has one more bit, weigh red and blue to the same scale
+        int_fast32_t dr = (((entry >> 3) & 0x1F) - r) * 2;
+        int_fast32_t dg = (((entry & 0x07) << 3) | (entry >> 13)) - g;
+        int_fast32_t db = (((entry >> 8) & 0x1F) - b) * 2;
+        int_fast32_t distance = dr * dr + dg * dg + db * db;
+
+        if (distance < bestDistance) {
+            bestDistance = distance;
+            best = i;
+        }
+    }
+
+    return best;
+}
+
+/**
+ * @brief Write a run of pixels to a row of an indexed surface
+ * @param surface Indexed surface to write to
+ * @param row Row in the surface
+ * @param column First column in the surface
+ * @param pixels Pixels in RGB565 format with the 2 bytes swapped
+ * @param count Number of pixels
+ */
+static void ILI9341_WriteSurfaceIndexed(
+    const ILI9341_Surface* surface,
+    int_fast16_t row,
+    int_fast16_t column,
+    const uint16_t* pixels,
+    int_fast16_t count
+) {
+    const uint_fast8_t bpp = surface->bpp;
+    const uint_fast8_t mask = (1 << bpp) - 1;
+    uint8_t* line = (uint8_t*)surface->buffer + row * ((surface->width * bpp + 7) / 8);
+
+    // primitives write runs of the same color, only look up changes
+    uint16_t color = ~pixels[0];
+    uint_fast8_t index = 0;
+
+    for (int_fast16_t i = 0; i < count; i++) {
+        if (pixels[i] != color) {
+            color = pixels[i];
+            index = ILI9341_FindPaletteIndex(surface->palette, surface->paletteSize, color);
+        }
+
+        uint_fast32_t bit = (uint_fast32_t)(column + i) * bpp;
+        uint_fast8_t shift = 8 - bpp - (bit & 7);
+        uint8_t* byte = &line[bit >> 3];
+        *byte = (*byte & ~(mask << shift)) | (index << shift);
+    }
+}
+
+/**
+ * @brief Write pixels to the address window of a surface, pixels outside the surface are dropped
+ * @param surface Surface to write to
+ * @param pixels Pixels in RGB565 format with the 2 bytes swapped
+ * @param count Number of pixels
+ */
+static void ILI9341_WriteSurface(ILI9341_Surface* surface, const uint16_t* pixels, size_t count) {
+    while (count > 0) {
+        int_fast16_t run = surface->windowX1 - surface->cursorX + 1;
+        if ((size_t)run > count) run = count;
+
+        int_fast16_t row = surface->cursorY - surface->y;
+        if (row >= 0 && row < surface->height) {
+            int_fast16_t start = surface->cursorX < surface->x ? surface->x : surface->cursorX;
+            int_fast16_t end = surface->cursorX + run;
+            if (end > surface->x + surface->width) end = surface->x + surface->width;
+
+            if (start < end && surface->bpp) {
+                ILI9341_WriteSurfaceIndexed(
+                    surface, row, start - surface->x, &pixels[start - surface->cursorX], end - start
+                );
+            } else if (start < end) {
+                memcpy(
+                    (uint16_t*)surface->buffer + row * surface->width + start - surface->x,
+                    &pixels[start - surface->cursorX],
+                    (end - start) * sizeof(uint16_t)
+                );
+            }
+        }
+
+        pixels += run;
+        count -= run;
+        surface->cursorX += run;
+        if (surface->cursorX > surface->windowX1) {
+            surface->cursorX = surface->windowX0;
+            surface->cursorY++;
+        }
+    }
+}
+
+/**
+ * @brief Write pixels to the address window without clipping, on the panel or on the surface of the handle
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @param pixels Pixels in RGB565 format with the 2 bytes swapped
+ * @param count Number of pixels
+ */
+static void ILI9341_WritePixelsUnclipped(const ILI9341_HandleTypeDef* ili9341, const uint16_t* pixels, size_t count) {
+    if (ili9341->surface) {
+        ILI9341_WriteSurface(ili9341->surface, pixels, count);
+    } else {
+        ILI9341_WriteData(ili9341, (uint8_t*)pixels, count * sizeof(uint16_t));
+    }
+}
+
+/**
+ * @brief Write the pixels of a partly clipped address window that are inside the clip rectangle
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @param pixels Pixels of the requested address window in RGB565 format with the 2 bytes swapped
+ * @param count Number of pixels
+ * @note The address window sent is the visible part, its pixels are written in the same order.
+ */
+static void ILI9341_WritePixelsClipped(const ILI9341_HandleTypeDef* ili9341, const uint16_t* pixels, size_t count) {
+    ILI9341_ClipStack* clip = ili9341->clip;
+    const ILI9341_Rect* visible = &clip->visible;
+
+    while (count > 0) {
+        int_fast16_t run = clip->windowX1 - clip->cursorX + 1;
+        if ((size_t)run > count) run = count;
+
+        if (clip->cursorY >= visible->y0 && clip->cursorY <= visible->y1) {
+            int_fast16_t start = clip->cursorX < visible->x0 ? visible->x0 : clip->cursorX;
+            int_fast16_t end = clip->cursorX + run - 1 > visible->x1 ? visible->x1 : clip->cursorX + run - 1;
+
+            if (start <= end) ILI9341_WritePixelsUnclipped(ili9341, &pixels[start - clip->cursorX], end - start + 1);
+        }
+
+        pixels += run;
+        count -= run;
+        clip->cursorX += run;
+        if (clip->cursorX > clip->windowX1) {
+            clip->cursorX = clip->windowX0;
+            clip->cursorY++;
+        }
+    }
+}
+
+/**
+ * @brief Write pixels to the address window, on the panel or on the surface of the handle
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @param pixels Pixels in RGB565 format with the 2 bytes swapped
+ * @param count Number of pixels
+ */
+static void ILI9341_WritePixels(const ILI9341_HandleTypeDef* ili9341, const uint16_t* pixels, size_t count) {
+    if (ili9341->clip && ili9341->clip->filtering) {
+        ILI9341_WritePixelsClipped(ili9341, pixels, count);
+    } else {
+        ILI9341_WritePixelsUnclipped(ili9341, pixels, count);
+    }
+}
+
+/**
+ * @brief Set the bounds of an op to a rectangle given by position and size
+ * @param op Op to set the bounds of
+ * @param x X coordinate of the rectangle
+ * @param y Y coordinate of the rectangle
+ * @param w Width of the rectangle, negative extends to the left like ILI9341_FillRectangle
+ * @param h Height of the rectangle, negative extends up like ILI9341_FillRectangle
+ */
+static void ILI9341_SetOpBounds(
+    ILI9341_DisplayOp* op,
+    int_fast16_t x,
+    int_fast16_t y,
+    int_fast16_t w,
+    int_fast16_t h
+) {
+    op->x0 = w < 0 ? x + w + 1 : x;
+    op->y0 = h < 0 ? y + h + 1 : y;
+    op->x1 = w < 0 ? x : x + w - 1;
+    op->y1 = h < 0 ? y : y + h - 1;
+}
+
+/**
+ * @brief Compute the bounds of a primitive call
+ * @param ili9341 Pointer to ILI9341 handle structure the primitive is called with
+ * @param op Op of the call, its bounds are set
+ * @param data String of strings, X coordinates of polygons, otherwise unused
+ * @param data2 Y coordinates of polygons, otherwise unused
+ */
+static void ILI9341_ComputeOpBounds(
+    const ILI9341_HandleTypeDef* ili9341,
+    ILI9341_DisplayOp* op,
+    const void* data,
+    const void* data2
+) {
+    const int16_t* args = op->args;
+    switch (op->type) {
+        case ILI9341_OP_PIXEL:
+            ILI9341_SetOpBounds(op, args[0], args[1], 1, 1);
+            break;
+        case ILI9341_OP_FILL_RECTANGLE:
+        case ILI9341_OP_IMAGE:
+        case ILI9341_OP_IMAGE_TRANSPARENT:
+        case ILI9341_OP_IMAGE_SCALED:
+        case ILI9341_OP_RECTANGLE:
+            ILI9341_SetOpBounds(op, args[0], args[1], args[2], args[3]);
+            break;
+        case ILI9341_OP_LINE:
+            op->x0 = args[0] < args[2] ? args[0] : args[2];
+            op->y0 = args[1] < args[3] ? args[1] : args[3];
+            op->x1 = args[0] < args[2] ? args[2] : args[0];
+            op->y1 = args[1] < args[3] ? args[3] : args[1];
+            break;
+        case ILI9341_OP_CIRCLE:
+        case ILI9341_OP_CIRCLE_THICK:
+        case ILI9341_OP_FILL_CIRCLE: {
+            int_fast16_t r = abs(args[2]);
+            ILI9341_SetOpBounds(op, args[0] - r, args[1] - r, 2 * r + 1, 2 * r + 1);
+            break;
+        }
+        case ILI9341_OP_ELLIPSE:
+        case ILI9341_OP_ELLIPSE_THICK:
+        case ILI9341_OP_FILL_ELLIPSE: {
+            int_fast16_t rx = abs(args[2]), ry = abs(args[3]);
+            ILI9341_SetOpBounds(op, args[0] - rx, args[1] - ry, 2 * rx + 1, 2 * ry + 1);
+            break;
+        }
+        case ILI9341_OP_FILL_PATH: {
+            // the right and bottom edges of the box fill the pixels they are on
+            const ILI9341_Path* path = op->data;
+            const uint_fast16_t scale = (uint16_t)args[2];
+            ILI9341_SetOpBounds(
+                op,
+                args[0],
+                args[1],
+                (((int_fast64_t)path->width * scale + 128) >> 8) + 1,
+                (((int_fast64_t)path->height * scale + 128) >> 8) + 1
+            );
+            break;
+        }
+        case ILI9341_OP_IMAGE_COMPRESSED: {
+            const ILI9341_CompressedImage* image = op->data;
+            ILI9341_SetOpBounds(op, args[0], args[1], image->width, image->height);
+            break;
+        }
+        case ILI9341_OP_GLYPH: {
+            const ILI9341_GlyphDef* glyph = op->data;
+            ILI9341_SetOpBounds(
+                op,
+                args[0] + glyph->bbX * args[2],
+                args[1] - (glyph->bbY + glyph->bbH) * args[2] + 1,
+                glyph->bbW * args[2],
+                glyph->bbH * args[2]
+            );
+            break;
+        }
+        case ILI9341_OP_POLYGON:
+        case ILI9341_OP_FILL_POLYGON: {
+            const int16_t* x = data;
+            const int16_t* y = data2;
+            op->x0 = op->x1 = x[0];
+            op->y0 = op->y1 = y[0];
+            for (int_fast16_t i = 1; i < args[0]; i++) {
+                if (x[i] < op->x0) op->x0 = x[i];
+                if (x[i] > op->x1) op->x1 = x[i];
+                if (y[i] < op->y0) op->y0 = y[i];
+                if (y[i] > op->y1) op->y1 = y[i];
+            }
+            break;
+        }
+        case ILI9341_OP_STRING:
+        case ILI9341_OP_STRING_TRANSPARENT: {
+            const ILI9341_FontDef font = {
+                op->fontStartCodepoint,
+                op->fontEndCodepoint,
+                op->fontAverageWidth,
+                op->fontAscent,
+                op->fontDescent,
+                op->data
+            };
+            const char* str = data;
+            ILI9341_TextBounds bounds = ILI9341_MeasureString(str, font, args[2], args[3], args[4]);
+            int_fast16_t right = args[0] + (bounds.x + bounds.width > bounds.advance ? bounds.x + bounds.width
+                                                                                      : bounds.advance);
+
+            // wrapped text can use the rest of the display, unless it fits on its lines
+            bool wraps = op->flags && right + 1 >= ili9341->width;
+
+            // glyphs may stick out of the ascent by a pixel
+            op->x0 = args[0] + (bounds.x < 0 ? bounds.x : 0);
+            op->y0 = args[1] - font.ascent * args[2];
+            op->x1 = wraps ? ili9341->width - 1 : args[0] + bounds.x + bounds.width - 1;
+            op->y1 = wraps ? ili9341->height - 1 : op->y0 + bounds.height + 1;
+            break;
+        }
+    }
+}
+
+/**
+ * @brief Append a primitive call to the display list of the handle
+ * @param ili9341 Pointer to ILI9341 handle structure, displayList must be set
+ * @param op Op to append, size and bounds are computed
+ * @param data First trailing data (string or polygon X coordinates), can be NULL
+ * @param dataSize Size of the first trailing data in bytes
+ * @param data2 Second trailing data (polygon Y coordinates), can be NULL
+ * @param data2Size Size of the second trailing data in bytes
+ */
+static void ILI9341_RecordOp(
+    const ILI9341_HandleTypeDef* ili9341,
+    const ILI9341_DisplayOp* op,
+    const void* data,
+    size_t dataSize,
+    const void* data2,
+    size_t data2Size
+) {
+    ILI9341_DisplayList* list = ili9341->displayList;
+    size_t size = (sizeof(ILI9341_DisplayOp) + dataSize + data2Size + 3) & ~(size_t)3;
+
+    if (list->used + size > list->capacity || size > UINT16_MAX) {
+        list->overflow = true;
+        return;
+    }
+
+    ILI9341_DisplayOp* recorded = (ILI9341_DisplayOp*)&list->buffer[list->used];
+    memcpy(recorded, op, sizeof(ILI9341_DisplayOp));
+    if (dataSize) memcpy((uint8_t*)(recorded + 1), data, dataSize);
+    if (data2Size) memcpy((uint8_t*)(recorded + 1) + dataSize, data2, data2Size);
+    recorded->size = size;
+
+    ILI9341_ComputeOpBounds(ili9341, recorded, recorded + 1, (const uint8_t*)(recorded + 1) + dataSize);
+
+    list->used += size;
+    list->count++;
+}
+
+/**
+ * @brief Record a primitive call, or reject it if it is outside the clip rectangle
+ * @param ili9341 Pointer to ILI9341 handle structure, displayList or clip must be set
+ * @param op Op of the call
+ * @param data First trailing data (string or polygon X coordinates), can be NULL
+ * @param dataSize Size of the first trailing data in bytes
+ * @param data2 Second trailing data (polygon Y coordinates), can be NULL
+ * @param data2Size Size of the second trailing data in bytes
+ * @return true if the primitive must return without drawing
+ */
+static bool ILI9341_InterceptOp(
+    const ILI9341_HandleTypeDef* ili9341,
+    const ILI9341_DisplayOp* op,
+    const void* data,
+    size_t dataSize,
+    const void* data2,
+    size_t data2Size
+) {
+    if (ili9341->displayList) {
+        ILI9341_RecordOp(ili9341, op, data, dataSize, data2, data2Size);
+        return true;
+    }
+
+    const ILI9341_ClipStack* clip = ili9341->clip;
+    if (clip->depth == 0) return false;
+
+    // trivial reject, primitives partly inside are clipped per address window
+    const ILI9341_Rect* rect = &clip->rects[clip->depth - 1];
+    ILI9341_DisplayOp bounded = *op;
+    ILI9341_ComputeOpBounds(ili9341, &bounded, data, data2);
+
+    return bounded.x1 < rect->x0 || bounded.x0 > rect->x1 || bounded.y1 < rect->y0 || bounded.y0 > rect->y1;
+}
+
 ILI9341_HandleTypeDef ILI9341_Init(
     SPI_HandleTypeDef* spi_handle,
     GPIO_TypeDef* cs_port,
@@ -357,6 +735,185 @@ void ILI9341_InvertColors(const ILI9341_HandleTypeDef* ili9341, bool invert) {
     ILI9341_Deselect(ili9341);
 }
 
+/**
+ * @brief Check if the scroll axis runs opposite to the panel scan direction in the current rotation
+ * @param ili9341 Pointer to ILI9341 handle structure
+ */
+static bool ILI9341_IsScrollFlipped(const ILI9341_HandleTypeDef* ili9341) {
+    // MADCTL_MY reverses the memory rows, which are the scan lines
+    return ili9341->rotation == ILI9341_ROTATION_VERTICAL_2 || ili9341->rotation == ILI9341_ROTATION_HORIZONTAL_1;
+}
+
+/**
+ * @brief Get the size of the scroll axis (the panel scan axis) in the current rotation
+ * @param ili9341 Pointer to ILI9341 handle structure
+ */
+static int_fast16_t ILI9341_GetScrollAxisLength(const ILI9341_HandleTypeDef* ili9341) {
+    return (ili9341->rotation == ILI9341_ROTATION_HORIZONTAL_1 || ili9341->rotation == ILI9341_ROTATION_HORIZONTAL_2)
+               ? ili9341->width
+               : ili9341->height;
+}
+
+void ILI9341_SetScrollArea(ILI9341_HandleTypeDef* ili9341, int_fast16_t start, int_fast16_t length) {
+    int_fast16_t axisLength = ILI9341_GetScrollAxisLength(ili9341);
+
+    if (start < 0) start = 0;
+    if (start >= axisLength) start = axisLength - 1;
+    if (length < 1) length = 1;
+    if (length > axisLength - start) length = axisLength - start;
+
+    // fixed areas are defined in scan order
+    uint16_t topFixed = ILI9341_IsScrollFlipped(ili9341) ? axisLength - start - length : start;
+    uint16_t bottomFixed = axisLength - topFixed - length;
+
+    ILI9341_Select(ili9341);
+
+    ILI9341_WriteCommand(ili9341, 0x33);  // VSCRDEF
+    {
+        uint8_t data[] = {
+            (topFixed >> 8) & 0xFF,
+            topFixed & 0xFF,
+            (length >> 8) & 0xFF,
+            length & 0xFF,
+            (bottomFixed >> 8) & 0xFF,
+            bottomFixed & 0xFF
+        };
+        ILI9341_WriteData(ili9341, data, sizeof(data));
+    }
+
+    ILI9341_Deselect(ili9341);
+
+    ili9341->scrollStart = start;
+    ili9341->scrollLength = length;
+    ILI9341_SetScrollOffset(ili9341, 0);
+}
+
+void ILI9341_SetScrollOffset(ILI9341_HandleTypeDef* ili9341, int_fast16_t offset) {
+    int_fast16_t length = ili9341->scrollLength;
+    if (length == 0) return;
+
+    offset %= length;
+    if (offset < 0) offset += length;
+
+    uint16_t start;
+    if (ILI9341_IsScrollFlipped(ili9341)) {
+        uint16_t topFixed = ILI9341_GetScrollAxisLength(ili9341) - ili9341->scrollStart - length;
+        start = topFixed + (length - offset) % length;
+    } else {
+        start = ili9341->scrollStart + offset;
+    }
+
+    ILI9341_Select(ili9341);
+
+    ILI9341_WriteCommand(ili9341, 0x37);  // VSCRSADD
+    {
+        uint8_t data[] = {(start >> 8) & 0xFF, start & 0xFF};
+        ILI9341_WriteData(ili9341, data, sizeof(data));
+    }
+
+    ILI9341_Deselect(ili9341);
+
+    ili9341->scrollOffset = offset;
+}
+
+int_fast16_t ILI9341_GetScrollPosition(const ILI9341_HandleTypeDef* ili9341, int_fast16_t position) {
+    int_fast16_t start = ili9341->scrollStart;
+    int_fast16_t length = ili9341->scrollLength;
+
+    if (length == 0 || position < start || position >= start + length) return position;
+
+    return start + (position - start + ili9341->scrollOffset) % length;
+}
+
+void ILI9341_ResetScroll(ILI9341_HandleTypeDef* ili9341) {
+    if (ili9341->scrollLength == 0) return;
+
+    ILI9341_SetScrollArea(ili9341, 0, ILI9341_GetScrollAxisLength(ili9341));
+
+    ILI9341_Select(ili9341);
+    ILI9341_WriteCommand(ili9341, 0x13);  // NORON
+    ILI9341_Deselect(ili9341);
+
+    ili9341->scrollStart = 0;
+    ili9341->scrollLength = 0;
+    ili9341->scrollOffset = 0;
+}
+
+void ILI9341_SetPartialArea(const ILI9341_HandleTypeDef* ili9341, int_fast16_t start, int_fast16_t end) {
+    int_fast16_t axisLength = ILI9341_GetScrollAxisLength(ili9341);
+
+    if (start < 0) start = 0;
+    if (end >= axisLength) end = axisLength - 1;
+    if (end < start) return;
+
+    // the area is defined in scan order
+    uint16_t startRow = ILI9341_IsScrollFlipped(ili9341) ? axisLength - 1 - end : start;
+    uint16_t endRow = ILI9341_IsScrollFlipped(ili9341) ? axisLength - 1 - start : end;
+
+    ILI9341_Select(ili9341);
+
+    ILI9341_WriteCommand(ili9341, 0x30);  // PTLAR
+    {
+        uint8_t data[] = {(startRow >> 8) & 0xFF, startRow & 0xFF, (endRow >> 8) & 0xFF, endRow & 0xFF};
+        ILI9341_WriteData(ili9341, data, sizeof(data));
+    }
+
+    ILI9341_Deselect(ili9341);
+}
+
+void ILI9341_SetPartialMode(ILI9341_HandleTypeDef* ili9341, bool partial) {
+    ILI9341_Select(ili9341);
+    ILI9341_WriteCommand(ili9341, partial ? 0x12 /* PTLON */ : 0x13 /* NORON */);
+    ILI9341_Deselect(ili9341);
+
+    // both commands leave scroll mode, so restore it
+    if (ili9341->scrollLength != 0) {
+        int_fast16_t offset = ili9341->scrollOffset;
+        ILI9341_SetScrollArea(ili9341, ili9341->scrollStart, ili9341->scrollLength);
+        ILI9341_SetScrollOffset(ili9341, offset);
+    }
+}
+
+void ILI9341_SetIdleMode(const ILI9341_HandleTypeDef* ili9341, bool idle) {
+    ILI9341_Select(ili9341);
+    ILI9341_WriteCommand(ili9341, idle ? 0x39 /* IDMON */ : 0x38 /* IDMOFF */);
+    ILI9341_Deselect(ili9341);
+}
+
+void ILI9341_SetDisplayOn(const ILI9341_HandleTypeDef* ili9341, bool on) {
+    ILI9341_Select(ili9341);
+    ILI9341_WriteCommand(ili9341, on ? 0x29 /* DISPON */ : 0x28 /* DISPOFF */);
+    ILI9341_Deselect(ili9341);
+}
+
+bool ILI9341_PushClip(
+    const ILI9341_HandleTypeDef* ili9341,
+    int_fast16_t x,
+    int_fast16_t y,
+    int_fast16_t w,
+    int_fast16_t h
+) {
+    ILI9341_ClipStack* clip = ili9341->clip;
+    if (!clip || clip->depth >= ILI9341_CLIP_STACK_DEPTH) return false;
+
+    // the new rectangle is confined to the current one, the display at the bottom of the stack
+    ILI9341_Rect bottom = {.x0 = 0, .y0 = 0, .x1 = ili9341->width - 1, .y1 = ili9341->height - 1};
+    const ILI9341_Rect* current = clip->depth > 0 ? &clip->rects[clip->depth - 1] : &bottom;
+
+    clip->rects[clip->depth++] = (ILI9341_Rect){
+        .x0 = x > current->x0 ? x : current->x0,
+        .y0 = y > current->y0 ? y : current->y0,
+        .x1 = x + w - 1 < current->x1 ? x + w - 1 : current->x1,
+        .y1 = y + h - 1 < current->y1 ? y + h - 1 : current->y1
+    };
+
+    return true;
+}
+
+void ILI9341_PopClip(const ILI9341_HandleTypeDef* ili9341) {
+    if (ili9341->clip && ili9341->clip->depth > 0) ili9341->clip->depth--;
+}
+
 /**
  * @brief Set the address window for subsequent pixel data
  * @param ili9341 Pointer to ILI9341 handle structure
@@ -372,6 +929,45 @@ static void ILI9341_SetAddressWindow(
     uint16_t x1,
     uint16_t y1
 ) {
+    if (ili9341->clip && ili9341->clip->depth > 0) {
+        ILI9341_ClipStack* clip = ili9341->clip;
+        const ILI9341_Rect* rect = &clip->rects[clip->depth - 1];
+
+        // trivial accept, a window inside the clip rectangle is written as is
+        clip->filtering = x0 < rect->x0 || x1 > rect->x1 || y0 < rect->y0 || y1 > rect->y1;
+        if (clip->filtering) {
+            clip->windowX0 = x0;
+            clip->windowX1 = x1;
+            clip->cursorX = x0;
+            clip->cursorY = y0;
+            clip->visible = (ILI9341_Rect){
+                .x0 = x0 > rect->x0 ? x0 : rect->x0,
+                .y0 = y0 > rect->y0 ? y0 : rect->y0,
+                .x1 = x1 < rect->x1 ? x1 : rect->x1,
+                .y1 = y1 < rect->y1 ? y1 : rect->y1
+            };
+
+            // all the pixels will be dropped
+            if (clip->visible.x0 > clip->visible.x1 || clip->visible.y0 > clip->visible.y1) return;
+
+            x0 = clip->visible.x0;
+            y0 = clip->visible.y0;
+            x1 = clip->visible.x1;
+            y1 = clip->visible.y1;
+        }
+    } else if (ili9341->clip) {
+        ili9341->clip->filtering = false;
+    }
+
+    if (ili9341->surface) {
+        ILI9341_Surface* surface = ili9341->surface;
+        surface->windowX0 = x0;
+        surface->windowX1 = x1;
+        surface->cursorX = x0;
+        surface->cursorY = y0;
+        return;
+    }
+
     // column address set
     ILI9341_WriteCommand(ili9341, 0x2A);  // CASET
     {
@@ -406,11 +1002,16 @@ static void ILI9341_DrawPixelFast(
     if (x < 0 || y < 0 || x >= ili9341->width || y >= ili9341->height) return;
 
     ILI9341_SetAddressWindow(ili9341, x, y, x + 1, y + 1);
-    uint8_t data[] = {color >> 8, color & 0xFF};
-    ILI9341_WriteData(ili9341, data, sizeof(data));
+    uint16_t pixel = (color >> 8) | (color << 8);
+    ILI9341_WritePixels(ili9341, &pixel, 1);
 }
 
 void ILI9341_DrawPixel(const ILI9341_HandleTypeDef* ili9341, int_fast16_t x, int_fast16_t y, uint16_t color) {
+    if (ili9341->displayList || ili9341->clip) {
+        const ILI9341_DisplayOp op = {.type = ILI9341_OP_PIXEL, .args = {x, y}, .color = color};
+        if (ILI9341_InterceptOp(ili9341, &op, NULL, 0, NULL, 0)) return;
+    }
+
     ILI9341_Select(ili9341);
     ILI9341_DrawPixelFast(ili9341, x, y, color);
     ILI9341_Deselect(ili9341);
@@ -470,66 +1071,99 @@ static void ILI9341_FillRectangleFast(
     ILI9341_SetAddressWindow(ili9341, x, y, x + w - 1, y + h - 1);
 
     while (totalSize > 0) {
-        ILI9341_WriteData(ili9341, (uint8_t*)buffer, chunkSize * 2);
+        ILI9341_WritePixels(ili9341, buffer, chunkSize);
         totalSize -= chunkSize;
         chunkSize = totalSize > ILI9341_FILL_RECT_BUFFER_SIZE ? ILI9341_FILL_RECT_BUFFER_SIZE : totalSize;
     }
 }
 
-void ILI9341_FillRectangle(
+void ILI9341_StartTransfer(
     const ILI9341_HandleTypeDef* ili9341,
-    int_fast16_t x,
-    int_fast16_t y,
-    int_fast16_t w,
-    int_fast16_t h,
-    uint16_t color
+    int_fast16_t x0,
+    int_fast16_t y0,
+    int_fast16_t x1,
+    int_fast16_t y1,
+    const uint16_t* data
 ) {
+    size_t size = (x1 - x0 + 1) * (y1 - y0 + 1) * sizeof(uint16_t);
+
     ILI9341_Select(ili9341);
-    ILI9341_FillRectangleFast(ili9341, x, y, w, h, color);
-    ILI9341_Deselect(ili9341);
+    ILI9341_SetAddressWindow(ili9341, x0, y0, x1, y1);
+
+    if (ili9341->surface || (ili9341->clip && ili9341->clip->filtering) || ili9341->spi_handle->hdmatx == NULL ||
+        size > UINT16_MAX) {
+        ILI9341_WritePixels(ili9341, data, size / sizeof(uint16_t));
+        return;
+    }
+
+    HAL_GPIO_WritePin(ili9341->dc_port, ili9341->dc_pin, GPIO_PIN_SET);
+    HAL_SPI_Transmit_DMA(ili9341->spi_handle, (uint8_t*)data, size);
 }
 
-void ILI9341_FillScreen(const ILI9341_HandleTypeDef* ili9341, uint16_t color) {
-    ILI9341_Select(ili9341);
-    ILI9341_FillRectangleFast(ili9341, 0, 0, ili9341->width, ili9341->height, color);
+void ILI9341_WaitTransfer(const ILI9341_HandleTypeDef* ili9341) {
+    if (ili9341->surface) return;
+
+    while (HAL_SPI_GetState(ili9341->spi_handle) != HAL_SPI_STATE_READY) {}
     ILI9341_Deselect(ili9341);
 }
 
+const uint16_t* ILI9341_GetBlendPalette(uint16_t color, uint16_t bgColor, uint_fast8_t bpp) {
+    static uint16_t palette[16];
+    static uint16_t paletteColor;
+    static uint16_t paletteBgColor;
+    static uint_fast8_t paletteBpp = 0;
+
+    if (paletteBpp == bpp && paletteColor == color && paletteBgColor == bgColor) return palette;
+
+    int_fast16_t maxLevel = (1 << bpp) - 1;
+    int_fast16_t r = color >> 11, g = (color >> 5) & 0x3F, b = color & 0x1F;
+    int_fast16_t bgR = bgColor >> 11, bgG = (bgColor >> 5) & 0x3F, bgB = bgColor & 0x1F;
+
+    for (int_fast16_t level = 0; level <= maxLevel; level++) {
+        uint16_t blended = ((bgR + ((r - bgR) * level + maxLevel / 2) / maxLevel) << 11) |
+                           ((bgG + ((g - bgG) * level + maxLevel / 2) / maxLevel) << 5) |
+                           (bgB + ((b - bgB) * level + maxLevel / 2) / maxLevel);
+        palette[level] = (blended >> 8) | (blended << 8);
+    }
+
+    paletteColor = color;
+    paletteBgColor = bgColor;
+    paletteBpp = bpp;
+
+    return palette;
+}
+
 /**
- * @brief Draw a glyph at specified coordinates without selecting/deselecting the display
+ * @brief Draw an anti-aliased (2bpp or 4bpp) glyph without selecting/deselecting the display
  * @param ili9341 Pointer to ILI9341 handle structure
- * @param x X coordinate of the left of the character
- * @param y Y coordinate of the baseline of the character
+ * @param startX X coordinate of the left of the glyph bounding box
+ * @param startY Y coordinate of the top of the glyph bounding box
+ * @param clipStartX First visible column of the scaled glyph
+ * @param clipStartY First visible row of the scaled glyph
+ * @param clipEndX Last visible column of the scaled glyph
+ * @param clipEndY Last visible row of the scaled glyph
  * @param glyph Glyph to render
  * @param color 16-bit character color in RGB565 format
  * @param bgColor 16-bit background color in RGB565 format
  * @param scale Scaling factor (integer) to enlarge the character
  */
-static void ILI9341_DrawGlyphFast(
+static void ILI9341_DrawGlyphAAFast(
     const ILI9341_HandleTypeDef* ili9341,
-    int_fast16_t x,
-    int_fast16_t y,
+    int_fast16_t startX,
+    int_fast16_t startY,
+    int_fast16_t clipStartX,
+    int_fast16_t clipStartY,
+    int_fast16_t clipEndX,
+    int_fast16_t clipEndY,
     ILI9341_GlyphDef glyph,
     uint16_t color,
     uint16_t bgColor,
     int_fast16_t scale
 ) {
-    int_fast16_t startX = x + glyph.bbX * scale;
-    int_fast16_t startY = y - glyph.bbY * scale - glyph.bbH * scale + 1;
-    int_fast16_t endX = startX + glyph.bbW * scale - 1;
-    int_fast16_t endY = startY + glyph.bbH * scale - 1;
-
-    if (endX < 0 || endY < 0 || startX >= ili9341->width || startY >= ili9341->height ||
-        (glyph.bbW == 0 || glyph.bbH == 0))
-        return;
-
-    int_fast16_t clipStartX = startX < 0 ? -startX : 0;
-    int_fast16_t clipStartY = startY < 0 ? -startY : 0;
-    int_fast16_t clipEndX = endX >= ili9341->width ? ili9341->width - startX - 1 : glyph.bbW * scale - 1;
-    int_fast16_t clipEndY = endY >= ili9341->height ? ili9341->height - startY - 1 : glyph.bbH * scale - 1;
-
-    color = (color >> 8) | (color << 8);
-    bgColor = (bgColor >> 8) | (bgColor << 8);
+    const uint16_t* palette = ILI9341_GetBlendPalette(color, bgColor, glyph.bpp);
+    const uint_fast8_t pixelsPerByteShift = glyph.bpp == 2 ? 2 : 1;
+    const uint_fast8_t pixelInByteMask = (1 << pixelsPerByteShift) - 1;
+    const uint_fast8_t levelMask = (1 << glyph.bpp) - 1;
 
     uint16_t buffer[ILI9341_DRAW_GLYPH_BUFFER_SIZE];
     size_t bufferIndex = 0;
@@ -537,25 +1171,119 @@ static void ILI9341_DrawGlyphFast(
     ILI9341_SetAddressWindow(ili9341, startX + clipStartX, startY + clipStartY, startX + clipEndX, startY + clipEndY);
 
     for (int_fast16_t row = clipStartY; row <= clipEndY; row++) {
+        int_fast32_t rowIndex = row / scale * glyph.bbW;
+
         for (int_fast16_t col = clipStartX; col <= clipEndX; col++) {
-            int_fast32_t bitIndex = row / scale * glyph.bbW + col / scale;
-            uint8_t mask = 0x80 >> (bitIndex % 8);
-            int_fast16_t index = bitIndex / 8;
+            int_fast32_t pixelIndex = rowIndex + col / scale;
+            uint_fast8_t shift = 8 - glyph.bpp * ((pixelIndex & pixelInByteMask) + 1);
 
-            if (glyph.data[index] & mask) {
-                buffer[bufferIndex++] = color;
-            } else {
+            buffer[bufferIndex++] = palette[(glyph.data[pixelIndex >> pixelsPerByteShift] >> shift) & levelMask];
+
+            if (bufferIndex >= ILI9341_DRAW_GLYPH_BUFFER_SIZE) {
+                ILI9341_WritePixels(ili9341, buffer, bufferIndex);
+                bufferIndex = 0;
+            }
+        }
+    }
+
+    if (bufferIndex > 0) { ILI9341_WritePixels(ili9341, buffer, bufferIndex); }
+}
+
+/**
+ * @brief Draw a glyph at specified coordinates without selecting/deselecting the display
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @param x X coordinate of the left of the character
+ * @param y Y coordinate of the baseline of the character
+ * @param glyph Glyph to render
+ * @param color 16-bit character color in RGB565 format
+ * @param bgColor 16-bit background color in RGB565 format
+ * @param scale Scaling factor (integer) to enlarge the character
+ */
+static void ILI9341_DrawGlyphFast(
+    const ILI9341_HandleTypeDef* ili9341,
+    int_fast16_t x,
+    int_fast16_t y,
+    ILI9341_GlyphDef glyph,
+    uint16_t color,
+    uint16_t bgColor,
+    int_fast16_t scale
+) {
+    int_fast16_t startX = x + glyph.bbX * scale;
+    int_fast16_t startY = y - glyph.bbY * scale - glyph.bbH * scale + 1;
+    int_fast16_t endX = startX + glyph.bbW * scale - 1;
+    int_fast16_t endY = startY + glyph.bbH * scale - 1;
+
+    if (endX < 0 || endY < 0 || startX >= ili9341->width || startY >= ili9341->height ||
+        (glyph.bbW == 0 || glyph.bbH == 0))
+        return;
+
+    int_fast16_t clipStartX = startX < 0 ? -startX : 0;
+    int_fast16_t clipStartY = startY < 0 ? -startY : 0;
+    int_fast16_t clipEndX = endX >= ili9341->width ? ili9341->width - startX - 1 : glyph.bbW * scale - 1;
+    int_fast16_t clipEndY = endY >= ili9341->height ? ili9341->height - startY - 1 : glyph.bbH * scale - 1;
+
+    if (glyph.bpp > 1) {
+        ILI9341_DrawGlyphAAFast(
+            ili9341, startX, startY, clipStartX, clipStartY, clipEndX, clipEndY, glyph, color, bgColor, scale
+        );
+        return;
+    }
+
+    color = (color >> 8) | (color << 8);
+    bgColor = (bgColor >> 8) | (bgColor << 8);
+
+    uint16_t buffer[ILI9341_DRAW_GLYPH_BUFFER_SIZE];
+    size_t bufferIndex = 0;
+
+    ILI9341_SetAddressWindow(ili9341, startX + clipStartX, startY + clipStartY, startX + clipEndX, startY + clipEndY);
+
+    for (int_fast16_t row = clipStartY; row <= clipEndY; row++) {
+        for (int_fast16_t col = clipStartX; col <= clipEndX; col++) {
+            int_fast32_t bitIndex = row / scale * glyph.bbW + col / scale;
+            uint8_t mask = 0x80 >> (bitIndex % 8);
+            int_fast16_t index = bitIndex / 8;
+
+            if (glyph.data[index] & mask) {
+                buffer[bufferIndex++] = color;
+            } else {
                 buffer[bufferIndex++] = bgColor;
             }
 
             if (bufferIndex >= ILI9341_DRAW_GLYPH_BUFFER_SIZE) {
-                ILI9341_WriteData(ili9341, (uint8_t*)buffer, bufferIndex * 2);
+                ILI9341_WritePixels(ili9341, buffer, bufferIndex);
                 bufferIndex = 0;
             }
         }
     }
 
-    if (bufferIndex > 0) { ILI9341_WriteData(ili9341, (uint8_t*)buffer, bufferIndex * 2); }
+    if (bufferIndex > 0) { ILI9341_WritePixels(ili9341, buffer, bufferIndex); }
+}
+
+void ILI9341_DrawGlyph(
+    const ILI9341_HandleTypeDef* ili9341,
+    int_fast16_t x,
+    int_fast16_t y,
+    const ILI9341_GlyphDef* glyph,
+    uint16_t color,
+    uint16_t bgColor,
+    int_fast16_t scale
+) {
+    if (ili9341->displayList || ili9341->clip) {
+        const ILI9341_DisplayOp op = {
+            .type = ILI9341_OP_GLYPH,
+            .args = {x, y, scale},
+            .color = color,
+            .bgColor = bgColor,
+            .data = glyph
+        };
+        if (ILI9341_InterceptOp(ili9341, &op, NULL, 0, NULL, 0)) return;
+    }
+
+    if (scale < 1) return;
+
+    ILI9341_Select(ili9341);
+    ILI9341_DrawGlyphFast(ili9341, x, y, *glyph, color, bgColor, scale);
+    ILI9341_Deselect(ili9341);
 }
 
 void ILI9341_WriteString(
@@ -571,6 +1299,23 @@ void ILI9341_WriteString(
     int_fast16_t tracking,
     int_fast16_t leading
 ) {
+    if (ili9341->displayList || ili9341->clip) {
+        const ILI9341_DisplayOp op = {
+            .type = ILI9341_OP_STRING,
+            .flags = wrap,
+            .args = {x, y, scale, tracking, leading},
+            .color = color,
+            .bgColor = bgColor,
+            .data = font.glyphs,
+            .fontStartCodepoint = font.startCodepoint,
+            .fontEndCodepoint = font.endCodepoint,
+            .fontAverageWidth = font.averageWidth,
+            .fontAscent = font.ascent,
+            .fontDescent = font.descent
+        };
+        if (ILI9341_InterceptOp(ili9341, &op, str, strlen(str) + 1, NULL, 0)) return;
+    }
+
     if (scale < 1 || y + font.descent * scale < 0 || y - font.ascent * scale >= ili9341->height) return;
 
     int_fast16_t originalX = x;
@@ -606,174 +1351,1446 @@ void ILI9341_WriteString(
         ILI9341_DrawGlyphFast(ili9341, x, y, glyph, color, bgColor, scale);
         x += glyph.advance * scale;
 
-        c = *str;
-        if (c < font.startCodepoint || c > font.endCodepoint) { c = FALLBACK_CODEPOINT; }
+        c = *str;
+        if (c < font.startCodepoint || c > font.endCodepoint) { c = FALLBACK_CODEPOINT; }
+
+        // Only apply tracking if next char is not zero-width, help diacritics stay aligned
+        if (tracking) {
+            ILI9341_GlyphDef glyph = font.glyphs[c - font.startCodepoint];
+            x += glyph.advance > 0 ? tracking : 0;
+        }
+    }
+
+    ILI9341_Deselect(ili9341);
+}
+
+/**
+ * @brief Write a scaled character with transparent background at specified coordinates without selecting/deselecting
+ * the display
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @param x X coordinate of the left of the character
+ * @param y Y coordinate of the baseline of the character
+ * @param ch ASCII character to write
+ * @param font Font definition to use for rendering the character
+ * @param color 16-bit character color in RGB565 format
+ * @param scale Scaling factor (integer) to enlarge the character
+ */
+static void ILI9341_DrawGlyphTransparentFast(
+    const ILI9341_HandleTypeDef* ili9341,
+    int_fast16_t x,
+    int_fast16_t y,
+    ILI9341_GlyphDef glyph,
+    uint16_t color,
+    int_fast16_t scale
+) {
+    int_fast16_t startX = x + glyph.bbX * scale;
+    int_fast16_t startY = y - glyph.bbY * scale - glyph.bbH * scale + 1;
+    int_fast16_t endX = startX + glyph.bbW * scale - 1;
+    int_fast16_t endY = startY + glyph.bbH * scale - 1;
+
+    if (endX < 0 || endY < 0 || startX >= ili9341->width || startY >= ili9341->height ||
+        (glyph.bbW == 0 || glyph.bbH == 0))
+        return;
+
+    if (glyph.bpp > 1) {
+        // there is no background to blend with, so anti-aliased coverage is thresholded at half
+        const uint_fast8_t pixelsPerByteShift = glyph.bpp == 2 ? 2 : 1;
+        const uint_fast8_t pixelInByteMask = (1 << pixelsPerByteShift) - 1;
+        const uint_fast8_t levelMask = (1 << glyph.bpp) - 1;
+
+        for (int_fast16_t row = 0; row < glyph.bbH; row++) {
+            for (int_fast16_t col = 0; col < glyph.bbW; col++) {
+                int_fast32_t pixelIndex = row * glyph.bbW + col;
+                uint_fast8_t shift = 8 - glyph.bpp * ((pixelIndex & pixelInByteMask) + 1);
+                uint_fast8_t level = (glyph.data[pixelIndex >> pixelsPerByteShift] >> shift) & levelMask;
+
+                if (level > levelMask / 2) {
+                    ILI9341_FillRectangleFast(ili9341, startX + col * scale, startY + row * scale, scale, scale, color);
+                }
+            }
+        }
+        return;
+    }
+
+    int_fast16_t index = 0;
+    uint8_t mask = 0x80;
+
+    for (int_fast16_t row = 0; row < glyph.bbH; row++) {
+        for (int_fast16_t col = 0; col < glyph.bbW; col++) {
+            if (glyph.data[index] & mask) {
+                ILI9341_FillRectangleFast(ili9341, startX + col * scale, startY + row * scale, scale, scale, color);
+            }
+            mask >>= 1;
+            if (mask == 0) {
+                index++;
+                mask = 0x80;
+            }
+        }
+    }
+}
+
+void ILI9341_WriteStringTransparent(
+    const ILI9341_HandleTypeDef* ili9341,
+    int_fast16_t x,
+    int_fast16_t y,
+    const char* str,
+    ILI9341_FontDef font,
+    uint16_t color,
+    bool wrap,
+    int_fast16_t scale,
+    int_fast16_t tracking,
+    int_fast16_t leading
+) {
+    if (ili9341->displayList || ili9341->clip) {
+        const ILI9341_DisplayOp op = {
+            .type = ILI9341_OP_STRING_TRANSPARENT,
+            .flags = wrap,
+            .args = {x, y, scale, tracking, leading},
+            .color = color,
+            .data = font.glyphs,
+            .fontStartCodepoint = font.startCodepoint,
+            .fontEndCodepoint = font.endCodepoint,
+            .fontAverageWidth = font.averageWidth,
+            .fontAscent = font.ascent,
+            .fontDescent = font.descent
+        };
+        if (ILI9341_InterceptOp(ili9341, &op, str, strlen(str) + 1, NULL, 0)) return;
+    }
+
+    if (scale < 1 || y + font.descent * scale < 0 || y - font.ascent * scale >= ili9341->height) return;
+
+    int_fast16_t originalX = x;
+
+    ILI9341_Select(ili9341);
+
+    for (unsigned char c; (c = *(str++));) {
+        if (c == '\r') {
+            x = originalX;
+            continue;
+        }
+
+        if (c == '\n') {
+            y += (font.ascent + font.descent) * scale + leading;
+            x = originalX;
+            if (y - font.ascent * scale >= ili9341->height) break;
+            continue;
+        }
+
+        if (c < font.startCodepoint || c > font.endCodepoint) { c = FALLBACK_CODEPOINT; }
+        ILI9341_GlyphDef glyph = font.glyphs[c - font.startCodepoint];
+
+        // Only wrap if current char is not zero-width, help prevent newline on diacritics
+        if (wrap && glyph.advance > 0 && x + (glyph.bbX + glyph.bbW) * scale + 1 >= ili9341->width) {
+            y += (font.ascent + font.descent) * scale + leading;
+            x = originalX;
+            if (y - font.ascent * scale >= ili9341->height) break;
+            if (c == 0x20 || c == 0xA0) {  // Ignore space and nbsp after newline
+                continue;
+            }
+        }
+
+        ILI9341_DrawGlyphTransparentFast(ili9341, x, y, glyph, color, scale);
+        x += glyph.advance * scale;
+
+        c = *str;
+        if (c < font.startCodepoint || c > font.endCodepoint) { c = FALLBACK_CODEPOINT; }
+
+        // Only apply tracking if next char is not zero-width, help diacritics stay aligned
+        if (tracking) {
+            ILI9341_GlyphDef glyph = font.glyphs[c - font.startCodepoint];
+            x += glyph.advance > 0 ? tracking : 0;
+        }
+    }
+
+    ILI9341_Deselect(ili9341);
+}
+
+/**
+ * @brief Get the glyph of a character, out of range characters map to the fallback glyph
+ * @param font Font definition
+ * @param c Character
+ */
+static ILI9341_GlyphDef ILI9341_GetGlyph(ILI9341_FontDef font, unsigned char c) {
+    if (c < font.startCodepoint || c > font.endCodepoint) { c = FALLBACK_CODEPOINT; }
+    return font.glyphs[c - font.startCodepoint];
+}
+
+/**
+ * @brief Measure a single line of text the way ILI9341_WriteString advances over it
+ * @param str Pointer to the first character of the line
+ * @param length Number of characters in the line
+ * @param font Font definition
+ * @param scale Integer scaling factor
+ * @param tracking Additional space in pixels between characters
+ * @return Line bounding box, y and height are left 0
+ */
+static ILI9341_TextBounds ILI9341_MeasureLine(
+    const char* str,
+    size_t length,
+    ILI9341_FontDef font,
+    int_fast16_t scale,
+    int_fast16_t tracking
+) {
+    ILI9341_TextBounds bounds = {0, 0, 0, 0, 0};
+    int_fast16_t left = INT16_MAX, right = INT16_MIN;
+    int_fast16_t x = 0;
+
+    for (size_t i = 0; i < length; i++) {
+        ILI9341_GlyphDef glyph = ILI9341_GetGlyph(font, str[i]);
+
+        if (glyph.bbW > 0) {
+            if (x + glyph.bbX * scale < left) left = x + glyph.bbX * scale;
+            if (x + (glyph.bbX + glyph.bbW) * scale > right) right = x + (glyph.bbX + glyph.bbW) * scale;
+        }
+
+        x += glyph.advance * scale;
+        bounds.advance = x;
+
+        // same rule as ILI9341_WriteString, tracking only before characters that are not zero-width
+        if (tracking && i + 1 < length && ILI9341_GetGlyph(font, str[i + 1]).advance > 0) x += tracking;
+    }
+
+    if (left <= right) {
+        bounds.x = left;
+        bounds.width = right - left;
+    }
+
+    return bounds;
+}
+
+/**
+ * @brief Compute a word-wrapped layout without the cache
+ */
+static void ILI9341_ComputeLayout(
+    ILI9341_TextLayout* layout,
+    const char* str,
+    ILI9341_FontDef font,
+    int_fast16_t scale,
+    int_fast16_t tracking,
+    int_fast16_t leading,
+    int_fast16_t maxWidth
+) {
+    int_fast16_t lineHeight = (font.ascent + font.descent) * scale + leading;
+    int_fast16_t left = INT16_MAX, right = INT16_MIN;
+    size_t pos = 0;
+
+    layout->lineCount = 0;
+    layout->bounds.advance = 0;
+
+    while (str[pos] && layout->lineCount < ILI9341_LAYOUT_MAX_LINES) {
+        size_t start = pos, end, next;
+        size_t breakEnd = 0, breakNext = 0;
+        int_fast16_t x = 0;
+        size_t i = start;
+
+        for (; str[i] && str[i] != '\n'; i++) {
+            ILI9341_GlyphDef glyph = ILI9341_GetGlyph(font, str[i]);
+
+            if (maxWidth > 0 && i > start && glyph.advance > 0 && x + (glyph.bbX + glyph.bbW) * scale > maxWidth) break;
+
+            x += glyph.advance * scale;
+            if (tracking && str[i + 1] && ILI9341_GetGlyph(font, str[i + 1]).advance > 0) x += tracking;
+
+            if (str[i] == ' ') {
+                if (i > start) breakEnd = i;
+                breakNext = i + 1;
+            }
+        }
+
+        if (!str[i] || str[i] == '\n') {
+            end = i;
+            next = str[i] ? i + 1 : i;
+        } else if (breakNext > start) {
+            end = breakEnd > start ? breakEnd : start;
+            next = breakNext;
+        } else {
+            end = i;
+            next = i;
+        }
+
+        // trailing spaces are not part of the line, leading spaces of a wrapped line are skipped
+        while (end > start && str[end - 1] == ' ') end--;
+        if (next > start && str[next - 1] != '\n') {
+            while (str[next] == ' ') next++;
+        }
+
+        ILI9341_TextBounds line = ILI9341_MeasureLine(&str[start], end - start, font, scale, tracking);
+        line.y = -font.ascent * scale;
+        line.height = (font.ascent + font.descent) * scale;
+
+        layout->lineStart[layout->lineCount] = start;
+        layout->lineLength[layout->lineCount] = end - start;
+        layout->lineBounds[layout->lineCount] = line;
+        layout->lineCount++;
+
+        if (line.width > 0) {
+            if (line.x < left) left = line.x;
+            if (line.x + line.width > right) right = line.x + line.width;
+        }
+        if (line.advance > layout->bounds.advance) layout->bounds.advance = line.advance;
+
+        pos = next;
+    }
+
+    layout->bounds.x = left <= right ? left : 0;
+    layout->bounds.width = left <= right ? right - left : 0;
+    layout->bounds.y = -font.ascent * scale;
+    layout->bounds.height = layout->lineCount > 0 ? layout->lineCount * lineHeight - leading : 0;
+}
+
+ILI9341_TextLayout ILI9341_LayoutString(
+    const char* str,
+    ILI9341_FontDef font,
+    int_fast16_t scale,
+    int_fast16_t tracking,
+    int_fast16_t leading,
+    int_fast16_t maxWidth
+) {
+    static struct {
+        const char* str;
+        uint32_t hash;
+        const ILI9341_GlyphDef* glyphs;
+        int_fast16_t averageWidth;
+        int_fast8_t ascent;
+        int_fast8_t descent;
+        int_fast16_t scale;
+        int_fast16_t tracking;
+        int_fast16_t leading;
+        int_fast16_t maxWidth;
+        ILI9341_TextLayout layout;
+    } cache[ILI9341_LAYOUT_CACHE_SIZE];
+    static size_t cacheNext = 0;
+
+    if (scale < 1) scale = 1;
+
+    // FNV-1a, the pointer alone is not enough since buffers get reused with different content
+    uint32_t hash = 2166136261u;
+    for (const char* c = str; *c; c++) { hash = (hash ^ (unsigned char)*c) * 16777619u; }
+
+    // SDF fonts at other heights reuse the glyph array of an evicted slot, so the metrics are part of the key
+    for (size_t i = 0; i < ILI9341_LAYOUT_CACHE_SIZE; i++) {
+        if (cache[i].str == str && cache[i].hash == hash && cache[i].glyphs == font.glyphs &&
+            cache[i].averageWidth == font.averageWidth && cache[i].ascent == font.ascent &&
+            cache[i].descent == font.descent && cache[i].scale == scale && cache[i].tracking == tracking &&
+            cache[i].leading == leading && cache[i].maxWidth == maxWidth) {
+            return cache[i].layout;
+        }
+    }
+
+    size_t i = cacheNext;
+    cacheNext = (cacheNext + 1) % ILI9341_LAYOUT_CACHE_SIZE;
+
+    cache[i].str = str;
+    cache[i].hash = hash;
+    cache[i].glyphs = font.glyphs;
+    cache[i].averageWidth = font.averageWidth;
+    cache[i].ascent = font.ascent;
+    cache[i].descent = font.descent;
+    cache[i].scale = scale;
+    cache[i].tracking = tracking;
+    cache[i].leading = leading;
+    cache[i].maxWidth = maxWidth;
+    ILI9341_ComputeLayout(&cache[i].layout, str, font, scale, tracking, leading, maxWidth);
+
+    return cache[i].layout;
+}
+
+ILI9341_TextBounds ILI9341_MeasureString(
+    const char* str,
+    ILI9341_FontDef font,
+    int_fast16_t scale,
+    int_fast16_t tracking,
+    int_fast16_t leading
+) {
+    return ILI9341_LayoutString(str, font, scale, tracking, leading, 0).bounds;
+}
+
+void ILI9341_WriteStringLayout(
+    const ILI9341_HandleTypeDef* ili9341,
+    int_fast16_t x,
+    int_fast16_t y,
+    const char* str,
+    const ILI9341_TextLayout* layout,
+    ILI9341_FontDef font,
+    uint16_t color,
+    uint16_t bgcolor,
+    int_fast16_t scale,
+    int_fast16_t tracking,
+    int_fast16_t leading,
+    uint_fast8_t align
+) {
+    char line[ILI9341_LAYOUT_MAX_LINE_LENGTH + 1];
+    int_fast16_t lineHeight = (font.ascent + font.descent) * scale + leading;
+
+    for (uint_fast8_t i = 0; i < layout->lineCount; i++) {
+        size_t length = layout->lineLength[i];
+        if (length > ILI9341_LAYOUT_MAX_LINE_LENGTH) length = ILI9341_LAYOUT_MAX_LINE_LENGTH;
+
+        for (size_t j = 0; j < length; j++) { line[j] = str[layout->lineStart[i] + j]; }
+        line[length] = '\0';
+
+        // align the drawn pixels of the line inside the drawn pixels of the block
+        const ILI9341_TextBounds* bounds = &layout->lineBounds[i];
+        int_fast16_t lineX = x;
+        if (align == ILI9341_ALIGN_CENTER) {
+            lineX += layout->bounds.x + (layout->bounds.width - bounds->width) / 2 - bounds->x;
+        } else if (align == ILI9341_ALIGN_RIGHT) {
+            lineX += layout->bounds.x + layout->bounds.width - bounds->width - bounds->x;
+        }
+
+        ILI9341_WriteString(
+            ili9341, lineX, y + i * lineHeight, line, font, color, bgcolor, false, scale, tracking, leading
+        );
+    }
+}
+
+/**
+ * @brief Normalize the position of an image given with negative sizes and find the part of it inside the display
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @param x X coordinate of the image, set to the left edge
+ * @param y Y coordinate of the image, set to the top edge
+ * @param w Width of the image, set to the absolute width
+ * @param h Height of the image, set to the absolute height
+ * @param visible Set to the visible part, in image coordinates
+ * @return false if no part of the image is visible
+ */
+static bool ILI9341_ClipImage(
+    const ILI9341_HandleTypeDef* ili9341,
+    int_fast16_t* x,
+    int_fast16_t* y,
+    int_fast16_t* w,
+    int_fast16_t* h,
+    ILI9341_Rect* visible
+) {
+    if (*w == 0 || *h == 0) return false;
+    if (*w < 0) {
+        *w = -*w;
+        *x -= *w - 1;
+    }
+    if (*h < 0) {
+        *h = -*h;
+        *y -= *h - 1;
+    }
+    if (*x >= ili9341->width || *y >= ili9341->height || *x + *w <= 0 || *y + *h <= 0) return false;
+
+    visible->x0 = *x < 0 ? -*x : 0;
+    visible->y0 = *y < 0 ? -*y : 0;
+    visible->x1 = *x + *w - 1 >= ili9341->width ? ili9341->width - *x - 1 : *w - 1;
+    visible->y1 = *y + *h - 1 >= ili9341->height ? ili9341->height - *y - 1 : *h - 1;
+
+    return true;
+}
+
+/**
+ * @brief Narrow the visible part of an image to the clip rectangle on top of the clip stack
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @param x X coordinate of the left edge of the image
+ * @param y Y coordinate of the top edge of the image
+ * @param visible Visible part found by ILI9341_ClipImage, in image coordinates
+ * @return false if no part of the image is inside the clip rectangle
+ */
+static bool ILI9341_ClipVisible(
+    const ILI9341_HandleTypeDef* ili9341,
+    int_fast16_t x,
+    int_fast16_t y,
+    ILI9341_Rect* visible
+) {
+    if (!ili9341->clip || ili9341->clip->depth == 0) return true;
+
+    const ILI9341_Rect* rect = &ili9341->clip->rects[ili9341->clip->depth - 1];
+    if (rect->x0 - x > visible->x0) visible->x0 = rect->x0 - x;
+    if (rect->y0 - y > visible->y0) visible->y0 = rect->y0 - y;
+    if (rect->x1 - x < visible->x1) visible->x1 = rect->x1 - x;
+    if (rect->y1 - y < visible->y1) visible->y1 = rect->y1 - y;
+
+    return visible->x0 <= visible->x1 && visible->y0 <= visible->y1;
+}
+
+void ILI9341_DrawImage(
+    const ILI9341_HandleTypeDef* ili9341,
+    int_fast16_t x,
+    int_fast16_t y,
+    int_fast16_t w,
+    int_fast16_t h,
+    const uint16_t* data
+) {
+    if (ili9341->displayList || ili9341->clip) {
+        const ILI9341_DisplayOp op = {.type = ILI9341_OP_IMAGE, .args = {x, y, w, h}, .data = data};
+        if (ILI9341_InterceptOp(ili9341, &op, NULL, 0, NULL, 0)) return;
+    }
+
+    ILI9341_Rect visible;
+    if (!ILI9341_ClipImage(ili9341, &x, &y, &w, &h, &visible)) return;
+
+    ILI9341_Select(ili9341);
+
+    if (visible.x0 > 0 || visible.y0 > 0 || visible.x1 < w - 1 || visible.y1 < h - 1) {
+        int_fast16_t clipStartX = visible.x0;
+        int_fast16_t clipStartY = visible.y0;
+        int_fast16_t clipEndX = visible.x1;
+        int_fast16_t clipEndY = visible.y1;
+
+        uint16_t buffer[ILI9341_DRAW_IMAGE_BUFFER_SIZE];
+        size_t bufferIndex = 0;
+
+        ILI9341_SetAddressWindow(ili9341, x + clipStartX, y + clipStartY, x + clipEndX, y + clipEndY);
+
+        for (int_fast16_t row = clipStartY; row <= clipEndY; row++) {
+            for (int_fast16_t col = clipStartX; col <= clipEndX; col++) {
+                buffer[bufferIndex++] = data[row * w + col];
+
+                if (bufferIndex >= ILI9341_DRAW_IMAGE_BUFFER_SIZE) {
+                    ILI9341_WritePixels(ili9341, buffer, bufferIndex);
+                    bufferIndex = 0;
+                }
+            }
+        }
+
+        if (bufferIndex > 0) { ILI9341_WritePixels(ili9341, buffer, bufferIndex); }
+    } else {
+        ILI9341_SetAddressWindow(ili9341, x, y, x + w - 1, y + h - 1);
+        ILI9341_WritePixels(ili9341, data, w * h);
+    }
+
+    ILI9341_Deselect(ili9341);
+}
+
+void ILI9341_DrawImageTransparent(
+    const ILI9341_HandleTypeDef* ili9341,
+    int_fast16_t x,
+    int_fast16_t y,
+    int_fast16_t w,
+    int_fast16_t h,
+    const uint16_t* data,
+    const uint8_t* mask,
+    uint16_t colorKey
+) {
+    if (ili9341->displayList || ili9341->clip) {
+        const ILI9341_DisplayOp op = {
+            .type = ILI9341_OP_IMAGE_TRANSPARENT,
+            .args = {x, y, w, h},
+            .color = colorKey,
+            .data = data
+        };
+        if (ILI9341_InterceptOp(ili9341, &op, &mask, sizeof(mask), NULL, 0)) return;
+    }
+
+    ILI9341_Rect visible;
+    if (!ILI9341_ClipImage(ili9341, &x, &y, &w, &h, &visible)) return;
+
+    const uint16_t key = (colorKey >> 8) | (colorKey << 8);
+    const int_fast16_t stride = (w + 7) / 8;
+
+    ILI9341_Select(ili9341);
+
+    // each run of opaque pixels of a row gets its own address window
+    for (int_fast16_t row = visible.y0; row <= visible.y1; row++) {
+        const uint16_t* line = &data[row * w];
+        const uint8_t* maskLine = mask ? &mask[row * stride] : NULL;
+        int_fast16_t col = visible.x0;
+
+        while (col <= visible.x1) {
+            int_fast16_t start = col;
+            while (col <= visible.x1 &&
+                   (maskLine ? (maskLine[col >> 3] >> (7 - (col & 7))) & 1 : line[col] != key))
+                col++;
+
+            if (col > start) {
+                ILI9341_SetAddressWindow(ili9341, x + start, y + row, x + col - 1, y + row);
+                ILI9341_WritePixels(ili9341, &line[start], col - start);
+            }
+
+            while (col <= visible.x1 &&
+                   !(maskLine ? (maskLine[col >> 3] >> (7 - (col & 7))) & 1 : line[col] != key))
+                col++;
+        }
+    }
+
+    ILI9341_Deselect(ili9341);
+}
+
+// Ops of compressed images
+#define ILI9341_IMAGE_OP_INDEX 0x00
+#define ILI9341_IMAGE_OP_DIFF 0x40
+#define ILI9341_IMAGE_OP_LUMA 0x80
+#define ILI9341_IMAGE_OP_RUN 0xC0
+#define ILI9341_IMAGE_OP_COLOR 0xFE
+#define ILI9341_IMAGE_OP_LONG_RUN 0xFF
+#define ILI9341_IMAGE_MAX_RUN 62
+#define ILI9341_IMAGE_MAX_LONG_RUN 65536
+
+/**
+ * @brief State of a compressed image being decoded
+ */
+typedef struct {
+    const uint8_t* data;
+    /** End of the data, the ops are not read past it */
+    const uint8_t* end;
+    /** Previous color in RGB565 format */
+    uint16_t color;
+    /** Pixels of the previous color left to output */
+    uint_fast32_t run;
+    uint16_t index[64];
+} ILI9341_ImageDecoder;
+
+/**
+ * @brief Position of a color in the table of colors last seen
+ * @param color Color in RGB565 format
+ * @return Index in the table
+ */
+static inline uint_fast8_t ILI9341_HashImageColor(uint_fast16_t color) {
+    return ((color >> 11) * 3 + ((color >> 5) & 0x3F) * 5 + (color & 0x1F) * 7) & 0x3F;
+}
+
+/**
+ * @brief Decode the next pixels of a compressed image
+ * @param decoder Decoder state
+ * @param pixels Output pixels in RGB565 format with the 2 bytes swapped, NULL to skip the pixels
+ * @param count Number of pixels
+ * @note A truncated image goes on with the last decoded color to the end.
+ */
+static void ILI9341_DecodeImage(ILI9341_ImageDecoder* decoder, uint16_t* pixels, size_t count) {
+    const uint8_t* data = decoder->data;
+    const uint8_t* const end = decoder->end;
+    uint_fast16_t color = decoder->color;
+    uint_fast32_t run = decoder->run;
+
+    while (count > 0) {
+        // an op cut by the end of the data is dropped, the last color then fills the rest
+        if (run == 0 && data < end) {
+            const uint_fast8_t op = data[0];
+            const size_t operands =
+                op >= ILI9341_IMAGE_OP_COLOR ? 2 : (op >= ILI9341_IMAGE_OP_LUMA && op < ILI9341_IMAGE_OP_RUN);
+            if ((size_t)(end - data) <= operands) data = end;
+        }
+
+        if (run == 0 && data == end) {
+            run = count;
+        } else if (run == 0) {
+            const uint_fast8_t op = *(data++);
+            run = 1;
+
+            if (op < ILI9341_IMAGE_OP_DIFF) {
+                color = decoder->index[op];
+            } else if (op < ILI9341_IMAGE_OP_LUMA) {
+                color = ((((color >> 11) + ((op >> 4) & 3) - 2) & 0x1F) << 11) |
+                        (((((color >> 5) & 0x3F) + ((op >> 2) & 3) - 2) & 0x3F) << 5) |
+                        (((color & 0x1F) + (op & 3) - 2) & 0x1F);
+            } else if (op < ILI9341_IMAGE_OP_RUN) {
+                const uint_fast8_t next = *(data++);
+                // (g + 32) / 2 - 16 is floor(g / 2) without shifting a negative value
+                const int_fast16_t dg = (op & 0x3F) - 32, half = (op & 0x3F) / 2 - 16;
+                color = ((((color >> 11) + half + (next >> 4) - 8) & 0x1F) << 11) |
+                        (((((color >> 5) & 0x3F) + dg) & 0x3F) << 5) |
+                        (((color & 0x1F) + half + (next & 0x0F) - 8) & 0x1F);
+            } else if (op < ILI9341_IMAGE_OP_COLOR) {
+                run = op - ILI9341_IMAGE_OP_RUN + 1;
+            } else if (op == ILI9341_IMAGE_OP_COLOR) {
+                color = (data[0] << 8) | data[1];
+                data += 2;
+            } else {
+                run = ((data[0] << 8) | data[1]) + 1;
+                data += 2;
+            }
+
+            // runs repeat the previous color, already in the table
+            if (op < ILI9341_IMAGE_OP_RUN || op == ILI9341_IMAGE_OP_COLOR)
+                decoder->index[ILI9341_HashImageColor(color)] = color;
+        }
+
+        size_t n = run < count ? run : count;
+        if (pixels) {
+            const uint16_t swapped = (color >> 8) | (color << 8);
+            for (size_t i = 0; i < n; i++) pixels[i] = swapped;
+            pixels += n;
+        }
+        run -= n;
+        count -= n;
+    }
+
+    decoder->data = data;
+    decoder->color = color;
+    decoder->run = run;
+}
+
+/**
+ * @brief Send decoded pixels to the address window
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @param pixels Pixels in RGB565 format with the 2 bytes swapped, must stay unchanged until the next call with DMA
+ * @param count Number of pixels
+ * @param dma Send with DMA after the previous pixels are sent, call ILI9341_WaitTransfer after the last pixels
+ */
+static void ILI9341_StreamPixels(
+    const ILI9341_HandleTypeDef* ili9341,
+    const uint16_t* pixels,
+    size_t count,
+    bool dma
+) {
+    if (!dma) {
+        ILI9341_WritePixels(ili9341, pixels, count);
+        return;
+    }
+
+    while (HAL_SPI_GetState(ili9341->spi_handle) != HAL_SPI_STATE_READY) {}
+    HAL_GPIO_WritePin(ili9341->dc_port, ili9341->dc_pin, GPIO_PIN_SET);
+    HAL_SPI_Transmit_DMA(ili9341->spi_handle, (uint8_t*)pixels, count * sizeof(uint16_t));
+}
+
+void ILI9341_DrawImageCompressed(
+    const ILI9341_HandleTypeDef* ili9341,
+    int_fast16_t x,
+    int_fast16_t y,
+    const ILI9341_CompressedImage* image
+) {
+    if (ili9341->displayList || ili9341->clip) {
+        const ILI9341_DisplayOp op = {.type = ILI9341_OP_IMAGE_COMPRESSED, .args = {x, y}, .data = image};
+        if (ILI9341_InterceptOp(ili9341, &op, NULL, 0, NULL, 0)) return;
+    }
+
+    int_fast16_t w = image->width, h = image->height;
+    ILI9341_Rect visible;
+    if (!ILI9341_ClipImage(ili9341, &x, &y, &w, &h, &visible)) return;
+
+    // the window is narrowed to the clip rectangle, so the pixels are sent as is
+    if (!ILI9341_ClipVisible(ili9341, x, y, &visible)) return;
+
+    const int_fast16_t visibleWidth = visible.x1 - visible.x0 + 1;
+    const bool dma = !ili9341->surface && ili9341->spi_handle->hdmatx != NULL;
+    ILI9341_ImageDecoder decoder = {.data = image->data, .end = image->data + image->size, .color = 0, .run = 0};
+    memset(decoder.index, 0, sizeof(decoder.index));
+
+    // one buffer is decoded while the other is sent
+    uint16_t buffers[2][ILI9341_DRAW_IMAGE_BUFFER_SIZE];
+    uint_fast8_t current = 0;
+    size_t bufferIndex = 0;
+
+    ILI9341_Select(ili9341);
+    ILI9341_SetAddressWindow(ili9341, x + visible.x0, y + visible.y0, x + visible.x1, y + visible.y1);
+
+    ILI9341_DecodeImage(&decoder, NULL, visible.y0 * w);
+    for (int_fast16_t row = visible.y0; row <= visible.y1; row++) {
+        ILI9341_DecodeImage(&decoder, NULL, visible.x0);
+
+        for (int_fast16_t col = 0; col < visibleWidth;) {
+            size_t n = ILI9341_DRAW_IMAGE_BUFFER_SIZE - bufferIndex;
+            if (n > (size_t)(visibleWidth - col)) n = visibleWidth - col;
+
+            ILI9341_DecodeImage(&decoder, &buffers[current][bufferIndex], n);
+            bufferIndex += n;
+            col += n;
+
+            if (bufferIndex == ILI9341_DRAW_IMAGE_BUFFER_SIZE) {
+                ILI9341_StreamPixels(ili9341, buffers[current], bufferIndex, dma);
+                current ^= 1;
+                bufferIndex = 0;
+            }
+        }
+
+        if (row < visible.y1) ILI9341_DecodeImage(&decoder, NULL, w - 1 - visible.x1);
+    }
+
+    if (bufferIndex > 0) ILI9341_StreamPixels(ili9341, buffers[current], bufferIndex, dma);
+
+    if (dma) {
+        ILI9341_WaitTransfer(ili9341);
+    } else {
+        ILI9341_Deselect(ili9341);
+    }
+}
+
+/**
+ * @brief Spread an RGB565 color over a 32-bit word with gaps above its components, green in the high half
+ * @param pixel Color in RGB565 format with the 2 bytes swapped
+ * @return The spread color, each component can be multiplied by up to 32 without overlapping the next one
+ */
+static inline uint32_t ILI9341_SpreadColor(uint16_t pixel) {
+    const uint32_t color = (uint16_t)((pixel >> 8) | (pixel << 8));
+    return (color | color << 16) & 0x07E0F81F;
+}
+
+/**
+ * @brief Blend two spread colors
+ * @param a First spread color
+ * @param b Second spread color
+ * @param weight Weight of the second color, 0 to 31 in 32ths
+ * @return The spread blend, rounded
+ */
+static inline uint32_t ILI9341_BlendSpread(uint32_t a, uint32_t b, uint_fast8_t weight) {
+    // 16 added to each component before the shift rounds it
+    return ((a * (32 - weight) + b * weight + 0x02008010) >> 5) & 0x07E0F81F;
+}
+
+/**
+ * @brief Build a row of a scaled image
+ * @param pixels Output pixels in RGB565 format with the 2 bytes swapped
+ * @param count Number of pixels
+ * @param line0 Source row sampled, the upper one with bilinear filtering
+ * @param line1 Source row below line0, only read when fy is not 0
+ * @param srcW Width of the source rows
+ * @param position Source X coordinate of the first pixel in 16.16 fixed point, relative to the centers of the source
+ * pixels with bilinear filtering
+ * @param step Source X increment per pixel in 16.16 fixed point
+ * @param fy Weight of line1, 0 to 31 in 32ths
+ * @param bilinear Blend the 4 nearest pixels instead of taking the nearest one
+ */
+static void ILI9341_ScaleRow(
+    uint16_t* pixels,
+    size_t count,
+    const uint16_t* line0,
+    const uint16_t* line1,
+    int_fast16_t srcW,
+    int_fast32_t position,
+    int_fast32_t step,
+    uint_fast8_t fy,
+    bool bilinear
+) {
+    if (!bilinear) {
+        for (size_t i = 0; i < count; i++, position += step) pixels[i] = line0[position >> 16];
+        return;
+    }
+
+    // the pixels around the position only change every few output pixels when stretching
+    int_fast16_t cached = -1;
+    uint32_t left = 0, right = 0;
+
+    for (size_t i = 0; i < count; i++, position += step) {
+        const int_fast32_t p = position < 0 ? 0 : position;
+        const int_fast16_t sx = p >> 16;
+
+        if (sx != cached) {
+            const int_fast16_t next = sx + 1 < srcW ? sx + 1 : sx;
+            left = ILI9341_SpreadColor(line0[sx]);
+            right = ILI9341_SpreadColor(line0[next]);
+            if (fy) {
+                left = ILI9341_BlendSpread(left, ILI9341_SpreadColor(line1[sx]), fy);
+                right = ILI9341_BlendSpread(right, ILI9341_SpreadColor(line1[next]), fy);
+            }
+            cached = sx;
+        }
+
+        const uint32_t color = ILI9341_BlendSpread(left, right, (p >> 11) & 0x1F);
+        const uint16_t native = (color | color >> 16) & 0xFFFF;
+        pixels[i] = (native >> 8) | (native << 8);
+    }
+}
+
+void ILI9341_DrawImageScaled(
+    const ILI9341_HandleTypeDef* ili9341,
+    int_fast16_t x,
+    int_fast16_t y,
+    int_fast16_t w,
+    int_fast16_t h,
+    const uint16_t* data,
+    int_fast16_t srcW,
+    int_fast16_t srcH,
+    uint_fast8_t filter
+) {
+    if (ili9341->displayList || ili9341->clip) {
+        const ILI9341_DisplayOp op = {
+            .type = ILI9341_OP_IMAGE_SCALED,
+            .flags = filter,
+            .args = {x, y, w, h, srcW, srcH},
+            .data = data
+        };
+        if (ILI9341_InterceptOp(ili9341, &op, NULL, 0, NULL, 0)) return;
+    }
+
+    if (srcW <= 0 || srcH <= 0) return;
+
+    ILI9341_Rect visible;
+    if (!ILI9341_ClipImage(ili9341, &x, &y, &w, &h, &visible)) return;
+    if (!ILI9341_ClipVisible(ili9341, x, y, &visible)) return;
+
+    const bool bilinear = filter == ILI9341_FILTER_BILINEAR;
+    const int_fast16_t visibleWidth = visible.x1 - visible.x0 + 1;
+    const bool dma = !ili9341->surface && ili9341->spi_handle->hdmatx != NULL;
+
+    // DDA in 16.16 fixed point from the centers of the scaled pixels, bilinear filtering measures from the centers of
+    // the source pixels, half a pixel before
+    const int_fast32_t stepX = ((int_fast32_t)srcW << 16) / w, stepY = ((int_fast32_t)srcH << 16) / h;
+    const int_fast32_t offsetX = stepX / 2 - (bilinear ? 0x8000 : 0), offsetY = stepY / 2 - (bilinear ? 0x8000 : 0);
+    const int_fast32_t startX = (int_fast64_t)visible.x0 * stepX + offsetX;
+    int_fast32_t positionY = (int_fast64_t)visible.y0 * stepY + offsetY;
+
+    // one line buffer is built while the other is sent, a row fitting in one buffer is kept to be sent again
+    uint16_t buffers[2][ILI9341_DRAW_IMAGE_BUFFER_SIZE];
+    uint_fast8_t current = 0;
+    int_fast32_t previousRow = -1;
+
+    ILI9341_Select(ili9341);
+    ILI9341_SetAddressWindow(ili9341, x + visible.x0, y + visible.y0, x + visible.x1, y + visible.y1);
+
+    for (int_fast16_t row = visible.y0; row <= visible.y1; row++, positionY += stepY) {
+        const int_fast32_t p = positionY < 0 ? 0 : positionY;
+        const int_fast16_t sy = p >> 16;
+        const uint_fast8_t fy = bilinear && sy + 1 < srcH ? (p >> 11) & 0x1F : 0;
+
+        // source row and vertical weight, rows sampling the same source pixels are the same
+        const int_fast32_t sourceRow = (int_fast32_t)sy << 5 | fy;
+        if (sourceRow == previousRow) {
+            ILI9341_StreamPixels(ili9341, buffers[current ^ 1], visibleWidth, dma);
+            continue;
+        }
+
+        const uint16_t* line0 = &data[(size_t)sy * srcW];
+        int_fast32_t positionX = startX;
+
+        for (int_fast16_t col = 0; col < visibleWidth;) {
+            size_t n = visibleWidth - col;
+            if (n > ILI9341_DRAW_IMAGE_BUFFER_SIZE) n = ILI9341_DRAW_IMAGE_BUFFER_SIZE;
+
+            ILI9341_ScaleRow(buffers[current], n, line0, line0 + srcW, srcW, positionX, stepX, fy, bilinear);
+            ILI9341_StreamPixels(ili9341, buffers[current], n, dma);
+            current ^= 1;
+            positionX += (int_fast32_t)n * stepX;
+            col += n;
+        }
+
+        previousRow = visibleWidth <= ILI9341_DRAW_IMAGE_BUFFER_SIZE ? sourceRow : -1;
+    }
+
+    if (dma) {
+        ILI9341_WaitTransfer(ili9341);
+    } else {
+        ILI9341_Deselect(ili9341);
+    }
+}
+
+// Levels of the 4x4 Bayer matrix, the dither threshold of a pixel is (2 * level + 1) / 32 of a shade
+static const uint8_t ILI9341_BayerLevels[4][4] = {
+    {0, 8, 2, 10},
+    {12, 4, 14, 6},
+    {3, 11, 1, 9},
+    {15, 7, 13, 5}
+};
+
+/**
+ * @brief Integer square root
+ * @param value Value to take the root of
+ * @return floor(sqrt(value))
+ */
+static uint_fast32_t ILI9341_SquareRoot(uint_fast64_t value) {
+    uint_fast64_t root = 0;
+    uint_fast64_t bit = (uint_fast64_t)1 << 62;
+
+    while (bit > value) bit >>= 2;
+    while (bit != 0) {
+        if (value >= root + bit) {
+            value -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+
+    return root;
+}
+
+/**
+ * @brief Split a color into its components
+ * @param color 16-bit color in RGB565 format
+ * @param levels Set to red, green and blue
+ */
+static void ILI9341_SplitColor(uint16_t color, int_fast32_t* levels) {
+    levels[0] = color >> 11;
+    levels[1] = (color >> 5) & 0x3F;
+    levels[2] = color & 0x1F;
+}
+
+/**
+ * @brief Set the colors of a gradient paint
+ * @param paint Paint to set up
+ * @param color0 16-bit color at the start in RGB565 format
+ * @param color1 16-bit color at the end in RGB565 format
+ */
+static void ILI9341_SetPaintColors(ILI9341_Paint* paint, uint16_t color0, uint16_t color1) {
+    int_fast32_t levels1[3];
+
+    paint->color0 = (color0 >> 8) | (color0 << 8);
+    paint->color1 = (color1 >> 8) | (color1 << 8);
+    ILI9341_SplitColor(color0, paint->levels);
+    ILI9341_SplitColor(color1, levels1);
+    for (uint_fast8_t c = 0; c < 3; c++) paint->deltas[c] = levels1[c] - paint->levels[c];
+}
+
+ILI9341_Paint ILI9341_LinearGradient(
+    int_fast16_t x0,
+    int_fast16_t y0,
+    int_fast16_t x1,
+    int_fast16_t y1,
+    uint16_t color0,
+    uint16_t color1,
+    bool dither
+) {
+    ILI9341_Paint paint = {
+        .type = ILI9341_PAINT_LINEAR,
+        .dither = dither,
+        .x = x0,
+        .y = y0,
+        .dx = x1 - x0,
+        .dy = y1 - y0
+    };
+
+    ILI9341_SetPaintColors(&paint, color0, color1);
+
+    // a gradient without length has the start color up to the start and the end color from there
+    paint.length2 = (int_fast64_t)paint.dx * paint.dx + (int_fast64_t)paint.dy * paint.dy;
+    if (paint.length2 == 0) paint.length2 = 1;
+
+    for (uint_fast8_t c = 0; c < 3; c++) {
+        const int_fast64_t step = (int_fast64_t)paint.dx * paint.deltas[c] * (1 << 24);
+        paint.steps[c] = (step + (step < 0 ? -paint.length2 : paint.length2) / 2) / paint.length2;
+    }
+
+    return paint;
+}
+
+ILI9341_Paint ILI9341_RadialGradient(
+    int_fast16_t xc,
+    int_fast16_t yc,
+    int_fast16_t r,
+    uint16_t color0,
+    uint16_t color1,
+    bool dither
+) {
+    r = abs(r);
+    if (r < 1) r = 1;
+    if (r > 4095) r = 4095;
+
+    ILI9341_Paint paint = {
+        .type = ILI9341_PAINT_RADIAL,
+        .dither = dither,
+        .x = xc,
+        .y = yc,
+        .radius = r,
+        .scale = ((uint_fast32_t)1 << 27) / r
+    };
+
+    ILI9341_SetPaintColors(&paint, color0, color1);
+    return paint;
+}
+
+ILI9341_Paint ILI9341_Pattern(int_fast16_t x, int_fast16_t y, int_fast16_t w, int_fast16_t h, const uint16_t* pixels) {
+    return (ILI9341_Paint){
+        .type = ILI9341_PAINT_PATTERN,
+        .x = x,
+        .y = y,
+        .pixels = pixels,
+        .width = w > 0 ? w : 1,
+        .height = h > 0 ? h : 1
+    };
+}
+
+/**
+ * @brief Fill pixels of a span with one color
+ * @param pixels Pixels to fill
+ * @param color Color in RGB565 format with the 2 bytes swapped
+ * @param count Number of pixels
+ */
+static inline void ILI9341_FillPixels(uint16_t* pixels, uint16_t color, size_t count) {
+    for (size_t i = 0; i < count; i++) pixels[i] = color;
+}
+
+/**
+ * @brief Pack the components of a gradient pixel, rounded down after adding the dither threshold
+ * @param levels Red, green and blue in 2^-24 of a shade
+ * @param threshold Dither threshold in 2^-24 of a shade
+ * @return The pixel in RGB565 format with the 2 bytes swapped
+ */
+static inline uint16_t ILI9341_PackGradient(const int_fast32_t* levels, int_fast32_t threshold) {
+    const uint16_t color = ((levels[0] + threshold) >> 24) << 11 | ((levels[1] + threshold) >> 24) << 5 |
+                           (levels[2] + threshold) >> 24;
+    return (color >> 8) | (color << 8);
+}
+
+/**
+ * @brief Generate a span of a linear gradient
+ * @param paint Linear gradient paint
+ * @param pixels Output pixels in RGB565 format with the 2 bytes swapped
+ * @param x X coordinate of the first pixel
+ * @param y Y coordinate of the span
+ * @param count Number of pixels
+ * @note The position along the gradient grows by dx from one pixel to the next, so the pixels before and after the
+ * gradient are found with 2 divisions and the colors in between step by a constant.
+ */
+static void ILI9341_PaintLinear(
+    const ILI9341_Paint* paint,
+    uint16_t* pixels,
+    int_fast16_t x,
+    int_fast16_t y,
+    size_t count
+) {
+    // position of the first pixel, 0 at the start of the gradient and length2 at the end
+    const int_fast64_t d = (int_fast64_t)(x - paint->x) * paint->dx + (int_fast64_t)(y - paint->y) * paint->dy;
+    const int_fast64_t length2 = paint->length2, dx = paint->dx;
+
+    // pixels [start, end) are inside the gradient, the ones before and after have the colors of its ends
+    int_fast64_t start, end;
+    uint16_t before, after;
+    if (dx > 0) {
+        start = d > 0 ? 0 : -d / dx + 1;
+        end = d >= length2 ? 0 : (length2 - d + dx - 1) / dx;
+        before = paint->color0;
+        after = paint->color1;
+    } else if (dx < 0) {
+        start = d < length2 ? 0 : (d - length2) / -dx + 1;
+        end = d <= 0 ? 0 : (d - dx - 1) / -dx;
+        before = paint->color1;
+        after = paint->color0;
+    } else {
+        start = 0;
+        end = d > 0 && d < length2 ? count : 0;
+        before = after = d <= 0 ? paint->color0 : paint->color1;
+    }
+    if (start > (int_fast64_t)count) start = count;
+    if (end > (int_fast64_t)count) end = count;
+    if (end < start) end = start;
+
+    ILI9341_FillPixels(pixels, before, start);
+    ILI9341_FillPixels(&pixels[end], after, count - end);
+    if (start == end) return;
+
+    // the steps are precise enough for spans starting at other pixels of a row to get the same colors
+    const int_fast32_t t = (((d + start * dx) << 24) + length2 / 2) / length2;
+    int_fast32_t levels[3];
+    for (uint_fast8_t c = 0; c < 3; c++) levels[c] = (paint->levels[c] << 24) + t * paint->deltas[c];
+
+    const uint8_t* bayer = ILI9341_BayerLevels[y & 3];
+    for (int_fast32_t i = start; i < end; i++) {
+        const int_fast32_t threshold = paint->dither ? (2 * bayer[(x + i) & 3] + 1) << 19 : 0x800000;
+        pixels[i] = ILI9341_PackGradient(levels, threshold);
+        levels[0] += paint->steps[0];
+        levels[1] += paint->steps[1];
+        levels[2] += paint->steps[2];
+    }
+}
+
+/**
+ * @brief Generate a span of a radial gradient
+ * @param paint Radial gradient paint
+ * @param pixels Output pixels in RGB565 format with the 2 bytes swapped
+ * @param x X coordinate of the first pixel
+ * @param y Y coordinate of the span
+ * @param count Number of pixels
+ * @note Inside the radius, the squared distance in 1/256 of a pixel grows by 256 * (2 * u + 1) to the next pixel,
+ * where u is the X offset from the center. The distance in 1/16 of a pixel follows it by keeping the remainder of its
+ * square, the distance changes by at most one pixel from one pixel to the next.
+ */
+static void ILI9341_PaintRadial(
+    const ILI9341_Paint* paint,
+    uint16_t* pixels,
+    int_fast16_t x,
+    int_fast16_t y,
+    size_t count
+) {
+    const int_fast32_t u0 = x - paint->x, v = y - paint->y;
+    const int_fast64_t r2 = (int_fast64_t)paint->radius * paint->radius - (int_fast64_t)v * v;
+
+    if (r2 < 0) {
+        ILI9341_FillPixels(pixels, paint->color1, count);
+        return;
+    }
 
-        // Only apply tracking if next char is not zero-width, help diacritics stay aligned
-        if (tracking) {
-            ILI9341_GlyphDef glyph = font.glyphs[c - font.startCodepoint];
-            x += glyph.advance > 0 ? tracking : 0;
+    // pixels [start, end) are inside the radius
+    const int_fast32_t half = ILI9341_SquareRoot(r2);
+    int_fast32_t start = -half - u0, end = half - u0 + 1;
+    if (start < 0) start = 0;
+    if (start > (int_fast32_t)count) start = count;
+    if (end > (int_fast32_t)count) end = count;
+    if (end < start) end = start;
+
+    ILI9341_FillPixels(pixels, paint->color1, start);
+    ILI9341_FillPixels(&pixels[end], paint->color1, count - end);
+    if (start == end) return;
+
+    int_fast32_t u = u0 + start;
+    const uint_fast32_t square = 256 * (uint_fast32_t)(u * u + v * v);
+    int_fast32_t distance = ILI9341_SquareRoot(square);
+    int_fast32_t remainder = square - distance * distance;
+
+    const uint8_t* bayer = ILI9341_BayerLevels[y & 3];
+    for (int_fast32_t i = start; i < end; i++, u++) {
+        // from the middle of the 1/16 of a pixel the distance is in
+        int_fast32_t t = ((uint_fast64_t)(2 * distance + 1) * paint->scale) >> 16;
+        if (t > 0x10000) t = 0x10000;
+
+        int_fast32_t levels[3];
+        for (uint_fast8_t c = 0; c < 3; c++) levels[c] = (paint->levels[c] << 24) + t * paint->deltas[c] * 256;
+        pixels[i] = ILI9341_PackGradient(levels, paint->dither ? (2 * bayer[(x + i) & 3] + 1) << 19 : 0x800000);
+
+        remainder += 256 * (2 * u + 1);
+        while (remainder < 0) {
+            remainder += 2 * distance - 1;
+            distance--;
+        }
+        while (remainder > 2 * distance) {
+            remainder -= 2 * distance + 1;
+            distance++;
         }
     }
+}
 
-    ILI9341_Deselect(ili9341);
+/**
+ * @brief Generate a span of a pattern
+ * @param paint Pattern paint
+ * @param pixels Output pixels in RGB565 format with the 2 bytes swapped
+ * @param x X coordinate of the first pixel
+ * @param y Y coordinate of the span
+ * @param count Number of pixels
+ */
+static void ILI9341_PaintPattern(
+    const ILI9341_Paint* paint,
+    uint16_t* pixels,
+    int_fast16_t x,
+    int_fast16_t y,
+    size_t count
+) {
+    int_fast16_t u = (x - paint->x) % paint->width, v = (y - paint->y) % paint->height;
+    if (u < 0) u += paint->width;
+    if (v < 0) v += paint->height;
+
+    const uint16_t* row = &paint->pixels[(size_t)v * paint->width];
+    while (count > 0) {
+        size_t run = paint->width - u;
+        if (run > count) run = count;
+
+        memcpy(pixels, &row[u], run * sizeof(uint16_t));
+        pixels += run;
+        count -= run;
+        u = 0;
+    }
 }
 
 /**
- * @brief Write a scaled character with transparent background at specified coordinates without selecting/deselecting
- * the display
- * @param ili9341 Pointer to ILI9341 handle structure
- * @param x X coordinate of the left of the character
- * @param y Y coordinate of the baseline of the character
- * @param ch ASCII character to write
- * @param font Font definition to use for rendering the character
- * @param color 16-bit character color in RGB565 format
- * @param scale Scaling factor (integer) to enlarge the character
+ * @brief Generate a span of a paint
+ * @param paint Paint to generate
+ * @param pixels Output pixels in RGB565 format with the 2 bytes swapped
+ * @param x X coordinate of the first pixel
+ * @param y Y coordinate of the span
+ * @param count Number of pixels
  */
-static void ILI9341_DrawGlyphTransparentFast(
-    const ILI9341_HandleTypeDef* ili9341,
+static void ILI9341_PaintSpan(
+    const ILI9341_Paint* paint,
+    uint16_t* pixels,
     int_fast16_t x,
     int_fast16_t y,
-    ILI9341_GlyphDef glyph,
-    uint16_t color,
-    int_fast16_t scale
+    size_t count
 ) {
-    int_fast16_t startX = x + glyph.bbX * scale;
-    int_fast16_t startY = y - glyph.bbY * scale - glyph.bbH * scale + 1;
-    int_fast16_t endX = startX + glyph.bbW * scale - 1;
-    int_fast16_t endY = startY + glyph.bbH * scale - 1;
+    switch (paint->type) {
+        case ILI9341_PAINT_LINEAR:
+            ILI9341_PaintLinear(paint, pixels, x, y, count);
+            break;
+        case ILI9341_PAINT_RADIAL:
+            ILI9341_PaintRadial(paint, pixels, x, y, count);
+            break;
+        case ILI9341_PAINT_PATTERN:
+            ILI9341_PaintPattern(paint, pixels, x, y, count);
+            break;
+    }
+}
 
-    if (endX < 0 || endY < 0 || startX >= ili9341->width || startY >= ili9341->height ||
-        (glyph.bbW == 0 || glyph.bbH == 0))
+/**
+ * @brief Fill a horizontal span without selecting/deselecting the display, with the paint of the handle if it is set
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @param x0 X coordinate of the first pixel
+ * @param x1 X coordinate of the last pixel, >= x0
+ * @param y Y coordinate of the span
+ * @param color 16-bit fill color in RGB565 format, used without a paint
+ * @note A span of up to ILI9341_FILL_RECT_BUFFER_SIZE pixels is sent in one write.
+ */
+static void ILI9341_FillSpanFast(
+    const ILI9341_HandleTypeDef* ili9341,
+    int_fast16_t x0,
+    int_fast16_t x1,
+    int_fast16_t y,
+    uint16_t color
+) {
+    if (!ili9341->paint) {
+        ILI9341_FillRectangleFast(ili9341, x0, y, x1 - x0 + 1, 1, color);
         return;
+    }
 
-    int_fast16_t index = 0;
-    uint8_t mask = 0x80;
+    if (y < 0 || y >= ili9341->height || x1 < 0 || x0 >= ili9341->width || x1 < x0) return;
+    if (x0 < 0) x0 = 0;
+    if (x1 >= ili9341->width) x1 = ili9341->width - 1;
 
-    for (int_fast16_t row = 0; row < glyph.bbH; row++) {
-        for (int_fast16_t col = 0; col < glyph.bbW; col++) {
-            if (glyph.data[index] & mask) {
-                ILI9341_FillRectangleFast(ili9341, startX + col * scale, startY + row * scale, scale, scale, color);
-            }
-            mask >>= 1;
-            if (mask == 0) {
-                index++;
-                mask = 0x80;
-            }
-        }
+    uint16_t buffer[ILI9341_FILL_RECT_BUFFER_SIZE];
+
+    ILI9341_SetAddressWindow(ili9341, x0, y, x1, y);
+
+    for (int_fast16_t x = x0; x <= x1;) {
+        size_t n = x1 - x + 1;
+        if (n > ILI9341_FILL_RECT_BUFFER_SIZE) n = ILI9341_FILL_RECT_BUFFER_SIZE;
+
+        ILI9341_PaintSpan(ili9341->paint, buffer, x, y, n);
+        ILI9341_WritePixels(ili9341, buffer, n);
+        x += n;
     }
 }
 
-void ILI9341_WriteStringTransparent(
+/**
+ * @brief Fill a rectangle with the paint of the handle, one span per row
+ * @param ili9341 Pointer to ILI9341 handle structure, paint must be set
+ * @param x X coordinate of the top-left corner of the rectangle
+ * @param y Y coordinate of the top-left corner of the rectangle
+ * @param w Width of the rectangle in pixels, can be negative
+ * @param h Height of the rectangle in pixels, can be negative
+ */
+static void ILI9341_FillRectanglePainted(
     const ILI9341_HandleTypeDef* ili9341,
     int_fast16_t x,
     int_fast16_t y,
-    const char* str,
-    ILI9341_FontDef font,
-    uint16_t color,
-    bool wrap,
-    int_fast16_t scale,
-    int_fast16_t tracking,
-    int_fast16_t leading
+    int_fast16_t w,
+    int_fast16_t h
 ) {
-    if (scale < 1 || y + font.descent * scale < 0 || y - font.ascent * scale >= ili9341->height) return;
+    ILI9341_Rect visible;
+    if (!ILI9341_ClipImage(ili9341, &x, &y, &w, &h, &visible)) return;
+    if (!ILI9341_ClipVisible(ili9341, x, y, &visible)) return;
 
-    int_fast16_t originalX = x;
-
-    ILI9341_Select(ili9341);
+    const ILI9341_Paint* paint = ili9341->paint;
+    const int_fast16_t x0 = x + visible.x0, width = visible.x1 - visible.x0 + 1;
+    const bool dma = !ili9341->surface && ili9341->spi_handle->hdmatx != NULL;
 
-    for (unsigned char c; (c = *(str++));) {
-        if (c == '\r') {
-            x = originalX;
-            continue;
-        }
+    // the rows of a horizontal gradient without dithering are all the same, a row fitting in one buffer is sent again
+    const bool sameRows = paint->type == ILI9341_PAINT_LINEAR && paint->dy == 0 && !paint->dither &&
+                          width <= ILI9341_FILL_RECT_BUFFER_SIZE;
 
-        if (c == '\n') {
-            y += (font.ascent + font.descent) * scale + leading;
-            x = originalX;
-            if (y - font.ascent * scale >= ili9341->height) break;
-            continue;
-        }
+    // one span is built while the other is sent
+    uint16_t buffers[2][ILI9341_FILL_RECT_BUFFER_SIZE];
+    uint_fast8_t current = 0;
 
-        if (c < font.startCodepoint || c > font.endCodepoint) { c = FALLBACK_CODEPOINT; }
-        ILI9341_GlyphDef glyph = font.glyphs[c - font.startCodepoint];
+    ILI9341_Select(ili9341);
+    ILI9341_SetAddressWindow(ili9341, x0, y + visible.y0, x + visible.x1, y + visible.y1);
 
-        // Only wrap if current char is not zero-width, help prevent newline on diacritics
-        if (wrap && glyph.advance > 0 && x + (glyph.bbX + glyph.bbW) * scale + 1 >= ili9341->width) {
-            y += (font.ascent + font.descent) * scale + leading;
-            x = originalX;
-            if (y - font.ascent * scale >= ili9341->height) break;
-            if (c == 0x20 || c == 0xA0) {  // Ignore space and nbsp after newline
-                continue;
-            }
+    for (int_fast16_t row = y + visible.y0; row <= y + visible.y1; row++) {
+        if (sameRows && row > y + visible.y0) {
+            ILI9341_StreamPixels(ili9341, buffers[current ^ 1], width, dma);
+            continue;
         }
 
-        ILI9341_DrawGlyphTransparentFast(ili9341, x, y, glyph, color, scale);
-        x += glyph.advance * scale;
-
-        c = *str;
-        if (c < font.startCodepoint || c > font.endCodepoint) { c = FALLBACK_CODEPOINT; }
+        for (int_fast16_t col = 0; col < width;) {
+            size_t n = width - col;
+            if (n > ILI9341_FILL_RECT_BUFFER_SIZE) n = ILI9341_FILL_RECT_BUFFER_SIZE;
 
-        // Only apply tracking if next char is not zero-width, help diacritics stay aligned
-        if (tracking) {
-            ILI9341_GlyphDef glyph = font.glyphs[c - font.startCodepoint];
-            x += glyph.advance > 0 ? tracking : 0;
+            ILI9341_PaintSpan(paint, buffers[current], x0 + col, row, n);
+            ILI9341_StreamPixels(ili9341, buffers[current], n, dma);
+            current ^= 1;
+            col += n;
         }
     }
 
-    ILI9341_Deselect(ili9341);
+    if (dma) {
+        ILI9341_WaitTransfer(ili9341);
+    } else {
+        ILI9341_Deselect(ili9341);
+    }
 }
 
-void ILI9341_DrawImage(
+void ILI9341_FillRectangle(
     const ILI9341_HandleTypeDef* ili9341,
     int_fast16_t x,
     int_fast16_t y,
     int_fast16_t w,
     int_fast16_t h,
-    const uint16_t* data
+    uint16_t color
 ) {
-    if (w == 0 || h == 0) return;
-    if (w < 0) {
-        w = -w;
-        x -= w - 1;
+    if (ili9341->displayList || ili9341->clip) {
+        const ILI9341_DisplayOp op = {
+            .type = ILI9341_OP_FILL_RECTANGLE,
+            .args = {x, y, w, h},
+            .color = color,
+            .data = ili9341->paint
+        };
+        if (ILI9341_InterceptOp(ili9341, &op, NULL, 0, NULL, 0)) return;
     }
-    if (h < 0) {
-        h = -h;
-        y -= h - 1;
+
+    if (ili9341->paint) {
+        ILI9341_FillRectanglePainted(ili9341, x, y, w, h);
+        return;
     }
-    if (x >= ili9341->width || y >= ili9341->height || x + w < 0 || y + h < 0) return;
 
     ILI9341_Select(ili9341);
+    ILI9341_FillRectangleFast(ili9341, x, y, w, h, color);
+    ILI9341_Deselect(ili9341);
+}
 
-    if (x < 0 || y < 0 || (x + w - 1) >= ili9341->width || (y + h - 1) >= ili9341->height) {
-        int_fast16_t clipStartX = x < 0 ? -x : 0;
-        int_fast16_t clipStartY = y < 0 ? -y : 0;
-        int_fast16_t clipEndX = x + w - 1 >= ili9341->width ? ili9341->width - x - 1 : w - 1;
-        int_fast16_t clipEndY = y + h - 1 >= ili9341->height ? ili9341->height - y - 1 : h - 1;
+void ILI9341_FillScreen(const ILI9341_HandleTypeDef* ili9341, uint16_t color) {
+    ILI9341_FillRectangle(ili9341, 0, 0, ili9341->width, ili9341->height, color);
+}
 
-        uint16_t buffer[ILI9341_DRAW_IMAGE_BUFFER_SIZE];
-        size_t bufferIndex = 0;
+bool ILI9341_CompressImage(
+    ILI9341_CompressedImage* image,
+    const uint16_t* data,
+    int_fast16_t w,
+    int_fast16_t h,
+    uint8_t* buffer,
+    size_t capacity
+) {
+    const size_t count = (size_t)w * h;
+    uint16_t index[64];
+    uint_fast16_t previous = 0;
+    uint_fast32_t run = 0;
+    size_t size = 0;
 
-        ILI9341_SetAddressWindow(ili9341, x + clipStartX, y + clipStartY, x + clipEndX, y + clipEndY);
+    memset(index, 0, sizeof(index));
 
-        for (int_fast16_t row = clipStartY; row <= clipEndY; row++) {
-            for (int_fast16_t col = clipStartX; col <= clipEndX; col++) {
-                buffer[bufferIndex++] = data[row * w + col];
+    for (size_t i = 0; i <= count; i++) {
+        const uint_fast16_t color = i < count ? (uint16_t)((data[i] >> 8) | (data[i] << 8)) : 0;
 
-                if (bufferIndex >= ILI9341_DRAW_IMAGE_BUFFER_SIZE) {
-                    ILI9341_WriteData(ili9341, (uint8_t*)buffer, bufferIndex * 2);
-                    bufferIndex = 0;
-                }
-            }
+        if (i < count && color == previous && run < ILI9341_IMAGE_MAX_LONG_RUN) {
+            run++;
+            continue;
         }
 
-        if (bufferIndex > 0) { ILI9341_WriteData(ili9341, (uint8_t*)buffer, bufferIndex * 2); }
-    } else {
-        ILI9341_SetAddressWindow(ili9341, x, y, x + w - 1, y + h - 1);
-        ILI9341_WriteData(ili9341, (uint8_t*)data, sizeof(uint16_t) * w * h);
+        if (run > ILI9341_IMAGE_MAX_RUN) {
+            if (size + 3 > capacity) return false;
+            buffer[size++] = ILI9341_IMAGE_OP_LONG_RUN;
+            buffer[size++] = (run - 1) >> 8;
+            buffer[size++] = (run - 1) & 0xFF;
+        } else if (run > 0) {
+            if (size + 1 > capacity) return false;
+            buffer[size++] = ILI9341_IMAGE_OP_RUN + run - 1;
+        }
+        run = 0;
+
+        if (i == count) break;
+        // a run too long for one op goes on with the next one
+        if (color == previous) {
+            run = 1;
+            continue;
+        }
+
+        const uint_fast8_t hash = ILI9341_HashImageColor(color);
+        // differences wrap around like the channels when decoded
+        const int_fast16_t dr = (int_fast16_t)(((color >> 11) - (previous >> 11) + 16) & 0x1F) - 16;
+        const int_fast16_t dg = (int_fast16_t)((((color >> 5) & 0x3F) - ((previous >> 5) & 0x3F) + 32) & 0x3F) - 32;
+        const int_fast16_t db = (int_fast16_t)(((color & 0x1F) - (previous & 0x1F) + 16) & 0x1F) - 16;
+        const int_fast16_t half = (dg + 32) / 2 - 16;
+
+        if (index[hash] == color) {
+            if (size + 1 > capacity) return false;
+            buffer[size++] = ILI9341_IMAGE_OP_INDEX | hash;
+        } else if (dr >= -2 && dr <= 1 && dg >= -2 && dg <= 1 && db >= -2 && db <= 1) {
+            if (size + 1 > capacity) return false;
+            buffer[size++] = ILI9341_IMAGE_OP_DIFF | ((dr + 2) << 4) | ((dg + 2) << 2) | (db + 2);
+        } else if (dr - half >= -8 && dr - half <= 7 && db - half >= -8 && db - half <= 7) {
+            if (size + 2 > capacity) return false;
+            buffer[size++] = ILI9341_IMAGE_OP_LUMA | (dg + 32);
+            buffer[size++] = ((dr - half + 8) << 4) | (db - half + 8);
+        } else {
+            if (size + 3 > capacity) return false;
+            buffer[size++] = ILI9341_IMAGE_OP_COLOR;
+            buffer[size++] = color >> 8;
+            buffer[size++] = color & 0xFF;
+        }
+
+        index[hash] = color;
+        previous = color;
     }
 
-    ILI9341_Deselect(ili9341);
+    *image = (ILI9341_CompressedImage){.width = w, .height = h, .size = size, .data = buffer};
+    return true;
 }
 
 /**
@@ -828,6 +2845,11 @@ void ILI9341_DrawLine(
     int_fast16_t y2,
     uint16_t color
 ) {
+    if (ili9341->displayList || ili9341->clip) {
+        const ILI9341_DisplayOp op = {.type = ILI9341_OP_LINE, .args = {x1, y1, x2, y2}, .color = color};
+        if (ILI9341_InterceptOp(ili9341, &op, NULL, 0, NULL, 0)) return;
+    }
+
     ILI9341_Select(ili9341);
     ILI9341_DrawLineFast(ili9341, x1, y1, x2, y2, color);
     ILI9341_Deselect(ili9341);
@@ -904,6 +2926,11 @@ void ILI9341_DrawRectangleThick(
     uint16_t color,
     int_fast16_t thickness
 ) {
+    if (ili9341->displayList || ili9341->clip) {
+        const ILI9341_DisplayOp op = {.type = ILI9341_OP_RECTANGLE, .args = {x, y, w, h, thickness}, .color = color};
+        if (ILI9341_InterceptOp(ili9341, &op, NULL, 0, NULL, 0)) return;
+    }
+
     if (thickness <= 0) return;
 
     ILI9341_Select(ili9341);
@@ -923,6 +2950,11 @@ void ILI9341_DrawCircle(
     int_fast16_t r,
     uint16_t color
 ) {
+    if (ili9341->displayList || ili9341->clip) {
+        const ILI9341_DisplayOp op = {.type = ILI9341_OP_CIRCLE, .args = {xc, yc, r}, .color = color};
+        if (ILI9341_InterceptOp(ili9341, &op, NULL, 0, NULL, 0)) return;
+    }
+
     r = abs(r);
     if (r == 0 || xc + r < 0 || xc - r >= ili9341->width || yc + r < 0 || yc - r >= ili9341->height) return;
 
@@ -970,6 +3002,11 @@ void ILI9341_DrawCircleThick(
     uint16_t color,
     int_fast16_t thickness
 ) {
+    if (ili9341->displayList || ili9341->clip) {
+        const ILI9341_DisplayOp op = {.type = ILI9341_OP_CIRCLE_THICK, .args = {xc, yc, r, thickness}, .color = color};
+        if (ILI9341_InterceptOp(ili9341, &op, NULL, 0, NULL, 0)) return;
+    }
+
     r = abs(r);
     if (r == 0 || thickness <= 0 || xc + r < 0 || xc - r >= ili9341->width || yc + r < 0 || yc - r >= ili9341->height)
         return;
@@ -1001,6 +3038,16 @@ void ILI9341_FillCircle(
     int_fast16_t r,
     uint16_t color
 ) {
+    if (ili9341->displayList || ili9341->clip) {
+        const ILI9341_DisplayOp op = {
+            .type = ILI9341_OP_FILL_CIRCLE,
+            .args = {xc, yc, r},
+            .color = color,
+            .data = ili9341->paint
+        };
+        if (ILI9341_InterceptOp(ili9341, &op, NULL, 0, NULL, 0)) return;
+    }
+
     r = abs(r);
     if (r == 0 || xc + r < 0 || xc - r >= ili9341->width || yc + r < 0 || yc - r >= ili9341->height) return;
 
@@ -1012,9 +3059,9 @@ void ILI9341_FillCircle(
 
     ILI9341_Select(ili9341);
 
-    ILI9341_DrawLineFast(ili9341, xc - r, yc, xc + r, yc, color);
-    ILI9341_DrawPixelFast(ili9341, xc, yc + r, color);
-    ILI9341_DrawPixelFast(ili9341, xc, yc - r, color);
+    ILI9341_FillSpanFast(ili9341, xc - r, xc + r, yc, color);
+    ILI9341_FillSpanFast(ili9341, xc, xc, yc + r, color);
+    ILI9341_FillSpanFast(ili9341, xc, xc, yc - r, color);
 
     while (x >= y) {
         if (f >= 0) {
@@ -1026,10 +3073,10 @@ void ILI9341_FillCircle(
         dfy += 2;
         f += dfy;
 
-        ILI9341_DrawLineFast(ili9341, xc - x, yc + y, xc + x, yc + y, color);
-        ILI9341_DrawLineFast(ili9341, xc - x, yc - y, xc + x, yc - y, color);
-        ILI9341_DrawLineFast(ili9341, xc - y, yc + x, xc + y, yc + x, color);
-        ILI9341_DrawLineFast(ili9341, xc - y, yc - x, xc + y, yc - x, color);
+        ILI9341_FillSpanFast(ili9341, xc - x, xc + x, yc + y, color);
+        ILI9341_FillSpanFast(ili9341, xc - x, xc + x, yc - y, color);
+        ILI9341_FillSpanFast(ili9341, xc - y, xc + y, yc + x, color);
+        ILI9341_FillSpanFast(ili9341, xc - y, xc + y, yc - x, color);
     }
 
     ILI9341_Deselect(ili9341);
@@ -1043,6 +3090,11 @@ void ILI9341_DrawEllipse(
     int_fast16_t ry,
     uint16_t color
 ) {
+    if (ili9341->displayList || ili9341->clip) {
+        const ILI9341_DisplayOp op = {.type = ILI9341_OP_ELLIPSE, .args = {xc, yc, rx, ry}, .color = color};
+        if (ILI9341_InterceptOp(ili9341, &op, NULL, 0, NULL, 0)) return;
+    }
+
     rx = abs(rx);
     ry = abs(ry);
     if (rx == 0 || ry == 0 || xc + rx < 0 || xc - rx >= ili9341->width || yc + ry < 0 || yc - ry >= ili9341->height)
@@ -1111,6 +3163,11 @@ void ILI9341_DrawEllipseThick(
     uint16_t color,
     int_fast16_t thickness
 ) {
+    if (ili9341->displayList || ili9341->clip) {
+        const ILI9341_DisplayOp op = {.type = ILI9341_OP_ELLIPSE_THICK, .args = {xc, yc, rx, ry, thickness}, .color = color};
+        if (ILI9341_InterceptOp(ili9341, &op, NULL, 0, NULL, 0)) return;
+    }
+
     rx = abs(rx);
     ry = abs(ry);
     if (rx == 0 || ry == 0 || thickness <= 0 || xc + rx < 0 || xc - rx >= ili9341->width || yc + ry < 0 ||
@@ -1148,6 +3205,16 @@ void ILI9341_FillEllipse(
     int_fast16_t ry,
     uint16_t color
 ) {
+    if (ili9341->displayList || ili9341->clip) {
+        const ILI9341_DisplayOp op = {
+            .type = ILI9341_OP_FILL_ELLIPSE,
+            .args = {xc, yc, rx, ry},
+            .color = color,
+            .data = ili9341->paint
+        };
+        if (ILI9341_InterceptOp(ili9341, &op, NULL, 0, NULL, 0)) return;
+    }
+
     rx = abs(rx);
     ry = abs(ry);
     if (rx == 0 || ry == 0 || xc + rx < 0 || xc - rx >= ili9341->width || yc + ry < 0 || yc - ry >= ili9341->height)
@@ -1165,9 +3232,9 @@ void ILI9341_FillEllipse(
 
     ILI9341_Select(ili9341);
 
-    ILI9341_DrawLineFast(ili9341, xc - rx, yc, xc + rx, yc, color);
-    ILI9341_DrawPixelFast(ili9341, xc, yc + ry, color);
-    ILI9341_DrawPixelFast(ili9341, xc, yc - ry, color);
+    ILI9341_FillSpanFast(ili9341, xc - rx, xc + rx, yc, color);
+    ILI9341_FillSpanFast(ili9341, xc, xc, yc + ry, color);
+    ILI9341_FillSpanFast(ili9341, xc, xc, yc - ry, color);
 
     p = ry2 - (rx2 * ry) + (rx2 / 4);
     while (px < py) {
@@ -1181,8 +3248,8 @@ void ILI9341_FillEllipse(
             p += ry2 + px - py;
         }
 
-        ILI9341_DrawLineFast(ili9341, xc - x, yc + y, xc + x, yc + y, color);
-        ILI9341_DrawLineFast(ili9341, xc - x, yc - y, xc + x, yc - y, color);
+        ILI9341_FillSpanFast(ili9341, xc - x, xc + x, yc + y, color);
+        ILI9341_FillSpanFast(ili9341, xc - x, xc + x, yc - y, color);
     }
 
     p = ry2 * (x + 1) * (x + 1) + ry2 / 4 + rx2 * (y - 1) * (y - 1) - rx2 * ry2;
@@ -1197,8 +3264,8 @@ void ILI9341_FillEllipse(
             p += rx2 - py + px;
         }
 
-        ILI9341_DrawLineFast(ili9341, xc - x, yc + y, xc + x, yc + y, color);
-        ILI9341_DrawLineFast(ili9341, xc - x, yc - y, xc + x, yc - y, color);
+        ILI9341_FillSpanFast(ili9341, xc - x, xc + x, yc + y, color);
+        ILI9341_FillSpanFast(ili9341, xc - x, xc + x, yc - y, color);
     }
 
     ILI9341_Deselect(ili9341);
@@ -1207,6 +3274,11 @@ void ILI9341_FillEllipse(
 void ILI9341_DrawPolygon(const ILI9341_HandleTypeDef* ili9341, int16_t* x, int16_t* y, size_t n, uint16_t color) {
     if (n < 2) return;
 
+    if (ili9341->displayList || ili9341->clip) {
+        const ILI9341_DisplayOp op = {.type = ILI9341_OP_POLYGON, .args = {n}, .color = color};
+        if (ILI9341_InterceptOp(ili9341, &op, x, n * sizeof(int16_t), y, n * sizeof(int16_t))) return;
+    }
+
     ILI9341_Select(ili9341);
 
     for (size_t i = 0; i < n - 1; i++) { ILI9341_DrawLineFast(ili9341, x[i], y[i], x[i + 1], y[i + 1], color); }
@@ -1232,8 +3304,37 @@ void ILI9341_DrawPolygonThick(
     ILI9341_DrawLineThick(ili9341, x[n - 1], y[n - 1], x[0], y[0], color, thickness, cap);
 }
 
-void ILI9341_FillPolygon(const ILI9341_HandleTypeDef* ili9341, int16_t* x, int16_t* y, size_t n, uint16_t color) {
-    if (n < 3) return;
+/**
+ * @brief Check if a winding number is inside a shape
+ * @param rule ILI9341_FILL_EVEN_ODD or ILI9341_FILL_NON_ZERO
+ * @param winding Number of edges crossed for even-odd, sum of their directions for non-zero
+ * @return true if the pixels at this winding number are filled
+ */
+static inline bool ILI9341_IsInside(uint_fast8_t rule, int_fast16_t winding) {
+    return rule == ILI9341_FILL_NON_ZERO ? winding != 0 : (winding & 1) != 0;
+}
+
+/**
+ * @brief Fill closed contours along scanlines without selecting/deselecting the display
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @param x X coordinates of the points of all contours
+ * @param y Y coordinates of the points of all contours
+ * @param ends Index after the last point of each contour, each contour is closed back to its first point
+ * @param contours Number of contours
+ * @param rule ILI9341_FILL_EVEN_ODD or ILI9341_FILL_NON_ZERO
+ * @param color 16-bit fill color in RGB565 format
+ * @note Spans include the pixels of both crossing edges. Up to 32 crossings per scanline are used.
+ */
+static void ILI9341_FillContoursFast(
+    const ILI9341_HandleTypeDef* ili9341,
+    const int16_t* x,
+    const int16_t* y,
+    const uint16_t* ends,
+    size_t contours,
+    uint_fast8_t rule,
+    uint16_t color
+) {
+    const size_t n = ends[contours - 1];
 
     // find max and min Y
     int_fast16_t minY = y[0], maxY = y[0];
@@ -1247,49 +3348,254 @@ void ILI9341_FillPolygon(const ILI9341_HandleTypeDef* ili9341, int16_t* x, int16
     if (minY < 0) minY = 0;
     if (maxY >= ili9341->height) maxY = ili9341->height - 1;
 
-    int_fast16_t nodeX[32];  // max 32 intersections
-
-    ILI9341_Select(ili9341);
+    int_fast16_t nodeX[32];       // max 32 intersections
+    int_fast8_t nodeWinding[32];  // +1 for edges going down, -1 going up
 
     // scanline algorithm
     for (int_fast16_t j = minY; j <= maxY; j++) {
         int_fast16_t nodes = 0;
-        int_fast16_t k = n - 1;
 
         // find intersections
-        for (int_fast16_t i = 0; i < n; i++) {
-            if ((y[i] < j && y[k] >= j) || (y[k] < j && y[i] >= j)) {
-                int_fast16_t dy = y[k] - y[i];
-                if (dy != 0 && nodes < 32) {
-                    nodeX[nodes++] = x[i] + ((int_fast32_t)(j - y[i]) * (int_fast32_t)(x[k] - x[i])) / dy;
+        for (size_t c = 0, start = 0; c < contours; start = ends[c++]) {
+            size_t k = ends[c] - 1;
+            for (size_t i = start; i < ends[c]; i++) {
+                if ((y[i] < j && y[k] >= j) || (y[k] < j && y[i] >= j)) {
+                    int_fast16_t dy = y[k] - y[i];
+                    if (dy != 0 && nodes < 32) {
+                        nodeX[nodes] = x[i] + ((int_fast32_t)(j - y[i]) * (int_fast32_t)(x[k] - x[i])) / dy;
+                        nodeWinding[nodes++] = dy < 0 ? 1 : -1;
+                    }
                 }
+                k = i;
             }
-            k = i;
         }
 
         // insertion sort nodeX array
         for (int_fast16_t i = 1; i < nodes; i++) {
             int_fast16_t key = nodeX[i];
+            int_fast8_t keyWinding = nodeWinding[i];
             int_fast16_t jSort = i - 1;
             while (jSort >= 0 && nodeX[jSort] > key) {
                 nodeX[jSort + 1] = nodeX[jSort];
+                nodeWinding[jSort + 1] = nodeWinding[jSort];
                 jSort--;
             }
             nodeX[jSort + 1] = key;
+            nodeWinding[jSort + 1] = keyWinding;
         }
 
-        // fill the pixels between node pairs
-        for (int_fast16_t i = 0; i < nodes - 1; i += 2) {
+        // fill the pixels from a node where the winding number gets inside to the node where it gets out
+        int_fast16_t winding = 0;
+        for (int_fast16_t i = 0; i < nodes - 1; i++) {
+            winding += rule == ILI9341_FILL_NON_ZERO ? nodeWinding[i] : 1;
+            if (!ILI9341_IsInside(rule, winding)) continue;
+
             int_fast16_t x1 = nodeX[i];
+            while (i + 2 < nodes &&
+                   ILI9341_IsInside(rule, winding + (rule == ILI9341_FILL_NON_ZERO ? nodeWinding[i + 1] : 1))) {
+                winding += rule == ILI9341_FILL_NON_ZERO ? nodeWinding[++i] : 1;
+            }
             int_fast16_t x2 = nodeX[i + 1];
 
             if (x1 >= ili9341->width) break;
             if (x2 >= ili9341->width) x2 = ili9341->width - 1;
-            if (x1 < ili9341->width && x2 > 0 && x2 >= x1) {
-                ILI9341_FillRectangleFast(ili9341, x1, j, x2 - x1 + 1, 1, color);
+            if (x2 > 0 && x2 >= x1) ILI9341_FillSpanFast(ili9341, x1, x2, j, color);
+        }
+    }
+}
+
+void ILI9341_FillPolygon(const ILI9341_HandleTypeDef* ili9341, int16_t* x, int16_t* y, size_t n, uint16_t color) {
+    if (n < 3) return;
+
+    if (ili9341->displayList || ili9341->clip) {
+        const ILI9341_DisplayOp op = {
+            .type = ILI9341_OP_FILL_POLYGON,
+            .args = {n},
+            .color = color,
+            .data = ili9341->paint
+        };
+        if (ILI9341_InterceptOp(ili9341, &op, x, n * sizeof(int16_t), y, n * sizeof(int16_t))) return;
+    }
+
+    const uint16_t end = n;
+
+    ILI9341_Select(ili9341);
+    ILI9341_FillContoursFast(ili9341, x, y, &end, 1, ILI9341_FILL_EVEN_ODD, color);
+    ILI9341_Deselect(ili9341);
+}
+
+/**
+ * @brief Points of a path being flattened
+ */
+typedef struct {
+    int16_t x[ILI9341_PATH_MAX_POINTS];
+    int16_t y[ILI9341_PATH_MAX_POINTS];
+    uint16_t ends[ILI9341_PATH_MAX_CONTOURS];
+    size_t points;
+    size_t contours;
+    /** Index of the first point of the contour being flattened */
+    size_t contourStart;
+    /** Drawing coordinates of the top-left corner of the path box */
+    int_fast16_t originX;
+    int_fast16_t originY;
+} ILI9341_PathFlattener;
+
+/**
+ * @brief Add a point to the contour being flattened, unless it is on the last point or there is no room left
+ * @param flattener Pointer to the flattener
+ * @param x X coordinate in 1/256 pixel from the corner of the path box
+ * @param y Y coordinate in 1/256 pixel from the corner of the path box
+ */
+static void ILI9341_AddPathPoint(ILI9341_PathFlattener* flattener, int_fast64_t x, int_fast64_t y) {
+    if (flattener->points >= ILI9341_PATH_MAX_POINTS || flattener->contours >= ILI9341_PATH_MAX_CONTOURS) return;
+
+    x = flattener->originX + ((x + 128) >> 8);
+    y = flattener->originY + ((y + 128) >> 8);
+    if (x < INT16_MIN) x = INT16_MIN;
+    if (x > INT16_MAX) x = INT16_MAX;
+    if (y < INT16_MIN) y = INT16_MIN;
+    if (y > INT16_MAX) y = INT16_MAX;
+
+    const size_t last = flattener->points - 1;
+    if (flattener->points > flattener->contourStart && flattener->x[last] == x && flattener->y[last] == y) return;
+
+    flattener->x[flattener->points] = x;
+    flattener->y[flattener->points++] = y;
+}
+
+/**
+ * @brief End the contour being flattened, it is dropped if it has no area
+ * @param flattener Pointer to the flattener
+ */
+static void ILI9341_EndPathContour(ILI9341_PathFlattener* flattener) {
+    if (flattener->points - flattener->contourStart >= 3 && flattener->contours < ILI9341_PATH_MAX_CONTOURS) {
+        flattener->ends[flattener->contours++] = flattener->points;
+    } else {
+        flattener->points = flattener->contourStart;
+    }
+    flattener->contourStart = flattener->points;
+}
+
+/**
+ * @brief Flatten a quadratic curve into lines, without its start point
+ * @param flattener Pointer to the flattener
+ * @param x0 X coordinate of the start point in 1/256 pixel
+ * @param y0 Y coordinate of the start point in 1/256 pixel
+ * @param cx X coordinate of the control point in 1/256 pixel
+ * @param cy Y coordinate of the control point in 1/256 pixel
+ * @param x1 X coordinate of the end point in 1/256 pixel
+ * @param y1 Y coordinate of the end point in 1/256 pixel
+ * @note n lines are at most |P0 - 2C + P1| / (4 * n * n) away from the curve, n is the smallest power of 2 bringing it
+ * within 1/4 pixel. The points are stepped with forward differences scaled by n * n, which stay exact integers.
+ */
+static void ILI9341_FlattenQuad(
+    ILI9341_PathFlattener* flattener,
+    int_fast64_t x0,
+    int_fast64_t y0,
+    int_fast64_t cx,
+    int_fast64_t cy,
+    int_fast64_t x1,
+    int_fast64_t y1
+) {
+    const int_fast64_t ax = x0 - 2 * cx + x1, ay = y0 - 2 * cy + y1;
+    const int_fast64_t bend = (ax < 0 ? -ax : ax) > (ay < 0 ? -ay : ay) ? (ax < 0 ? -ax : ax) : (ay < 0 ? -ay : ay);
+
+    uint_fast8_t shift = 0;  // log2(n)
+    while (shift < 5 && ((int_fast64_t)256 << 2 * shift) < bend) shift++;
+    const int_fast32_t n = 1 << shift;
+
+    int_fast64_t fx = x0 * n * n, fy = y0 * n * n;
+    int_fast64_t dx = 2 * n * (cx - x0) + ax, dy = 2 * n * (cy - y0) + ay;
+    const int_fast64_t ddx = 2 * ax, ddy = 2 * ay;
+    const int_fast64_t half = ((int_fast64_t)1 << 2 * shift) >> 1;
+
+    for (int_fast32_t i = 0; i < n; i++) {
+        fx += dx;
+        fy += dy;
+        dx += ddx;
+        dy += ddy;
+        ILI9341_AddPathPoint(flattener, (fx + half) >> 2 * shift, (fy + half) >> 2 * shift);
+    }
+}
+
+/**
+ * @brief Read a coordinate of path bytecode
+ * @param data Pointer to the coordinate, int16 MSB first
+ * @param scale Pixels per design unit in 1/256
+ * @return The coordinate in 1/256 pixel
+ */
+static inline int_fast64_t ILI9341_ReadPathCoordinate(const uint8_t* data, uint_fast16_t scale) {
+    return (int_fast64_t)(int16_t)(data[0] << 8 | data[1]) * scale;
+}
+
+void ILI9341_FillPath(
+    const ILI9341_HandleTypeDef* ili9341,
+    int_fast16_t x,
+    int_fast16_t y,
+    const ILI9341_Path* path,
+    uint_fast16_t scale,
+    uint_fast8_t rule,
+    uint16_t color
+) {
+    if (ili9341->displayList || ili9341->clip) {
+        const ILI9341_DisplayOp op = {
+            .type = ILI9341_OP_FILL_PATH,
+            .flags = rule,
+            .args = {x, y, scale},
+            .color = color,
+            .data = path
+        };
+        if (ILI9341_InterceptOp(ili9341, &op, &ili9341->paint, sizeof(ili9341->paint), NULL, 0)) return;
+    }
+
+    if (scale == 0) return;
+
+    // points move in 1/256 pixel from the corner of the box until they are added
+    ILI9341_PathFlattener flattener = {.originX = x, .originY = y};
+    int_fast64_t currentX = 0, currentY = 0, startX = 0, startY = 0;
+    const uint8_t* data = path->data;
+    const uint8_t* end = path->data + path->size;
+
+    while (data < end && *data != ILI9341_PATH_END) {
+        const uint8_t op = *data++;
+        const size_t size = op == ILI9341_PATH_QUAD ? 8 : op == ILI9341_PATH_CLOSE ? 0 : 4;
+        if ((size_t)(end - data) < size) break;
+
+        if (op == ILI9341_PATH_MOVE) {
+            ILI9341_EndPathContour(&flattener);
+            currentX = startX = ILI9341_ReadPathCoordinate(data, scale);
+            currentY = startY = ILI9341_ReadPathCoordinate(data + 2, scale);
+            ILI9341_AddPathPoint(&flattener, currentX, currentY);
+        } else if (op == ILI9341_PATH_LINE || op == ILI9341_PATH_QUAD) {
+            // an edge right after a close starts a new contour from the point the previous one was closed to
+            if (flattener.points == flattener.contourStart) ILI9341_AddPathPoint(&flattener, currentX, currentY);
+
+            const int_fast64_t toX = ILI9341_ReadPathCoordinate(data + size - 4, scale);
+            const int_fast64_t toY = ILI9341_ReadPathCoordinate(data + size - 2, scale);
+            if (op == ILI9341_PATH_QUAD) {
+                const int_fast64_t controlX = ILI9341_ReadPathCoordinate(data, scale);
+                const int_fast64_t controlY = ILI9341_ReadPathCoordinate(data + 2, scale);
+                ILI9341_FlattenQuad(&flattener, currentX, currentY, controlX, controlY, toX, toY);
+            } else {
+                ILI9341_AddPathPoint(&flattener, toX, toY);
             }
+            currentX = toX;
+            currentY = toY;
+        } else if (op == ILI9341_PATH_CLOSE) {
+            ILI9341_EndPathContour(&flattener);
+            currentX = startX;
+            currentY = startY;
+        } else {
+            break;
         }
+
+        data += size;
     }
+    ILI9341_EndPathContour(&flattener);
 
+    if (flattener.contours == 0) return;
+
+    ILI9341_Select(ili9341);
+    ILI9341_FillContoursFast(ili9341, flattener.x, flattener.y, flattener.ends, flattener.contours, rule, color);
     ILI9341_Deselect(ili9341);
 }
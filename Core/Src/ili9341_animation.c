@@ -0,0 +1,89 @@
+#include "ili9341_animation.h"
+
+/**
+ * @brief Draw the changed rectangles of a frame
+ * @param player Pointer to the player
+ * @param frame Frame to draw, the previous frame must be on the display
+ */
+static void ILI9341_Animation_DrawFrame(const ILI9341_AnimationPlayer* player, uint_fast16_t frame) {
+    const ILI9341_Animation* animation = player->animation;
+
+    for (uint_fast16_t i = animation->frames[frame]; i < animation->frames[frame + 1]; i++) {
+        const ILI9341_AnimationRect* rect = &animation->rects[i];
+        ILI9341_DrawImage(
+            player->ili9341,
+            player->x + rect->x,
+            player->y + rect->y,
+            rect->width,
+            rect->height,
+            &animation->pixels[rect->offset]
+        );
+    }
+}
+
+void ILI9341_Animation_Start(
+    ILI9341_AnimationPlayer* player,
+    const ILI9341_HandleTypeDef* ili9341,
+    const ILI9341_Animation* animation,
+    int_fast16_t x,
+    int_fast16_t y,
+    uint_fast16_t repeat,
+    uint32_t tick
+) {
+    player->running = false;
+    if (animation->frameCount == 0 || animation->frameTime == 0) return;
+
+    player->ili9341 = ili9341;
+    player->animation = animation;
+    player->x = x;
+    player->y = y;
+    player->frame = 0;
+    player->repeat = repeat;
+    player->frameTick = tick;
+    player->running = true;
+
+    ILI9341_DrawImage(ili9341, x, y, animation->width, animation->height, animation->keyframe);
+}
+
+void ILI9341_Animation_Stop(ILI9341_AnimationPlayer* player) { player->running = false; }
+
+bool ILI9341_Animation_Update(ILI9341_AnimationPlayer* player, uint32_t tick) {
+    while (player->running) {
+        const ILI9341_Animation* animation = player->animation;
+        uint32_t elapsed = tick - player->frameTick;
+
+        if (elapsed < animation->frameTime) return true;
+
+        // catching up would take longer than a whole loop, the keyframe is redrawn and ends the current play
+        if (elapsed >= (uint32_t)animation->frameTime * animation->frameCount) {
+            ILI9341_DrawImage(
+                player->ili9341,
+                player->x,
+                player->y,
+                animation->width,
+                animation->height,
+                animation->keyframe
+            );
+            player->frame = 0;
+            player->frameTick = tick;
+            if (player->repeat > 0 && --player->repeat == 0) player->running = false;
+            continue;
+        }
+
+        uint_fast16_t next = player->frame + 1;
+        if (next == animation->frameCount) {
+            if (player->repeat > 0 && --player->repeat == 0) {
+                player->running = false;
+                return false;
+            }
+            next = 0;
+        }
+
+        // advance by the frame time so late updates don't slow the animation down
+        ILI9341_Animation_DrawFrame(player, next);
+        player->frame = next;
+        player->frameTick += animation->frameTime;
+    }
+
+    return false;
+}
@@ -0,0 +1,114 @@
+#include "ili9341_assets.h"
+#include "string.h"
+
+uint32_t ILI9341_Assets_Hash(const char* name) {
+    uint32_t hash = 2166136261u;
+
+    while (*name) {
+        hash ^= (uint8_t)*(name++);
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+
+const ILI9341_AssetHeader* ILI9341_Assets_Open(const void* address) {
+    const ILI9341_AssetHeader* bundle = address;
+
+    // erased flash reads as 0xFF, a bundle built for another address would have wrong glyph pointers
+    if (bundle->magic != ILI9341_ASSETS_MAGIC || bundle->version != ILI9341_ASSETS_VERSION ||
+        bundle->pointerSize != sizeof(void*) || bundle->base != (uintptr_t)address ||
+        bundle->size < sizeof(ILI9341_AssetHeader) + bundle->count * sizeof(ILI9341_AssetEntry))
+        return NULL;
+
+    // the index is checked once, lookups trust it
+    const ILI9341_AssetEntry* entries = (const ILI9341_AssetEntry*)(bundle + 1);
+    for (uint_fast16_t i = 0; i < bundle->count; i++) {
+        if (entries[i].offset % 4 || entries[i].offset > bundle->size ||
+            entries[i].size > bundle->size - entries[i].offset || (i > 0 && entries[i].id < entries[i - 1].id))
+            return NULL;
+    }
+
+    return bundle;
+}
+
+const ILI9341_AssetEntry* ILI9341_Assets_Find(const ILI9341_AssetHeader* bundle, uint32_t id, uint_fast16_t type) {
+    if (!bundle) return NULL;
+
+    const ILI9341_AssetEntry* entries = (const ILI9341_AssetEntry*)(bundle + 1);
+    size_t low = 0, high = bundle->count;
+
+    while (low < high) {
+        const size_t middle = (low + high) / 2;
+        if (entries[middle].id < id) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+
+    if (low >= bundle->count || entries[low].id != id || entries[low].type != type) return NULL;
+    return &entries[low];
+}
+
+ILI9341_FontDef ILI9341_Assets_GetFont(const ILI9341_AssetHeader* bundle, uint32_t id, ILI9341_FontDef fallback) {
+    const ILI9341_AssetEntry* entry = ILI9341_Assets_Find(bundle, id, ILI9341_ASSET_FONT);
+    if (!entry) return fallback;
+
+    const ILI9341_AssetFont* font = (const ILI9341_AssetFont*)((const uint8_t*)bundle + entry->offset);
+    if (entry->size < sizeof(ILI9341_AssetFont) || font->endCodepoint < font->startCodepoint ||
+        entry->size - sizeof(ILI9341_AssetFont) <
+            (font->endCodepoint - font->startCodepoint + 1) * sizeof(ILI9341_GlyphDef))
+        return fallback;
+
+    return (ILI9341_FontDef){
+        .startCodepoint = font->startCodepoint,
+        .endCodepoint = font->endCodepoint,
+        .averageWidth = font->averageWidth,
+        .ascent = font->ascent,
+        .descent = font->descent,
+        .glyphs = (const ILI9341_GlyphDef*)(font + 1)
+    };
+}
+
+bool ILI9341_Assets_GetImage(const ILI9341_AssetHeader* bundle, uint32_t id, ILI9341_AssetImage* image) {
+    const ILI9341_AssetEntry* entry = ILI9341_Assets_Find(bundle, id, ILI9341_ASSET_IMAGE);
+    if (!entry) return false;
+
+    // the payload must hold all the pixels its size announces
+    const uint16_t* payload = (const uint16_t*)((const uint8_t*)bundle + entry->offset);
+    if (entry->size < 2 * sizeof(uint16_t) ||
+        (entry->size - 2 * sizeof(uint16_t)) / sizeof(uint16_t) < (uint32_t)payload[0] * payload[1])
+        return false;
+
+    image->width = payload[0];
+    image->height = payload[1];
+    image->pixels = &payload[2];
+    return true;
+}
+
+bool ILI9341_Assets_GetCompressedImage(
+    const ILI9341_AssetHeader* bundle,
+    uint32_t id,
+    ILI9341_CompressedImage* image
+) {
+    const ILI9341_AssetEntry* entry = ILI9341_Assets_Find(bundle, id, ILI9341_ASSET_COMPRESSED_IMAGE);
+    if (!entry || entry->size < 2 * sizeof(uint16_t)) return false;
+
+    const uint16_t* payload = (const uint16_t*)((const uint8_t*)bundle + entry->offset);
+    image->width = payload[0];
+    image->height = payload[1];
+    image->size = entry->size - 2 * sizeof(uint16_t);
+    image->data = (const uint8_t*)&payload[2];
+    return true;
+}
+
+const char* ILI9341_Assets_GetString(const ILI9341_AssetHeader* bundle, uint32_t id, const char* fallback) {
+    const ILI9341_AssetEntry* entry = ILI9341_Assets_Find(bundle, id, ILI9341_ASSET_STRING);
+    if (!entry) return fallback;
+
+    const char* str = (const char*)bundle + entry->offset;
+    if (!memchr(str, '\0', entry->size)) return fallback;
+
+    return str;
+}
@@ -0,0 +1,118 @@
+#include "ili9341_band.h"
+
+#include "string.h"
+
+void ILI9341_Band_Init(ILI9341_Band* band, const ILI9341_HandleTypeDef* ili9341) {
+    band->ili9341 = ili9341;
+    for (uint_fast8_t i = 0; i < 2; i++)
+        ILI9341_DisplayList_Init(&band->lists[i], band->listBuffers[i], ILI9341_BAND_LIST_SIZE);
+    band->current = 0;
+    band->valid = false;
+    band->buffer = 0;
+    band->sending = false;
+}
+
+ILI9341_HandleTypeDef* ILI9341_Band_Begin(ILI9341_Band* band) {
+    // the list of the last frame becomes the previous one
+    band->current ^= 1;
+    ILI9341_DisplayList_Clear(&band->lists[band->current]);
+
+    band->recorder = *band->ili9341;
+    band->recorder.surface = NULL;
+    band->recorder.displayList = &band->lists[band->current];
+    band->recorder.clip = NULL;
+
+    return &band->recorder;
+}
+
+/**
+ * @brief Render an area of the current frame in strips and send them, one strip is sent while the next one is rendered
+ * @param band Pointer to the band renderer
+ * @param rect Area to render, inside the display
+ * @note The last strip may still be sending on return.
+ */
+static void ILI9341_Band_RenderRect(ILI9341_Band* band, const ILI9341_Rect* rect) {
+    const ILI9341_HandleTypeDef* ili9341 = band->ili9341;
+    const int_fast16_t width = rect->x1 - rect->x0 + 1;
+    const int_fast16_t rows = ILI9341_BAND_HEIGHT * ILI9341_BAND_MAX_WIDTH / width;
+
+    ILI9341_HandleTypeDef renderer = *ili9341;
+    ILI9341_Surface surface;
+    renderer.surface = &surface;
+    renderer.displayList = NULL;
+    renderer.clip = NULL;
+
+    for (int_fast16_t y = rect->y0; y <= rect->y1; y += rows) {
+        const int_fast16_t height = rect->y1 - y + 1 < rows ? rect->y1 - y + 1 : rows;
+        uint16_t* buffer = band->buffers[band->buffer];
+
+        // this buffer was sent two strips ago, the transfer of the previous strip may still be running
+        memset(buffer, 0, width * height * sizeof(uint16_t));
+        surface = (ILI9341_Surface){.buffer = buffer, .x = rect->x0, .y = y, .width = width, .height = height};
+        ILI9341_DisplayList_ExecuteRegion(
+            &band->lists[band->current], &renderer, rect->x0, y, rect->x1, y + height - 1
+        );
+
+        if (band->sending) ILI9341_WaitTransfer(ili9341);
+        ILI9341_StartTransfer(ili9341, rect->x0, y, rect->x1, y + height - 1, buffer);
+        band->sending = true;
+        band->buffer ^= 1;
+    }
+}
+
+/**
+ * @brief Wait for the last strip and mark the frame as shown
+ * @param band Pointer to the band renderer
+ * @return false if the display list of the frame overflowed
+ */
+static bool ILI9341_Band_Finish(ILI9341_Band* band) {
+    if (band->sending) ILI9341_WaitTransfer(band->ili9341);
+    band->sending = false;
+    band->valid = true;
+
+    return !band->lists[band->current].overflow;
+}
+
+bool ILI9341_Band_End(ILI9341_Band* band) {
+    const ILI9341_HandleTypeDef* ili9341 = band->ili9341;
+    const ILI9341_Rect screen = {
+        .x0 = 0,
+        .y0 = 0,
+        .x1 = (ili9341->width < ILI9341_BAND_MAX_WIDTH ? ili9341->width : ILI9341_BAND_MAX_WIDTH) - 1,
+        .y1 = ili9341->height - 1
+    };
+
+    ILI9341_Band_RenderRect(band, &screen);
+
+    return ILI9341_Band_Finish(band);
+}
+
+bool ILI9341_Band_Update(ILI9341_Band* band) {
+    const ILI9341_HandleTypeDef* ili9341 = band->ili9341;
+    const ILI9341_DisplayList* current = &band->lists[band->current];
+    const ILI9341_DisplayList* previous = &band->lists[band->current ^ 1];
+
+    if (!band->valid || current->overflow || previous->overflow) return ILI9341_Band_End(band);
+
+    ILI9341_Rect rects[ILI9341_BAND_MAX_RECTS];
+    size_t count = ILI9341_DisplayList_Diff(previous, current, rects, ILI9341_BAND_MAX_RECTS);
+
+    for (size_t i = 0; i < count; i++) {
+        ILI9341_Rect* rect = &rects[i];
+
+        if (rect->x0 < 0) rect->x0 = 0;
+        if (rect->y0 < 0) rect->y0 = 0;
+        if (rect->x1 >= ili9341->width) rect->x1 = ili9341->width - 1;
+        if (rect->y1 >= ili9341->height) rect->y1 = ili9341->height - 1;
+        if (rect->x1 >= ILI9341_BAND_MAX_WIDTH) rect->x1 = ILI9341_BAND_MAX_WIDTH - 1;
+        if (rect->x0 > rect->x1 || rect->y0 > rect->y1) continue;
+
+        ILI9341_Band_RenderRect(band, rect);
+    }
+
+    return ILI9341_Band_Finish(band);
+}
+
+void ILI9341_Band_Invalidate(ILI9341_Band* band) {
+    band->valid = false;
+}
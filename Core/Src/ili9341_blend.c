@@ -0,0 +1,337 @@
+#include "ili9341_blend.h"
+
+#include "string.h"
+
+// Two pixels in native order spread over two words, each component has room above it for a product by up to 32
+#define ILI9341_BLEND_MASK_A 0x07E0F81F  // blue and red of the first pixel, green of the second
+#define ILI9341_BLEND_MASK_B 0x07C0F83F  // shifted right by 5: green of the first pixel, blue and red of the second
+// Half of 32 in each component of the spread words, rounds the blends to nearest
+#define ILI9341_BLEND_ROUND_A 0x02008010
+#define ILI9341_BLEND_ROUND_B 0x04008010
+
+// Source of a blended area, rows of w pixels
+typedef struct {
+    /** Image pixels, NULL for a color */
+    const uint16_t* pixels;
+    /** Alpha of each pixel, 8 or 4 bits, NULL for one alpha */
+    const uint8_t* alpha;
+    uint16_t color;
+    uint_fast8_t constantAlpha;
+    /** alpha is a 4-bit mask */
+    bool mask;
+} ILI9341_BlendSource;
+
+/**
+ * @brief Convert an alpha to the weight of the kernels
+ * @param alpha Alpha, 0 to ILI9341_BLEND_OPAQUE
+ * @return Weight, 0 to 32
+ */
+static inline uint_fast8_t ILI9341_Blend_Weight(uint_fast8_t alpha) {
+    return (alpha + 4) >> 3;
+}
+
+/**
+ * @brief Swap the 2 bytes of both pixels of a word
+ * @param pair Two pixels
+ * @return The two pixels with their bytes swapped
+ */
+static inline uint32_t ILI9341_Blend_SwapPair(uint32_t pair) {
+    return ((pair >> 8) & 0x00FF00FF) | ((pair << 8) & 0xFF00FF00);
+}
+
+/**
+ * @brief Read two neighbor pixels as one word, the buffers are only 2-byte aligned
+ * @param pixels Pixels in RGB565 format with the 2 bytes swapped
+ * @return The two pixels in native order, the first one in the low half (little-endian)
+ */
+static inline uint32_t ILI9341_Blend_Load(const uint16_t* pixels) {
+    uint32_t pair;
+    memcpy(&pair, pixels, sizeof(pair));
+    return ILI9341_Blend_SwapPair(pair);
+}
+
+/**
+ * @brief Write two neighbor pixels from one word
+ * @param pixels Pixels in RGB565 format with the 2 bytes swapped
+ * @param pair The two pixels in native order, the first one in the low half
+ */
+static inline void ILI9341_Blend_Store(uint16_t* pixels, uint32_t pair) {
+    pair = ILI9341_Blend_SwapPair(pair);
+    memcpy(pixels, &pair, sizeof(pair));
+}
+
+/**
+ * @brief Blend two pixels over two pixels
+ * @param src Pixels blended, native order
+ * @param dst Pixels blended over, native order
+ * @param weight Weight of src, 0 to 32
+ * @return The two blended pixels, native order
+ */
+static inline uint32_t ILI9341_Blend_Pair(uint32_t src, uint32_t dst, uint_fast8_t weight) {
+    const uint_fast8_t inverse = 32 - weight;
+    const uint32_t a = (src & ILI9341_BLEND_MASK_A) * weight + (dst & ILI9341_BLEND_MASK_A) * inverse +
+                       ILI9341_BLEND_ROUND_A;
+    const uint32_t b = ((src >> 5) & ILI9341_BLEND_MASK_B) * weight + ((dst >> 5) & ILI9341_BLEND_MASK_B) * inverse +
+                       ILI9341_BLEND_ROUND_B;
+    return ((a >> 5) & ILI9341_BLEND_MASK_A) | ((b >> 5) & ILI9341_BLEND_MASK_B) << 5;
+}
+
+/**
+ * @brief Blend one pixel over one pixel, its three components spread over one word
+ * @param src Pixel blended, RGB565 format with the 2 bytes swapped
+ * @param dst Pixel blended over, RGB565 format with the 2 bytes swapped
+ * @param weight Weight of src, 0 to 32
+ * @return The blended pixel, RGB565 format with the 2 bytes swapped
+ */
+static inline uint16_t ILI9341_Blend_Pixel(uint16_t src, uint16_t dst, uint_fast8_t weight) {
+    const uint32_t s = (uint16_t)((src >> 8) | (src << 8)), d = (uint16_t)((dst >> 8) | (dst << 8));
+    const uint32_t spread = (((s | s << 16) & ILI9341_BLEND_MASK_A) * weight +
+                             ((d | d << 16) & ILI9341_BLEND_MASK_A) * (32 - weight) + ILI9341_BLEND_ROUND_A) >>
+                            5;
+    const uint16_t color = ((spread & ILI9341_BLEND_MASK_A) | (spread & ILI9341_BLEND_MASK_A) >> 16) & 0xFFFF;
+    return (color >> 8) | (color << 8);
+}
+
+void ILI9341_Blend_Constant(uint16_t* dst, const uint16_t* src, size_t count, uint_fast8_t alpha) {
+    const uint_fast8_t weight = ILI9341_Blend_Weight(alpha);
+    if (weight == 0) return;
+    if (weight == 32) {
+        memmove(dst, src, count * sizeof(uint16_t));
+        return;
+    }
+
+    size_t i = 0;
+    for (; i + 1 < count; i += 2) {
+        const uint32_t blend = ILI9341_Blend_Pair(ILI9341_Blend_Load(&src[i]), ILI9341_Blend_Load(&dst[i]), weight);
+        ILI9341_Blend_Store(&dst[i], blend);
+    }
+    if (i < count) dst[i] = ILI9341_Blend_Pixel(src[i], dst[i], weight);
+}
+
+void ILI9341_Blend_Color(uint16_t* dst, uint16_t color, size_t count, uint_fast8_t alpha) {
+    const uint_fast8_t weight = ILI9341_Blend_Weight(alpha), inverse = 32 - weight;
+    const uint16_t swapped = (color >> 8) | (color << 8);
+    if (weight == 0) return;
+    if (weight == 32) {
+        for (size_t i = 0; i < count; i++) dst[i] = swapped;
+        return;
+    }
+
+    // the products of the color are the same for every pair, one multiply per word is left
+    const uint32_t pair = (uint32_t)color << 16 | color;
+    const uint32_t a = (pair & ILI9341_BLEND_MASK_A) * weight + ILI9341_BLEND_ROUND_A;
+    const uint32_t b = ((pair >> 5) & ILI9341_BLEND_MASK_B) * weight + ILI9341_BLEND_ROUND_B;
+
+    size_t i = 0;
+    for (; i + 1 < count; i += 2) {
+        const uint32_t d = ILI9341_Blend_Load(&dst[i]);
+        const uint32_t blendA = (a + (d & ILI9341_BLEND_MASK_A) * inverse) >> 5;
+        const uint32_t blendB = (b + ((d >> 5) & ILI9341_BLEND_MASK_B) * inverse) >> 5;
+        ILI9341_Blend_Store(&dst[i], (blendA & ILI9341_BLEND_MASK_A) | (blendB & ILI9341_BLEND_MASK_B) << 5);
+    }
+    if (i < count) dst[i] = ILI9341_Blend_Pixel(swapped, dst[i], weight);
+}
+
+void ILI9341_Blend_Alpha(uint16_t* dst, const uint16_t* src, const uint8_t* alpha, size_t count) {
+    size_t i = 0;
+    for (; i + 1 < count; i += 2) {
+        const uint_fast8_t w0 = ILI9341_Blend_Weight(alpha[i]), w1 = ILI9341_Blend_Weight(alpha[i + 1]);
+
+        if (w0 != w1) {
+            dst[i] = ILI9341_Blend_Pixel(src[i], dst[i], w0);
+            dst[i + 1] = ILI9341_Blend_Pixel(src[i + 1], dst[i + 1], w1);
+        } else if (w0 == 32) {
+            memcpy(&dst[i], &src[i], 2 * sizeof(uint16_t));
+        } else if (w0 > 0) {
+            const uint32_t blend = ILI9341_Blend_Pair(ILI9341_Blend_Load(&src[i]), ILI9341_Blend_Load(&dst[i]), w0);
+            ILI9341_Blend_Store(&dst[i], blend);
+        }
+    }
+    if (i < count) dst[i] = ILI9341_Blend_Pixel(src[i], dst[i], ILI9341_Blend_Weight(alpha[i]));
+}
+
+/**
+ * @brief Get the weight of a pixel of a 4-bit mask
+ * @param alpha 4-bit mask
+ * @param offset Position of the pixel in the mask
+ * @return Weight, 0 to 32
+ */
+static inline uint_fast8_t ILI9341_Blend_Weight4(const uint8_t* alpha, size_t offset) {
+    const uint_fast8_t level = (alpha[offset >> 1] >> (offset & 1 ? 0 : 4)) & 0x0F;
+    return ILI9341_Blend_Weight(level * 17);
+}
+
+void ILI9341_Blend_Alpha4(uint16_t* dst, uint16_t color, const uint8_t* alpha, size_t offset, size_t count) {
+    const uint16_t swapped = (color >> 8) | (color << 8);
+    const uint32_t pair = (uint32_t)color << 16 | color;
+    size_t i = 0;
+
+    // pairs start on a byte of the mask
+    if (count > 0 && offset & 1) {
+        dst[0] = ILI9341_Blend_Pixel(swapped, dst[0], ILI9341_Blend_Weight4(alpha, offset));
+        i = 1;
+    }
+
+    for (; i + 1 < count; i += 2) {
+        const uint_fast8_t w0 = ILI9341_Blend_Weight4(alpha, offset + i);
+        const uint_fast8_t w1 = ILI9341_Blend_Weight4(alpha, offset + i + 1);
+
+        if (w0 != w1) {
+            dst[i] = ILI9341_Blend_Pixel(swapped, dst[i], w0);
+            dst[i + 1] = ILI9341_Blend_Pixel(swapped, dst[i + 1], w1);
+        } else if (w0 == 32) {
+            dst[i] = dst[i + 1] = swapped;
+        } else if (w0 > 0) {
+            ILI9341_Blend_Store(&dst[i], ILI9341_Blend_Pair(pair, ILI9341_Blend_Load(&dst[i]), w0));
+        }
+    }
+    if (i < count) dst[i] = ILI9341_Blend_Pixel(swapped, dst[i], ILI9341_Blend_Weight4(alpha, offset + i));
+}
+
+/**
+ * @brief Read a run of pixels of a row of a surface
+ * @param surface Surface to read
+ * @param x X coordinate of the first pixel, in drawing coordinates, inside the surface
+ * @param y Y coordinate of the row, in drawing coordinates, inside the surface
+ * @param pixels Output pixels in RGB565 format with the 2 bytes swapped, palette colors for indexed surfaces
+ * @param count Number of pixels, all inside the surface
+ */
+static void ILI9341_Blend_ReadSurface(
+    const ILI9341_Surface* surface,
+    int_fast16_t x,
+    int_fast16_t y,
+    uint16_t* pixels,
+    size_t count
+) {
+    const int_fast16_t row = y - surface->y, column = x - surface->x;
+
+    if (!surface->bpp) {
+        memcpy(pixels, (const uint16_t*)surface->buffer + row * surface->width + column, count * sizeof(uint16_t));
+        return;
+    }
+
+    const uint_fast8_t bpp = surface->bpp;
+    const uint_fast8_t mask = (1 << bpp) - 1;
+    const uint8_t* line = (const uint8_t*)surface->buffer + row * ((surface->width * bpp + 7) / 8);
+
+    for (size_t i = 0; i < count; i++) {
+        uint_fast32_t bit = (uint_fast32_t)(column + i) * bpp;
+        pixels[i] = surface->palette[(line[bit >> 3] >> (8 - bpp - (bit & 7))) & mask];
+    }
+}
+
+/**
+ * @brief Blend a source over the surface of a handle, row by row through a line buffer
+ * @param target Pointer to ILI9341 handle structure
+ * @param x X coordinate of the top-left corner of the source
+ * @param y Y coordinate of the top-left corner of the source
+ * @param w Width of the source
+ * @param h Height of the source
+ * @param source Pixels and alpha of the source
+ * @return false if the handle has no surface to read back
+ * @note The blended rows are written with ILI9341_DrawImage, which applies the clip stack and the palette of indexed
+ * surfaces.
+ */
+static bool ILI9341_Blend_Area(
+    const ILI9341_HandleTypeDef* target,
+    int_fast16_t x,
+    int_fast16_t y,
+    int_fast16_t w,
+    int_fast16_t h,
+    const ILI9341_BlendSource* source
+) {
+    const ILI9341_Surface* surface = target->surface;
+    if (!surface || target->displayList) return false;
+    if (w <= 0 || h <= 0) return true;
+
+    // the part inside both the handle and its surface
+    int_fast16_t x0 = x, y0 = y, x1 = x + w - 1, y1 = y + h - 1;
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x0 < surface->x) x0 = surface->x;
+    if (y0 < surface->y) y0 = surface->y;
+    if (x1 >= target->width) x1 = target->width - 1;
+    if (y1 >= target->height) y1 = target->height - 1;
+    if (x1 >= surface->x + surface->width) x1 = surface->x + surface->width - 1;
+    if (y1 >= surface->y + surface->height) y1 = surface->y + surface->height - 1;
+
+    const size_t maskStride = (w + 1) / 2;
+    uint16_t line[ILI9341_DRAW_IMAGE_BUFFER_SIZE];
+
+    for (int_fast16_t row = y0; row <= y1; row++) {
+        for (int_fast16_t col = x0; col <= x1;) {
+            size_t n = x1 - col + 1;
+            if (n > ILI9341_DRAW_IMAGE_BUFFER_SIZE) n = ILI9341_DRAW_IMAGE_BUFFER_SIZE;
+
+            const size_t offset = (size_t)(row - y) * w + col - x;
+            ILI9341_Blend_ReadSurface(surface, col, row, line, n);
+
+            if (source->mask) {
+                ILI9341_Blend_Alpha4(line, source->color, source->alpha, (row - y) * maskStride * 2 + col - x, n);
+            } else if (source->alpha) {
+                ILI9341_Blend_Alpha(line, &source->pixels[offset], &source->alpha[offset], n);
+            } else if (source->pixels) {
+                ILI9341_Blend_Constant(line, &source->pixels[offset], n, source->constantAlpha);
+            } else {
+                ILI9341_Blend_Color(line, source->color, n, source->constantAlpha);
+            }
+
+            ILI9341_DrawImage(target, col, row, n, 1, line);
+            col += n;
+        }
+    }
+
+    return true;
+}
+
+bool ILI9341_Blend_FillRectangle(
+    const ILI9341_HandleTypeDef* target,
+    int_fast16_t x,
+    int_fast16_t y,
+    int_fast16_t w,
+    int_fast16_t h,
+    uint16_t color,
+    uint_fast8_t alpha
+) {
+    const ILI9341_BlendSource source = {.color = color, .constantAlpha = alpha};
+    return ILI9341_Blend_Area(target, x, y, w, h, &source);
+}
+
+bool ILI9341_Blend_DrawImage(
+    const ILI9341_HandleTypeDef* target,
+    int_fast16_t x,
+    int_fast16_t y,
+    int_fast16_t w,
+    int_fast16_t h,
+    const uint16_t* data,
+    uint_fast8_t alpha
+) {
+    const ILI9341_BlendSource source = {.pixels = data, .constantAlpha = alpha};
+    return ILI9341_Blend_Area(target, x, y, w, h, &source);
+}
+
+bool ILI9341_Blend_DrawImageAlpha(
+    const ILI9341_HandleTypeDef* target,
+    int_fast16_t x,
+    int_fast16_t y,
+    int_fast16_t w,
+    int_fast16_t h,
+    const uint16_t* data,
+    const uint8_t* alpha
+) {
+    const ILI9341_BlendSource source = {.pixels = data, .alpha = alpha};
+    return ILI9341_Blend_Area(target, x, y, w, h, &source);
+}
+
+bool ILI9341_Blend_DrawMask(
+    const ILI9341_HandleTypeDef* target,
+    int_fast16_t x,
+    int_fast16_t y,
+    int_fast16_t w,
+    int_fast16_t h,
+    const uint8_t* mask,
+    uint16_t color
+) {
+    const ILI9341_BlendSource source = {.alpha = mask, .color = color, .mask = true};
+    return ILI9341_Blend_Area(target, x, y, w, h, &source);
+}
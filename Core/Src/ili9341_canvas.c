@@ -0,0 +1,41 @@
+#include "ili9341_canvas.h"
+
+ILI9341_HandleTypeDef* ILI9341_Canvas_Init(
+    ILI9341_Canvas* canvas,
+    const ILI9341_HandleTypeDef* ili9341,
+    uint16_t* pixels,
+    int_fast16_t width,
+    int_fast16_t height
+) {
+    canvas->surface = (ILI9341_Surface){.buffer = pixels, .x = 0, .y = 0, .width = width, .height = height};
+
+    // the primitives clip to the size of the handle
+    canvas->drawer = *ili9341;
+    canvas->drawer.width = width;
+    canvas->drawer.height = height;
+    canvas->drawer.surface = &canvas->surface;
+    canvas->drawer.displayList = NULL;
+    canvas->drawer.clip = NULL;
+
+    return &canvas->drawer;
+}
+
+void ILI9341_Canvas_Blit(
+    const ILI9341_Canvas* canvas,
+    const ILI9341_HandleTypeDef* target,
+    int_fast16_t x,
+    int_fast16_t y
+) {
+    const ILI9341_Surface* surface = &canvas->surface;
+    const int_fast16_t x1 = x + surface->width - 1;
+    const int_fast16_t y1 = y + surface->height - 1;
+
+    // the rows of a canvas inside the target are contiguous, one transfer sends them all
+    if (!target->displayList && x >= 0 && y >= 0 && x1 < target->width && y1 < target->height) {
+        ILI9341_StartTransfer(target, x, y, x1, y1, surface->buffer);
+        ILI9341_WaitTransfer(target);
+        return;
+    }
+
+    ILI9341_DrawImage(target, x, y, surface->width, surface->height, surface->buffer);
+}
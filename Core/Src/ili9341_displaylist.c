@@ -0,0 +1,345 @@
+#include "ili9341_displaylist.h"
+
+#include "string.h"
+
+void ILI9341_DisplayList_Init(ILI9341_DisplayList* list, uint8_t* buffer, size_t capacity) {
+    list->buffer = buffer;
+    list->capacity = capacity;
+    ILI9341_DisplayList_Clear(list);
+}
+
+void ILI9341_DisplayList_Clear(ILI9341_DisplayList* list) {
+    list->used = 0;
+    list->count = 0;
+    list->overflow = false;
+}
+
+const ILI9341_DisplayOp* ILI9341_DisplayList_Next(const ILI9341_DisplayList* list, const ILI9341_DisplayOp* op) {
+    size_t offset = op ? (const uint8_t*)op - list->buffer + op->size : 0;
+    return offset < list->used ? (const ILI9341_DisplayOp*)&list->buffer[offset] : NULL;
+}
+
+void ILI9341_DisplayList_ExecuteOp(const ILI9341_DisplayOp* op, const ILI9341_HandleTypeDef* ili9341) {
+    const int16_t* args = op->args;
+
+    // fills replay with the paint they were recorded with, on a copy of the handle
+    const ILI9341_Paint* paint = ili9341->paint;
+    if (op->type == ILI9341_OP_FILL_RECTANGLE || op->type == ILI9341_OP_FILL_CIRCLE ||
+        op->type == ILI9341_OP_FILL_ELLIPSE || op->type == ILI9341_OP_FILL_POLYGON) {
+        paint = op->data;
+    } else if (op->type == ILI9341_OP_FILL_PATH) {
+        memcpy(&paint, op + 1, sizeof(paint));
+    }
+
+    ILI9341_HandleTypeDef painted;
+    if (paint != ili9341->paint) {
+        painted = *ili9341;
+        painted.paint = paint;
+        ili9341 = &painted;
+    }
+
+    switch (op->type) {
+        case ILI9341_OP_PIXEL:
+            ILI9341_DrawPixel(ili9341, args[0], args[1], op->color);
+            break;
+        case ILI9341_OP_FILL_RECTANGLE:
+            ILI9341_FillRectangle(ili9341, args[0], args[1], args[2], args[3], op->color);
+            break;
+        case ILI9341_OP_STRING:
+        case ILI9341_OP_STRING_TRANSPARENT: {
+            const ILI9341_FontDef font = {
+                op->fontStartCodepoint,
+                op->fontEndCodepoint,
+                op->fontAverageWidth,
+                op->fontAscent,
+                op->fontDescent,
+                op->data
+            };
+            const char* str = (const char*)(op + 1);
+
+            if (op->type == ILI9341_OP_STRING) {
+                ILI9341_WriteString(
+                    ili9341, args[0], args[1], str, font, op->color, op->bgColor, op->flags, args[2], args[3], args[4]
+                );
+            } else {
+                ILI9341_WriteStringTransparent(
+                    ili9341, args[0], args[1], str, font, op->color, op->flags, args[2], args[3], args[4]
+                );
+            }
+            break;
+        }
+        case ILI9341_OP_IMAGE:
+            ILI9341_DrawImage(ili9341, args[0], args[1], args[2], args[3], op->data);
+            break;
+        case ILI9341_OP_GLYPH:
+            ILI9341_DrawGlyph(ili9341, args[0], args[1], op->data, op->color, op->bgColor, args[2]);
+            break;
+        case ILI9341_OP_IMAGE_COMPRESSED:
+            ILI9341_DrawImageCompressed(ili9341, args[0], args[1], op->data);
+            break;
+        case ILI9341_OP_IMAGE_SCALED:
+            ILI9341_DrawImageScaled(ili9341, args[0], args[1], args[2], args[3], op->data, args[4], args[5], op->flags);
+            break;
+        case ILI9341_OP_FILL_PATH:
+            ILI9341_FillPath(ili9341, args[0], args[1], op->data, (uint16_t)args[2], op->flags, op->color);
+            break;
+        case ILI9341_OP_IMAGE_TRANSPARENT: {
+            const uint8_t* mask;
+            memcpy(&mask, op + 1, sizeof(mask));
+            ILI9341_DrawImageTransparent(ili9341, args[0], args[1], args[2], args[3], op->data, mask, op->color);
+            break;
+        }
+        case ILI9341_OP_LINE:
+            ILI9341_DrawLine(ili9341, args[0], args[1], args[2], args[3], op->color);
+            break;
+        case ILI9341_OP_RECTANGLE:
+            ILI9341_DrawRectangleThick(ili9341, args[0], args[1], args[2], args[3], op->color, args[4]);
+            break;
+        case ILI9341_OP_CIRCLE:
+            ILI9341_DrawCircle(ili9341, args[0], args[1], args[2], op->color);
+            break;
+        case ILI9341_OP_CIRCLE_THICK:
+            ILI9341_DrawCircleThick(ili9341, args[0], args[1], args[2], op->color, args[3]);
+            break;
+        case ILI9341_OP_FILL_CIRCLE:
+            ILI9341_FillCircle(ili9341, args[0], args[1], args[2], op->color);
+            break;
+        case ILI9341_OP_ELLIPSE:
+            ILI9341_DrawEllipse(ili9341, args[0], args[1], args[2], args[3], op->color);
+            break;
+        case ILI9341_OP_ELLIPSE_THICK:
+            ILI9341_DrawEllipseThick(ili9341, args[0], args[1], args[2], args[3], op->color, args[4]);
+            break;
+        case ILI9341_OP_FILL_ELLIPSE:
+            ILI9341_FillEllipse(ili9341, args[0], args[1], args[2], args[3], op->color);
+            break;
+        case ILI9341_OP_POLYGON:
+        case ILI9341_OP_FILL_POLYGON: {
+            // the primitives take non-const points but don't modify them
+            int16_t* x = (int16_t*)(op + 1);
+            int16_t* y = x + args[0];
+
+            if (op->type == ILI9341_OP_POLYGON) {
+                ILI9341_DrawPolygon(ili9341, x, y, args[0], op->color);
+            } else {
+                ILI9341_FillPolygon(ili9341, x, y, args[0], op->color);
+            }
+            break;
+        }
+    }
+}
+
+void ILI9341_DisplayList_Execute(const ILI9341_DisplayList* list, const ILI9341_HandleTypeDef* ili9341) {
+    for (const ILI9341_DisplayOp* op = ILI9341_DisplayList_Next(list, NULL); op; op = ILI9341_DisplayList_Next(list, op)) {
+        ILI9341_DisplayList_ExecuteOp(op, ili9341);
+    }
+}
+
+void ILI9341_DisplayList_ExecuteRegion(
+    const ILI9341_DisplayList* list,
+    const ILI9341_HandleTypeDef* ili9341,
+    int_fast16_t x0,
+    int_fast16_t y0,
+    int_fast16_t x1,
+    int_fast16_t y1
+) {
+    for (const ILI9341_DisplayOp* op = ILI9341_DisplayList_Next(list, NULL); op; op = ILI9341_DisplayList_Next(list, op)) {
+        if (op->x1 < x0 || op->x0 > x1 || op->y1 < y0 || op->y0 > y1) continue;
+        ILI9341_DisplayList_ExecuteOp(op, ili9341);
+    }
+}
+
+/**
+ * @brief Get the size of the string or polygon points following an op, without the alignment padding
+ * @param op Pointer to the op
+ */
+static size_t ILI9341_DisplayList_GetDataSize(const ILI9341_DisplayOp* op) {
+    switch (op->type) {
+        case ILI9341_OP_STRING:
+        case ILI9341_OP_STRING_TRANSPARENT:
+            return strlen((const char*)(op + 1)) + 1;
+        case ILI9341_OP_POLYGON:
+        case ILI9341_OP_FILL_POLYGON:
+            return 2 * sizeof(int16_t) * op->args[0];
+        case ILI9341_OP_IMAGE_TRANSPARENT:
+            return sizeof(const uint8_t*);
+        case ILI9341_OP_FILL_PATH:
+            return sizeof(const ILI9341_Paint*);
+        default:
+            return 0;
+    }
+}
+
+/**
+ * @brief Check if two ops draw the same pixels
+ * @param a Pointer to the first op
+ * @param b Pointer to the second op
+ * @note Compared field by field, the struct padding is not initialized.
+ */
+static bool ILI9341_DisplayList_IsSameOp(const ILI9341_DisplayOp* a, const ILI9341_DisplayOp* b) {
+    return a->type == b->type && a->flags == b->flags && a->size == b->size && a->x0 == b->x0 && a->y0 == b->y0 &&
+           a->x1 == b->x1 && a->y1 == b->y1 && memcmp(a->args, b->args, sizeof(a->args)) == 0 &&
+           a->color == b->color && a->bgColor == b->bgColor && a->data == b->data &&
+           a->fontStartCodepoint == b->fontStartCodepoint && a->fontEndCodepoint == b->fontEndCodepoint &&
+           a->fontAverageWidth == b->fontAverageWidth && a->fontAscent == b->fontAscent &&
+           a->fontDescent == b->fontDescent && memcmp(a + 1, b + 1, ILI9341_DisplayList_GetDataSize(a)) == 0;
+}
+
+/**
+ * @brief Add an area to a set of areas, merging it with the areas it overlaps or touches
+ * @param rects Array of areas
+ * @param count Pointer to the number of areas in the array
+ * @param maxRects Size of the array
+ * @param x0 X coordinate of the top-left corner of the area
+ * @param y0 Y coordinate of the top-left corner of the area
+ * @param x1 X coordinate of the bottom-right corner of the area (inclusive)
+ * @param y1 Y coordinate of the bottom-right corner of the area (inclusive)
+ */
+static void ILI9341_DisplayList_AddRect(
+    ILI9341_Rect* rects,
+    size_t* count,
+    size_t maxRects,
+    int_fast16_t x0,
+    int_fast16_t y0,
+    int_fast16_t x1,
+    int_fast16_t y1
+) {
+    // the merged area can reach areas it did not touch before, restart after each merge
+    for (size_t i = 0; i < *count;) {
+        const ILI9341_Rect* rect = &rects[i];
+
+        if (rect->x0 > x1 + 1 || rect->x1 + 1 < x0 || rect->y0 > y1 + 1 || rect->y1 + 1 < y0) {
+            i++;
+            continue;
+        }
+
+        if (rect->x0 < x0) x0 = rect->x0;
+        if (rect->y0 < y0) y0 = rect->y0;
+        if (rect->x1 > x1) x1 = rect->x1;
+        if (rect->y1 > y1) y1 = rect->y1;
+        rects[i] = rects[--*count];
+        i = 0;
+    }
+
+    size_t index = *count;
+    if (index < maxRects) {
+        (*count)++;
+    } else {
+        // no room left, grow the area that grows the least
+        int_fast32_t bestGrowth = INT32_MAX;
+        for (size_t i = 0; i < *count; i++) {
+            const ILI9341_Rect* rect = &rects[i];
+            int_fast32_t width = (x1 > rect->x1 ? x1 : rect->x1) - (x0 < rect->x0 ? x0 : rect->x0) + 1;
+            int_fast32_t height = (y1 > rect->y1 ? y1 : rect->y1) - (y0 < rect->y0 ? y0 : rect->y0) + 1;
+            int_fast32_t growth = width * height - (int_fast32_t)(rect->x1 - rect->x0 + 1) * (rect->y1 - rect->y0 + 1);
+
+            if (growth < bestGrowth) {
+                bestGrowth = growth;
+                index = i;
+            }
+        }
+
+        const ILI9341_Rect* rect = &rects[index];
+        if (rect->x0 < x0) x0 = rect->x0;
+        if (rect->y0 < y0) y0 = rect->y0;
+        if (rect->x1 > x1) x1 = rect->x1;
+        if (rect->y1 > y1) y1 = rect->y1;
+    }
+
+    rects[index] = (ILI9341_Rect){.x0 = x0, .y0 = y0, .x1 = x1, .y1 = y1};
+}
+
+size_t ILI9341_DisplayList_Diff(
+    const ILI9341_DisplayList* previous,
+    const ILI9341_DisplayList* current,
+    ILI9341_Rect* rects,
+    size_t maxRects
+) {
+    const ILI9341_DisplayOp* previousOp = ILI9341_DisplayList_Next(previous, NULL);
+    const ILI9341_DisplayOp* currentOp = ILI9341_DisplayList_Next(current, NULL);
+    size_t count = 0;
+
+    if (maxRects == 0) return 0;
+
+    while (previousOp || currentOp) {
+        if (!previousOp || !currentOp || !ILI9341_DisplayList_IsSameOp(previousOp, currentOp)) {
+            // the pixels of the old op must be repainted, the new op must be drawn
+            if (previousOp) {
+                ILI9341_DisplayList_AddRect(
+                    rects, &count, maxRects, previousOp->x0, previousOp->y0, previousOp->x1, previousOp->y1
+                );
+            }
+            if (currentOp) {
+                ILI9341_DisplayList_AddRect(
+                    rects, &count, maxRects, currentOp->x0, currentOp->y0, currentOp->x1, currentOp->y1
+                );
+            }
+        }
+
+        if (previousOp) previousOp = ILI9341_DisplayList_Next(previous, previousOp);
+        if (currentOp) currentOp = ILI9341_DisplayList_Next(current, currentOp);
+    }
+
+    return count;
+}
+
+size_t ILI9341_DisplayList_Serialize(const ILI9341_DisplayList* list, uint8_t* buffer, size_t size) {
+    const ILI9341_DisplayListHeader header = {
+        .magic = ILI9341_DISPLAYLIST_MAGIC,
+        .count = list->count,
+        .size = list->used
+    };
+
+    if (list->overflow || size < sizeof(header) + list->used) return 0;
+
+    memcpy(buffer, &header, sizeof(header));
+    memcpy(buffer + sizeof(header), list->buffer, list->used);
+
+    return sizeof(header) + list->used;
+}
+
+bool ILI9341_DisplayList_Deserialize(ILI9341_DisplayList* list, const uint8_t* data, size_t size) {
+    ILI9341_DisplayListHeader header;
+
+    ILI9341_DisplayList_Clear(list);
+
+    if (size < sizeof(header)) return false;
+    memcpy(&header, data, sizeof(header));
+    if (header.magic != ILI9341_DISPLAYLIST_MAGIC || header.size > size - sizeof(header) ||
+        header.size > list->capacity)
+        return false;
+
+    memcpy(list->buffer, data + sizeof(header), header.size);
+
+    // check every op before accepting the list, the ops are replayed without checks
+    size_t offset = 0, count = 0;
+    while (offset < header.size) {
+        if (header.size - offset < sizeof(ILI9341_DisplayOp)) return false;
+
+        const ILI9341_DisplayOp* op = (const ILI9341_DisplayOp*)&list->buffer[offset];
+        if (op->size < sizeof(ILI9341_DisplayOp) || op->size % 4 != 0 || op->size > header.size - offset ||
+            op->type > ILI9341_OP_FILL_PATH)
+            return false;
+
+        size_t dataCapacity = op->size - sizeof(ILI9341_DisplayOp);
+
+        if (op->type == ILI9341_OP_STRING || op->type == ILI9341_OP_STRING_TRANSPARENT) {
+            if (!memchr(op + 1, '\0', dataCapacity)) return false;
+        } else if (op->type == ILI9341_OP_POLYGON || op->type == ILI9341_OP_FILL_POLYGON) {
+            if (op->args[0] < 1 || 2 * sizeof(int16_t) * op->args[0] > dataCapacity) return false;
+        } else if (op->type == ILI9341_OP_IMAGE_TRANSPARENT) {
+            if (sizeof(const uint8_t*) > dataCapacity) return false;
+        } else if (op->type == ILI9341_OP_FILL_PATH) {
+            if (sizeof(const ILI9341_Paint*) > dataCapacity) return false;
+        }
+
+        offset += op->size;
+        count++;
+    }
+    if (count != header.count) return false;
+
+    list->used = header.size;
+    list->count = count;
+
+    return true;
+}
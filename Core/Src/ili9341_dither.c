@@ -0,0 +1,146 @@
+#include "ili9341_dither.h"
+
+#include "string.h"
+
+// Thresholds of the 4x4 Bayer matrix, (2 * level + 1) * 255 / 32, added before dividing by 255
+static const uint8_t ILI9341_Dither_Thresholds[4][4] = {
+    {7, 135, 39, 167},
+    {199, 71, 231, 103},
+    {55, 183, 23, 151},
+    {247, 119, 215, 87}
+};
+
+/**
+ * @brief Divide by 255, exact for values up to 65534
+ * @param value Value to divide
+ * @return value / 255
+ */
+static inline uint_fast16_t ILI9341_Dither_Divide255(uint_fast16_t value) {
+    return (value + 1 + (value >> 8)) >> 8;
+}
+
+/**
+ * @brief Pack the components of a pixel
+ * @param dither Pointer to the converter
+ * @param r Red, 0 to 31
+ * @param g Green, 0 to 63
+ * @param b Blue, 0 to 31
+ * @return The pixel in the byte order of the converter
+ */
+static inline uint16_t ILI9341_Dither_Pack(
+    const ILI9341_Dither* dither,
+    uint_fast16_t r,
+    uint_fast16_t g,
+    uint_fast16_t b
+) {
+    const uint16_t color = r << 11 | g << 5 | b;
+    return dither->swap ? (color >> 8) | (color << 8) : color;
+}
+
+void ILI9341_Dither_Init(
+    ILI9341_Dither* dither,
+    uint_fast8_t mode,
+    bool swap,
+    int16_t* errors,
+    int_fast16_t width
+) {
+    dither->mode = mode;
+    dither->swap = swap;
+    dither->errors = mode == ILI9341_DITHER_DIFFUSION ? errors : NULL;
+    dither->width = width;
+    ILI9341_Dither_Reset(dither);
+}
+
+void ILI9341_Dither_Reset(ILI9341_Dither* dither) {
+    if (dither->errors) memset(dither->errors, 0, ILI9341_DITHER_ERRORS_SIZE(dither->width) * sizeof(int16_t));
+}
+
+/**
+ * @brief Convert a run of a row with Floyd-Steinberg error diffusion
+ * @param dither Pointer to the converter
+ * @param pixels Output pixels
+ * @param rgb Input pixels, 3 bytes per pixel
+ * @param x X coordinate of the first pixel in the image
+ * @param count Number of pixels
+ * @note Errors are kept in 16ths. The error of a pixel goes 7/16 to the right, 3/16, 5/16 and 1/16 below left,
+ * below and below right. The errors below are written one pixel late, once the error read from the row above at that
+ * position is used.
+ */
+static void ILI9341_Dither_Diffuse(
+    const ILI9341_Dither* dither,
+    uint16_t* pixels,
+    const uint8_t* rgb,
+    int_fast16_t x,
+    size_t count
+) {
+    int16_t* errors = &dither->errors[3 * x];
+    int_fast32_t right[3] = {0, 0, 0}, belowLeft[3] = {0, 0, 0}, below[3] = {0, 0, 0};
+
+    for (size_t i = 0; i < count; i++) {
+        uint_fast16_t q[3];
+
+        for (uint_fast8_t c = 0; c < 3; c++) {
+            int_fast32_t value = rgb[3 * i + c] * 16 + errors[3 * i + c] + right[c];
+            if (value < 0) value = 0;
+            if (value > 255 * 16) value = 255 * 16;
+
+            // green has 6 bits, red and blue 5, the shown value repeats the high bits in the low ones
+            const uint_fast16_t v = (value + 8) >> 4;
+            int_fast32_t shown;
+            if (c == 1) {
+                q[c] = (v * 253 + 505) >> 10;
+                shown = q[c] << 2 | q[c] >> 4;
+            } else {
+                q[c] = (v * 249 + 1014) >> 11;
+                shown = q[c] << 3 | q[c] >> 2;
+            }
+
+            const int_fast32_t error = value - shown * 16;
+            right[c] = error * 7 / 16;
+            if (i > 0) errors[3 * (i - 1) + c] = belowLeft[c] + error * 3 / 16;
+            belowLeft[c] = below[c] + error * 5 / 16;
+            below[c] = error / 16;
+        }
+
+        pixels[i] = ILI9341_Dither_Pack(dither, q[0], q[1], q[2]);
+    }
+
+    if (count > 0) {
+        for (uint_fast8_t c = 0; c < 3; c++) errors[3 * (count - 1) + c] = belowLeft[c];
+    }
+}
+
+void ILI9341_Dither_ConvertRow(
+    ILI9341_Dither* dither,
+    uint16_t* pixels,
+    const uint8_t* rgb,
+    int_fast16_t x,
+    int_fast16_t y,
+    size_t count
+) {
+    if (dither->mode == ILI9341_DITHER_DIFFUSION) {
+        ILI9341_Dither_Diffuse(dither, pixels, rgb, x, count);
+    } else if (dither->mode == ILI9341_DITHER_ORDERED) {
+        const uint8_t* thresholds = ILI9341_Dither_Thresholds[y & 3];
+
+        for (size_t i = 0; i < count; i++, rgb += 3) {
+            const uint_fast16_t t = thresholds[(x + i) & 3];
+            pixels[i] = ILI9341_Dither_Pack(
+                dither,
+                ILI9341_Dither_Divide255(rgb[0] * 31 + t),
+                ILI9341_Dither_Divide255(rgb[1] * 63 + t),
+                ILI9341_Dither_Divide255(rgb[2] * 31 + t)
+            );
+        }
+    } else {
+        // (v * 31 + 127) / 255 and (v * 63 + 127) / 255 without dividing
+        for (size_t i = 0; i < count; i++, rgb += 3) {
+            pixels[i] = ILI9341_Dither_Pack(
+                dither,
+                (rgb[0] * 249 + 1014) >> 11,
+                (rgb[1] * 253 + 505) >> 10,
+                (rgb[2] * 249 + 1014) >> 11
+            );
+        }
+    }
+}
@@ -0,0 +1,137 @@
+#include "ili9341_effect.h"
+
+#include "string.h"
+
+/**
+ * @brief Send the brightness if it changed
+ * @param effect Pointer to the effect
+ * @param brightness Brightness to set
+ */
+static void ILI9341_Effect_SetBrightness(ILI9341_Effect* effect, uint_fast8_t brightness) {
+    if (brightness == effect->brightness) return;
+
+    ILI9341_SetBrightness(effect->ili9341, brightness);
+    effect->brightness = brightness;
+    effect->touched |= 1 << ILI9341_EFFECT_BRIGHTNESS;
+}
+
+/**
+ * @brief Apply the current step when entering it
+ * @param effect Pointer to the effect
+ */
+static void ILI9341_Effect_EnterStep(ILI9341_Effect* effect) {
+    const ILI9341_EffectStep* step = &effect->steps[effect->index];
+    bool on = step->value != 0;
+
+    switch (step->type) {
+        case ILI9341_EFFECT_INVERT:
+            ILI9341_InvertColors(effect->ili9341, on);
+            break;
+        case ILI9341_EFFECT_BRIGHTNESS:
+            ILI9341_Effect_SetBrightness(effect, step->value);
+            return;
+        case ILI9341_EFFECT_FADE:
+            effect->fadeFrom = effect->brightness;
+            return;
+        case ILI9341_EFFECT_IDLE:
+            ILI9341_SetIdleMode(effect->ili9341, on);
+            break;
+        case ILI9341_EFFECT_PARTIAL:
+            ILI9341_SetPartialMode(effect->ili9341, on);
+            break;
+        case ILI9341_EFFECT_DISPLAY:
+            ILI9341_SetDisplayOn(effect->ili9341, on);
+            break;
+        default:
+            return;
+    }
+
+    effect->touched |= 1 << step->type;
+}
+
+void ILI9341_Effect_Init(ILI9341_Effect* effect, ILI9341_HandleTypeDef* ili9341) {
+    memset(effect, 0, sizeof(*effect));
+    effect->ili9341 = ili9341;
+    effect->brightness = 0xFF;
+}
+
+void ILI9341_Effect_Start(
+    ILI9341_Effect* effect,
+    const ILI9341_EffectStep* steps,
+    size_t count,
+    uint_fast16_t repeat,
+    uint32_t tick
+) {
+    if (effect->running) ILI9341_Effect_Stop(effect);
+    if (count == 0 || repeat == 0) return;
+    if (count > ILI9341_EFFECT_MAX_STEPS) count = ILI9341_EFFECT_MAX_STEPS;
+
+    memcpy(effect->steps, steps, count * sizeof(ILI9341_EffectStep));
+    effect->count = count;
+    effect->index = 0;
+    effect->repeat = repeat;
+    effect->stepTick = tick;
+    effect->running = true;
+
+    ILI9341_Effect_EnterStep(effect);
+}
+
+void ILI9341_Effect_Flash(ILI9341_Effect* effect, uint_fast16_t times, uint16_t period, uint32_t tick) {
+    const ILI9341_EffectStep steps[] = {
+        {ILI9341_EFFECT_INVERT, 1, period / 2},
+        {ILI9341_EFFECT_INVERT, 0, period - period / 2}
+    };
+    ILI9341_Effect_Start(effect, steps, 2, times, tick);
+}
+
+void ILI9341_Effect_Fade(ILI9341_Effect* effect, uint_fast8_t brightness, uint16_t duration, uint32_t tick) {
+    const ILI9341_EffectStep steps[] = {
+        {ILI9341_EFFECT_FADE, brightness, duration / 2},
+        {ILI9341_EFFECT_FADE, 0xFF, duration - duration / 2}
+    };
+    ILI9341_Effect_Start(effect, steps, 2, 1, tick);
+}
+
+void ILI9341_Effect_Stop(ILI9341_Effect* effect) {
+    uint_fast8_t touched = effect->touched;
+
+    if (touched & (1 << ILI9341_EFFECT_INVERT)) ILI9341_InvertColors(effect->ili9341, false);
+    if (touched & (1 << ILI9341_EFFECT_BRIGHTNESS)) ILI9341_Effect_SetBrightness(effect, 0xFF);
+    if (touched & (1 << ILI9341_EFFECT_IDLE)) ILI9341_SetIdleMode(effect->ili9341, false);
+    if (touched & (1 << ILI9341_EFFECT_PARTIAL)) ILI9341_SetPartialMode(effect->ili9341, false);
+    if (touched & (1 << ILI9341_EFFECT_DISPLAY)) ILI9341_SetDisplayOn(effect->ili9341, true);
+
+    effect->touched = 0;
+    effect->running = false;
+}
+
+bool ILI9341_Effect_Update(ILI9341_Effect* effect, uint32_t tick) {
+    while (effect->running) {
+        const ILI9341_EffectStep* step = &effect->steps[effect->index];
+        uint32_t elapsed = tick - effect->stepTick;
+
+        if (elapsed < step->duration) {
+            if (step->type == ILI9341_EFFECT_FADE) {
+                int_fast32_t delta = ((int_fast32_t)step->value - effect->fadeFrom) * (int_fast32_t)elapsed;
+                ILI9341_Effect_SetBrightness(effect, effect->fadeFrom + delta / step->duration);
+            }
+            return true;
+        }
+
+        if (step->type == ILI9341_EFFECT_FADE) ILI9341_Effect_SetBrightness(effect, step->value);
+
+        // advance by the step duration so late updates don't stretch the effect
+        effect->stepTick += step->duration;
+        if (++effect->index >= effect->count) {
+            effect->index = 0;
+            if (--effect->repeat == 0) {
+                effect->running = false;
+                return false;
+            }
+        }
+
+        ILI9341_Effect_EnterStep(effect);
+    }
+
+    return false;
+}
@@ -629,3 +629,205 @@ static const ILI9341_GlyphDef ILI9341_Font_Spleen32x64_Glyphs[] = {
     {  0,   0,  0,  0, 32, NULL}, /* � */
 };
 const ILI9341_FontDef ILI9341_Font_Spleen32x64 = { 0x20, 0x7F, 320, 52, 12, ILI9341_Font_Spleen32x64_Glyphs };
+
+// Anti-aliased 4bpp version of Spleen32x64 downsampled by 2, generated with Tools/font_aa.py
+static const ILI9341_GlyphDef ILI9341_Font_Spleen16x32aa_Glyphs[] = {
+    {  0,   0,  0,  0, 16, NULL, 4}, /*   */
+    {  7,   0,  2, 20, 16, (const uint8_t[]){0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF}, 4}, /* ! */
+    {  3,  14, 10,  8, 16, (const uint8_t[]){0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF}, 4}, /* " */
+    {  1,   0, 14, 20, 16, (const uint8_t[]){0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00}, 4}, /* # */
+    {  2,  -2, 12, 24, 16, (const uint8_t[]){0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x04, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xB0, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0xB0, 0x0F, 0xF0, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFB, 0x40, 0x04, 0xBF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xF0, 0x0B, 0xFB, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x0B, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x40, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00}, 4}, /* $ */
+    {  2,   0, 12, 20, 16, (const uint8_t[]){0x00, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x0B, 0xFF, 0xB0, 0x00, 0x0F, 0xF8, 0x8F, 0x88, 0xF8, 0x00, 0x8F, 0xF0, 0x8F, 0x88, 0xF8, 0x00, 0xFF, 0x80, 0x8F, 0x88, 0xF8, 0x08, 0xFF, 0x00, 0x0B, 0xFF, 0xB0, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x0B, 0xFF, 0xB0, 0x00, 0xFF, 0x80, 0x8F, 0x88, 0xF8, 0x08, 0xFF, 0x00, 0x8F, 0x88, 0xF8, 0x0F, 0xF8, 0x00, 0x8F, 0x88, 0xF8, 0x8F, 0xF0, 0x00, 0x0B, 0xFF, 0xB0, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x00}, 4}, /* % */
+    {  1,   0, 14, 20, 16, (const uint8_t[]){0x00, 0x04, 0xBF, 0xFF, 0xFB, 0x40, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xB0, 0x00, 0x0B, 0xFB, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0xB0, 0x00, 0x0B, 0xFB, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFB, 0x40, 0x00, 0x04, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0xBF, 0xB0, 0x00, 0x0B, 0xFB, 0x0B, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xB0, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFB, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFB, 0x00, 0xBF, 0xB0, 0x00, 0x00, 0xBF, 0xFF, 0xB0, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0xFB, 0x04, 0xBF, 0xFF, 0xFF, 0xB4, 0x00, 0xBF}, 4}, /* & */
+    {  7,  14,  2,  8, 16, (const uint8_t[]){0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}, 4}, /* ' */
+    {  2,  -4, 12, 28, 16, (const uint8_t[]){0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x4F, 0xFF, 0x80, 0x00, 0x00, 0x04, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x0F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF}, 4}, /* ( */
+    {  2,  -4, 12, 28, 16, (const uint8_t[]){0x8F, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x04, 0xBF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF8, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xB0, 0x00, 0x00, 0x04, 0xBF, 0xFB, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x8F, 0xFF, 0xB4, 0x00, 0x00, 0x00}, 4}, /* ) */
+    {  1,   2, 14, 14, 16, (const uint8_t[]){0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xB0, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x4F, 0xFB, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x04, 0xFF, 0xBB, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xBB, 0xFF, 0x40, 0x00, 0x00, 0x4F, 0xFB, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0xFF, 0xB0, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00}, 4}, /* * */
+    {  3,   4, 10, 10, 16, (const uint8_t[]){0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00}, 4}, /* + */
+    {  5,  -2,  4,  6, 16, (const uint8_t[]){0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x0B, 0xFB, 0xFF, 0xF4, 0xFB, 0x40}, 4}, /* , */
+    {  2,   8, 12,  2, 16, (const uint8_t[]){0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}, 4}, /* - */
+    {  7,   0,  2,  3, 16, (const uint8_t[]){0xFF, 0xFF, 0xFF}, 4}, /* . */
+    {  1,  -3, 14, 26, 16, (const uint8_t[]){0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 4}, /* / */
+    {  2,   0, 12, 20, 16, (const uint8_t[]){0x04, 0xBF, 0xFF, 0xFF, 0xFB, 0x40, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xBF, 0xB0, 0x00, 0x00, 0x0B, 0xFB, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x4F, 0xFB, 0xFF, 0xFF, 0x00, 0x04, 0xFF, 0xB0, 0xFF, 0xFF, 0x00, 0x4F, 0xFB, 0x00, 0xFF, 0xFF, 0x04, 0xFF, 0xB0, 0x00, 0xFF, 0xFF, 0x4F, 0xFB, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xBF, 0xB0, 0x00, 0x00, 0x0B, 0xFB, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x04, 0xBF, 0xFF, 0xFF, 0xFB, 0x40}, 4}, /* 0 */
+    {  3,   0, 10, 20, 16, (const uint8_t[]){0x00, 0x4F, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00, 0x4F, 0xF4, 0xFF, 0x00, 0x00, 0xFF, 0x40, 0xFF, 0x00, 0x00, 0xF4, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}, 4}, /* 1 */
+    {  2,   0, 12, 20, 16, (const uint8_t[]){0x04, 0xBF, 0xFF, 0xFF, 0xFB, 0x40, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xBF, 0xB0, 0x00, 0x00, 0x0B, 0xFB, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}, 4}, /* 2 */
+    {  2,   0, 12, 20, 16, (const uint8_t[]){0x04, 0xBF, 0xFF, 0xFF, 0xFB, 0x40, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xBF, 0xB0, 0x00, 0x00, 0x0B, 0xFB, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xBF, 0xB0, 0x00, 0x00, 0x0B, 0xFB, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x04, 0xBF, 0xFF, 0xFF, 0xFB, 0x40}, 4}, /* 3 */
+    {  2,   0, 12, 20, 16, (const uint8_t[]){0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00}, 4}, /* 4 */
+    {  2,   0, 12, 20, 16, (const uint8_t[]){0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xBF, 0xB0, 0x00, 0x00, 0x0B, 0xFB, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x04, 0xBF, 0xFF, 0xFF, 0xFB, 0x40}, 4}, /* 5 */
+    {  2,   0, 12, 20, 16, (const uint8_t[]){0x04, 0xBF, 0xFF, 0xFF, 0xFB, 0x40, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xBF, 0xB0, 0x00, 0x00, 0x0B, 0xFB, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xBF, 0xB0, 0x00, 0x00, 0x0B, 0xFB, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x04, 0xBF, 0xFF, 0xFF, 0xFB, 0x40}, 4}, /* 6 */
+    {  2,   0, 12, 20, 16, (const uint8_t[]){0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00}, 4}, /* 7 */
+    {  2,   0, 12, 20, 16, (const uint8_t[]){0x04, 0xBF, 0xFF, 0xFF, 0xFB, 0x40, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xBF, 0xB0, 0x00, 0x00, 0x0B, 0xFB, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x4F, 0xB0, 0x00, 0x00, 0x0B, 0xF4, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x4F, 0xB0, 0x00, 0x00, 0x0B, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xBF, 0xB0, 0x00, 0x00, 0x0B, 0xFB, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x04, 0xBF, 0xFF, 0xFF, 0xFB, 0x40}, 4}, /* 8 */
+    {  2,   0, 12, 20, 16, (const uint8_t[]){0x04, 0xBF, 0xFF, 0xFF, 0xFB, 0x40, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xBF, 0xB0, 0x00, 0x00, 0x0B, 0xFB, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xBF, 0xB0, 0x00, 0x00, 0x00, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xBF, 0xB0, 0x00, 0x00, 0x0B, 0xFB, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x04, 0xBF, 0xFF, 0xFF, 0xFB, 0x40}, 4}, /* 9 */
+    {  7,   0,  2, 13, 16, (const uint8_t[]){0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF}, 4}, /* : */
+    {  5,  -2,  4, 15, 16, (const uint8_t[]){0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x0B, 0xFB, 0xFF, 0xF4, 0xFB, 0x40}, 4}, /* ; */
+    {  2,   0, 12, 20, 16, (const uint8_t[]){0x00, 0x00, 0x00, 0x00, 0x4F, 0xFB, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x4F, 0xFB, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x4F, 0xFB, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x4F, 0xFB, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x4F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFB}, 4}, /* < */
+    {  2,   6, 12,  8, 16, (const uint8_t[]){0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}, 4}, /* = */
+    {  2,   0, 12, 20, 16, (const uint8_t[]){0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00}, 4}, /* > */
+    {  2,   0, 12, 20, 16, (const uint8_t[]){0x04, 0xBF, 0xFF, 0xFF, 0xFB, 0x40, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xBF, 0xB0, 0x00, 0x00, 0x0B, 0xFB, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00}, 4}, /* ? */
+    {  2,   0, 12, 18, 16, (const uint8_t[]){0x04, 0xBF, 0xFF, 0xFF, 0xFB, 0x40, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xBF, 0xB0, 0x00, 0x00, 0x0B, 0xFB, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x04, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0}, 4}, /* @ */
+    {  2,   0, 12, 20, 16, (const uint8_t[]){0x04, 0xBF, 0xFF, 0xFF, 0xFB, 0x40, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xBF, 0xB0, 0x00, 0x00, 0x0B, 0xFB, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF}, 4}, /* A */
+    {  2,   0, 12, 20, 16, (const uint8_t[]){0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x40}, 4}, /* B */
+    {  2,   0, 12, 20, 16, (const uint8_t[]){0x04, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF}, 4}, /* C */
+    {  2,   0, 12, 20, 16, (const uint8_t[]){0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x40}, 4}, /* D */
+    {  2,   0, 12, 20, 16, (const uint8_t[]){0x04, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF}, 4}, /* E */
+    {  2,   0, 12, 20, 16, (const uint8_t[]){0x04, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00}, 4}, /* F */
+    {  2,   0, 12, 20, 16, (const uint8_t[]){0x04, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xBF, 0xB0, 0x00, 0x00, 0x00, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF}, 4}, /* G */
+    {  2,   0, 12, 20, 16, (const uint8_t[]){0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF}, 4}, /* H */
+    {  3,   0, 10, 20, 16, (const uint8_t[]){0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}, 4}, /* I */
+    {  1,   0, 12, 20, 16, (const uint8_t[]){0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFB, 0x40, 0x00, 0x00}, 4}, /* J */
+    {  2,   0, 12, 20, 16, (const uint8_t[]){0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x4F, 0xF4, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0x40, 0xFF, 0x00, 0x00, 0x00, 0x4F, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF}, 4}, /* K */
+    {  2,   0, 12, 20, 16, (const uint8_t[]){0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF}, 4}, /* L */
+    {  2,   0, 12, 20, 16, (const uint8_t[]){0xFF, 0x40, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0x40, 0x04, 0xFF, 0xFF, 0xFF, 0xBF, 0xF4, 0x4F, 0xFB, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xB0, 0xFF, 0xFF, 0x00, 0xBF, 0xFB, 0x00, 0xFF, 0xFF, 0x00, 0x0B, 0xB0, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF}, 4}, /* M */
+    {  2,   0, 12, 20, 16, (const uint8_t[]){0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0x8F, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0x0F, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0x08, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x00, 0x8F, 0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0xFF, 0xFF, 0x00, 0x08, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0xFF, 0xFF, 0x00, 0x00, 0x8F, 0xF0, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0xFF, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF}, 4}, /* N */
+    {  2,   0, 12, 20, 16, (const uint8_t[]){0x04, 0xBF, 0xFF, 0xFF, 0xFB, 0x40, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xBF, 0xB0, 0x00, 0x00, 0x0B, 0xFB, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xBF, 0xB0, 0x00, 0x00, 0x0B, 0xFB, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x04, 0xBF, 0xFF, 0xFF, 0xFB, 0x40}, 4}, /* O */
+    {  2,   0, 12, 20, 16, (const uint8_t[]){0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x40, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00}, 4}, /* P */
+    {  2,  -4, 12, 24, 16, (const uint8_t[]){0x04, 0xBF, 0xFF, 0xFF, 0xFB, 0x40, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xBF, 0xB0, 0x00, 0x00, 0x0B, 0xFB, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0xFF, 0xFF, 0x00, 0x08, 0xFF, 0x00, 0xFF, 0xBF, 0xB0, 0x00, 0xFF, 0x8B, 0xFB, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x04, 0xBF, 0xFF, 0xFF, 0xFB, 0x40, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0}, 4}, /* Q */
+    {  2,   0, 12, 20, 16, (const uint8_t[]){0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x4F, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0x00, 0x00, 0x00, 0x4F, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF}, 4}, /* R */
+    {  2,   0, 12, 20, 16, (const uint8_t[]){0x04, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFB, 0x40, 0x04, 0xBF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x40}, 4}, /* S */
+    {  1,   0, 14, 20, 16, (const uint8_t[]){0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00}, 4}, /* T */
+    {  2,   0, 12, 20, 16, (const uint8_t[]){0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xBF, 0xB0, 0x00, 0x00, 0x00, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF}, 4}, /* U */
+    {  2,   0, 12, 20, 16, (const uint8_t[]){0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x0B, 0xFF, 0x4F, 0xFB, 0x00, 0x00, 0xBF, 0xF4, 0x04, 0xFF, 0xB0, 0x0B, 0xFF, 0x40, 0x00, 0x4F, 0xFB, 0xBF, 0xF4, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x4F, 0xF4, 0x00, 0x00}, 4}, /* V */
+    {  2,   0, 12, 20, 16, (const uint8_t[]){0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x0B, 0xB0, 0x00, 0xFF, 0xFF, 0x00, 0xBF, 0xFB, 0x00, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0xB0, 0xFF, 0xFF, 0xBF, 0xF4, 0x4F, 0xFB, 0xFF, 0xFF, 0xFF, 0x40, 0x04, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x04, 0xFF}, 4}, /* W */
+    {  2,   0, 12, 20, 16, (const uint8_t[]){0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x04, 0xFF, 0xBF, 0xF4, 0x00, 0x00, 0x4F, 0xFB, 0x0B, 0xFF, 0x40, 0x04, 0xFF, 0xB0, 0x00, 0xBF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFB, 0x00, 0x0B, 0xFF, 0x40, 0x04, 0xFF, 0xB0, 0xBF, 0xF4, 0x00, 0x00, 0x4F, 0xFB, 0xFF, 0x40, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF}, 4}, /* X */
+    {  2,   0, 12, 20, 16, (const uint8_t[]){0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xBF, 0xB0, 0x00, 0x00, 0x00, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x40}, 4}, /* Y */
+    {  2,   0, 12, 20, 16, (const uint8_t[]){0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}, 4}, /* Z */
+    {  4,  -4, 10, 28, 16, (const uint8_t[]){0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}, 4}, /* [ */
+    {  1,  -3, 14, 26, 16, (const uint8_t[]){0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF}, 4}, /* \ */
+    {  2,  -4, 10, 28, 16, (const uint8_t[]){0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}, 4}, /* ] */
+    {  1,  14, 14,  8, 16, (const uint8_t[]){0x00, 0x00, 0x04, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x4F, 0xFB, 0x00, 0xBF, 0xF4, 0x00, 0x04, 0xFF, 0xB0, 0x00, 0x0B, 0xFF, 0x40, 0x4F, 0xFB, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF}, 4}, /* ^ */
+    {  1,  -4, 14,  2, 16, (const uint8_t[]){0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}, 4}, /* _ */
+    {  5,  16,  6,  6, 16, (const uint8_t[]){0xFB, 0x00, 0x00, 0xFF, 0xB0, 0x00, 0x4F, 0xFB, 0x00, 0x04, 0xFF, 0xB0, 0x00, 0x4F, 0xFB, 0x00, 0x04, 0xFF}, 4}, /* ` */
+    {  2,   0, 12, 14, 16, (const uint8_t[]){0x0F, 0xFF, 0xFF, 0xFF, 0xFB, 0x40, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x04, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xB0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xBF, 0xB0, 0x00, 0x00, 0x00, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF}, 4}, /* a */
+    {  2,   0, 12, 20, 16, (const uint8_t[]){0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x40}, 4}, /* b */
+    {  2,   0, 12, 14, 16, (const uint8_t[]){0x04, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF}, 4}, /* c */
+    {  2,   0, 12, 20, 16, (const uint8_t[]){0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x04, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xB0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xBF, 0xB0, 0x00, 0x00, 0x00, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF}, 4}, /* d */
+    {  2,   0, 12, 14, 16, (const uint8_t[]){0x04, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xB0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF}, 4}, /* e */
+    {  3,   0, 10, 20, 16, (const uint8_t[]){0x00, 0x04, 0xBF, 0xFF, 0xFF, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0x00, 0xBF, 0xB0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00}, 4}, /* f */
+    {  2,  -6, 12, 20, 16, (const uint8_t[]){0x04, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xB0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xBF, 0xB0, 0x00, 0x00, 0x0B, 0xFB, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x04, 0xBF, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x40}, 4}, /* g */
+    {  2,   0, 12, 20, 16, (const uint8_t[]){0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF}, 4}, /* h */
+    {  5,   0,  6, 20, 16, (const uint8_t[]){0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF}, 4}, /* i */
+    {  3,  -6,  6, 26, 16, (const uint8_t[]){0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x0B, 0xFB, 0xFF, 0xFF, 0xF4, 0xFF, 0xFB, 0x40}, 4}, /* j */
+    {  3,   0, 11, 20, 16, (const uint8_t[]){0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0B, 0xF0, 0x0F, 0xF0, 0x00, 0x0B, 0xFB, 0x00, 0xFF, 0x00, 0x0B, 0xFB, 0x00, 0x0F, 0xF0, 0x0B, 0xFB, 0x00, 0x00, 0xFF, 0x0B, 0xFB, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0xBF, 0xB0, 0x00, 0x00, 0xFF, 0x00, 0xBF, 0xB0, 0x00, 0x0F, 0xF0, 0x00, 0xBF, 0xB0, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0xB0, 0x0F, 0xF0, 0x00, 0x00, 0xBF, 0xB0, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0xBF}, 4}, /* k */
+    {  5,   0,  8, 20, 16, (const uint8_t[]){0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xB0, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0x04, 0xBF, 0xFF, 0xFF}, 4}, /* l */
+    {  2,   0, 12, 14, 16, (const uint8_t[]){0xFF, 0xFF, 0xF0, 0x0F, 0xFB, 0x40, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xF4, 0xFF, 0x00, 0x0F, 0xF0, 0x0B, 0xFB, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF}, 4}, /* m */
+    {  2,   0, 12, 14, 16, (const uint8_t[]){0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF}, 4}, /* n */
+    {  2,   0, 12, 14, 16, (const uint8_t[]){0x04, 0xBF, 0xFF, 0xFF, 0xFB, 0x40, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xBF, 0xB0, 0x00, 0x00, 0x0B, 0xFB, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xBF, 0xB0, 0x00, 0x00, 0x0B, 0xFB, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x04, 0xBF, 0xFF, 0xFF, 0xFB, 0x40}, 4}, /* o */
+    {  2,  -6, 12, 20, 16, (const uint8_t[]){0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x40, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00}, 4}, /* p */
+    {  2,  -6, 12, 20, 16, (const uint8_t[]){0x04, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xB0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xBF, 0xB0, 0x00, 0x00, 0x00, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF}, 4}, /* q */
+    {  2,   0, 12, 14, 16, (const uint8_t[]){0x04, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xB0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00}, 4}, /* r */
+    {  2,   0, 12, 14, 16, (const uint8_t[]){0x04, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFB, 0x40, 0x04, 0xBF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x40}, 4}, /* s */
+    {  3,   0, 10, 20, 16, (const uint8_t[]){0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xB0, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0x00, 0x04, 0xBF, 0xFF, 0xFF}, 4}, /* t */
+    {  2,   0, 12, 14, 16, (const uint8_t[]){0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xBF, 0xB0, 0x00, 0x00, 0x00, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF}, 4}, /* u */
+    {  2,   0, 12, 14, 16, (const uint8_t[]){0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x04, 0xFF, 0x4F, 0xF4, 0x00, 0x00, 0x4F, 0xF4, 0x04, 0xFF, 0x40, 0x04, 0xFF, 0x40, 0x00, 0x4F, 0xF4, 0x4F, 0xF4, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x4F, 0xF4, 0x00, 0x00}, 4}, /* v */
+    {  2,   0, 12, 14, 16, (const uint8_t[]){0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xBF, 0xB0, 0x0F, 0xF0, 0x00, 0xFF, 0x4F, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0x04, 0xBF, 0xF0, 0x0F, 0xFF, 0xFF}, 4}, /* w */
+    {  2,   0, 12, 14, 16, (const uint8_t[]){0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x04, 0xFF, 0x4F, 0xF4, 0x00, 0x00, 0x4F, 0xF4, 0x04, 0xFF, 0x40, 0x04, 0xFF, 0x40, 0x00, 0x4F, 0xF4, 0x4F, 0xF4, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x4F, 0xF4, 0x4F, 0xF4, 0x00, 0x04, 0xFF, 0x40, 0x04, 0xFF, 0x40, 0x0F, 0xF4, 0x00, 0x00, 0x4F, 0xF0, 0x8F, 0xF0, 0x00, 0x00, 0x0F, 0xF8, 0xFF, 0x80, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF}, 4}, /* x */
+    {  2,  -6, 12, 20, 16, (const uint8_t[]){0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xBF, 0xB0, 0x00, 0x00, 0x00, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x40}, 4}, /* y */
+    {  2,   0, 12, 14, 16, (const uint8_t[]){0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}, 4}, /* z */
+    {  2,  -4, 12, 28, 16, (const uint8_t[]){0x00, 0x00, 0x04, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xBF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFB, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x04, 0xBF, 0xFF, 0xFF}, 4}, /* { */
+    {  7,  -2,  2, 24, 16, (const uint8_t[]){0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}, 4}, /* | */
+    {  2,  -4, 12, 28, 16, (const uint8_t[]){0xFF, 0xFF, 0xFB, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xFF, 0xFB, 0x40, 0x00, 0x00}, 4}, /* } */
+    {  2,   7, 12,  5, 16, (const uint8_t[]){0x04, 0xBF, 0xB4, 0x00, 0x00, 0xFF, 0x4F, 0xFF, 0xFF, 0x40, 0x00, 0xFF, 0xFF, 0xB0, 0xBF, 0xF4, 0x0B, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0xFF, 0x00, 0x00, 0x8F, 0xFB, 0x40}, 4}, /* ~ */
+    {  0,   0,  0,  0, 16, NULL, 4}, /* � */
+};
+const ILI9341_FontDef ILI9341_Font_Spleen16x32aa = { 0x20, 0x7F, 160, 26, 6, ILI9341_Font_Spleen16x32aa_Glyphs };
+
+// Signed distance field version of Spleen32x64 sampled at 1/2 resolution, generated with Tools/font_sdf.py
+static const ILI9341_GlyphDef ILI9341_Font_SpleenSDF_Glyphs[] = {
+    {  0,   0,  0,  0, 16, NULL, 8}, /*   */
+    {  5,  -2,  6, 24, 16, (const uint8_t[]){0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00}, 8}, /* ! */
+    {  1,  12, 14, 12, 16, (const uint8_t[]){0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00}, 8}, /* " */
+    { -1,  -2, 18, 24, 16, (const uint8_t[]){0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x00, 0x1C, 0x53, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0xAD, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xAD, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0xAD, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xAD, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x53, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x00, 0x1C, 0x53, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0xAD, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xAD, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0xAD, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xAD, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x53, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00}, 8}, /* # */
+    {  0,  -4, 16, 28, 16, (const uint8_t[]){0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x26, 0x40, 0x60, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x26, 0x53, 0x80, 0x80, 0xA0, 0xA0, 0xAD, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x0E, 0x40, 0x80, 0xA0, 0xAD, 0xA0, 0xA0, 0xAD, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x0E, 0x00, 0x00, 0x00, 0x21, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x60, 0x40, 0x26, 0x00, 0x00, 0x0E, 0x40, 0x80, 0xA0, 0xAD, 0xA0, 0xA0, 0xAD, 0xAD, 0xA0, 0xA0, 0x80, 0x80, 0x53, 0x26, 0x00, 0x00, 0x26, 0x53, 0x80, 0x80, 0xA0, 0xA0, 0xAD, 0xAD, 0xA0, 0xA0, 0xAD, 0xA0, 0x80, 0x40, 0x0E, 0x00, 0x00, 0x26, 0x40, 0x60, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x21, 0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xAD, 0xA0, 0xA0, 0xAD, 0xA0, 0x80, 0x40, 0x0E, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xAD, 0xA0, 0xA0, 0x80, 0x80, 0x53, 0x26, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x60, 0x40, 0x26, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 8}, /* $ */
+    {  0,  -2, 16, 24, 16, (const uint8_t[]){0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x21, 0x0E, 0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x21, 0x21, 0x0E, 0x00, 0x00, 0x39, 0x60, 0x60, 0x60, 0x39, 0x00, 0x00, 0x0E, 0x39, 0x60, 0x60, 0x60, 0x60, 0x39, 0x0E, 0x1C, 0x53, 0x80, 0xA0, 0x80, 0x40, 0x01, 0x00, 0x39, 0x60, 0x80, 0xA0, 0xA0, 0x80, 0x60, 0x39, 0x39, 0x60, 0xA0, 0xAD, 0x80, 0x40, 0x01, 0x01, 0x40, 0x80, 0xAD, 0x80, 0x80, 0xAD, 0x80, 0x40, 0x53, 0x80, 0xAD, 0xA0, 0x60, 0x39, 0x00, 0x01, 0x40, 0x80, 0xC0, 0x80, 0x80, 0xC0, 0x80, 0x40, 0x60, 0xA0, 0xAD, 0x80, 0x53, 0x1C, 0x00, 0x01, 0x40, 0x80, 0xAD, 0x80, 0x80, 0xAD, 0x80, 0x53, 0x80, 0xAD, 0xA0, 0x60, 0x39, 0x00, 0x00, 0x00, 0x39, 0x60, 0x80, 0xA0, 0xA0, 0x80, 0x60, 0x60, 0xA0, 0xAD, 0x80, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x0E, 0x39, 0x60, 0x60, 0x60, 0x60, 0x53, 0x80, 0xAD, 0xA0, 0x60, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x21, 0x39, 0x60, 0xA0, 0xAD, 0x80, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x80, 0xAD, 0xA0, 0x60, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x60, 0xA0, 0xAD, 0x80, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x80, 0xAD, 0xA0, 0x60, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x60, 0xA0, 0xAD, 0x80, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x80, 0xAD, 0xA0, 0x60, 0x39, 0x21, 0x21, 0x21, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x60, 0xA0, 0xAD, 0x80, 0x53, 0x60, 0x60, 0x60, 0x60, 0x39, 0x0E, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x80, 0xAD, 0xA0, 0x60, 0x60, 0x80, 0xA0, 0xA0, 0x80, 0x60, 0x39, 0x00, 0x00, 0x00, 0x39, 0x60, 0xA0, 0xAD, 0x80, 0x53, 0x80, 0xAD, 0x80, 0x80, 0xAD, 0x80, 0x40, 0x01, 0x00, 0x1C, 0x53, 0x80, 0xAD, 0xA0, 0x60, 0x40, 0x80, 0xC0, 0x80, 0x80, 0xC0, 0x80, 0x40, 0x01, 0x00, 0x39, 0x60, 0xA0, 0xAD, 0x80, 0x53, 0x40, 0x80, 0xAD, 0x80, 0x80, 0xAD, 0x80, 0x40, 0x01, 0x01, 0x40, 0x80, 0xAD, 0xA0, 0x60, 0x39, 0x39, 0x60, 0x80, 0xA0, 0xA0, 0x80, 0x60, 0x39, 0x00, 0x01, 0x40, 0x80, 0xA0, 0x80, 0x53, 0x1C, 0x0E, 0x39, 0x60, 0x60, 0x60, 0x60, 0x39, 0x0E, 0x00, 0x00, 0x39, 0x60, 0x60, 0x60, 0x39, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x21, 0x21, 0x0E, 0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x21, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 8}, /* % */
+    { -1,  -2, 18, 24, 16, (const uint8_t[]){0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x40, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0x80, 0xA0, 0xA0, 0xA0, 0xA0, 0x80, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x40, 0x80, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x80, 0x40, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x60, 0x60, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x21, 0x21, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x21, 0x21, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x60, 0x60, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x40, 0x80, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x80, 0x40, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x26, 0x40, 0x60, 0x80, 0xA0, 0xDF, 0xDF, 0xAD, 0xA0, 0x80, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0x80, 0xA0, 0xAD, 0xDF, 0xDF, 0xA0, 0x60, 0x60, 0x40, 0x26, 0x21, 0x1C, 0x00, 0x00, 0x0E, 0x40, 0x80, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0x80, 0x60, 0x39, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x21, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x60, 0x60, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x80, 0xA0, 0x60, 0x21, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x21, 0x21, 0x39, 0x60, 0x80, 0xAD, 0xA0, 0xAD, 0x80, 0x60, 0x21, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x0E, 0x39, 0x60, 0xA0, 0xAD, 0x80, 0x60, 0x39, 0x0E, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x0E, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x21, 0x21, 0x21, 0x39, 0x60, 0xA0, 0xAD, 0x80, 0x60, 0x39, 0x0E, 0x00, 0x21, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0xAD, 0xA0, 0xAD, 0x80, 0x60, 0x39, 0x0E, 0x0E, 0x40, 0x80, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x21, 0x00, 0x26, 0x53, 0x80, 0x80, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x80, 0x80, 0x53, 0x60, 0x80, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x26, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x40, 0x26, 0x39, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x0E, 0x00, 0x0E, 0x21, 0x21, 0x1C, 0x00}, 8}, /* & */
+    {  5,  12,  6, 12, 16, (const uint8_t[]){0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00}, 8}, /* ' */
+    {  0,  -6, 16, 32, 16, (const uint8_t[]){0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x39, 0x53, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x60, 0x80, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xAD, 0xAD, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xAD, 0xA0, 0x80, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x80, 0xA0, 0xAD, 0x80, 0x60, 0x53, 0x39, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x39, 0x60, 0xA0, 0xAD, 0x80, 0x60, 0x39, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x80, 0xAD, 0xA0, 0x60, 0x39, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x60, 0xA0, 0xAD, 0x80, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x80, 0xAD, 0xA0, 0x60, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xAD, 0x80, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x80, 0xAD, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x80, 0xC0, 0x80, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x80, 0xC0, 0x80, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x80, 0xC0, 0x80, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x80, 0xC0, 0x80, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x80, 0xC0, 0x80, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x80, 0xC0, 0x80, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x80, 0xAD, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xAD, 0x80, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x80, 0xAD, 0xA0, 0x60, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x60, 0xA0, 0xAD, 0x80, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x80, 0xAD, 0xA0, 0x60, 0x39, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x60, 0xA0, 0xAD, 0x80, 0x60, 0x39, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x80, 0xA0, 0xAD, 0x80, 0x60, 0x53, 0x39, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xAD, 0xA0, 0x80, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xAD, 0xAD, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x60, 0x80, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x39, 0x53, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00}, 8}, /* ( */
+    {  0,  -6, 16, 32, 16, (const uint8_t[]){0x00, 0x0E, 0x21, 0x21, 0x21, 0x21, 0x21, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x60, 0x60, 0x60, 0x60, 0x60, 0x40, 0x26, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x80, 0xA0, 0xA0, 0xA0, 0x80, 0x80, 0x60, 0x39, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x80, 0xA0, 0xA0, 0xA0, 0xC0, 0xA0, 0x80, 0x60, 0x39, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x60, 0x60, 0x60, 0x80, 0x80, 0xA0, 0xAD, 0x80, 0x60, 0x39, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x26, 0x40, 0x60, 0x80, 0xA0, 0xAD, 0x80, 0x60, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x26, 0x53, 0x80, 0xA0, 0xAD, 0x80, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xAD, 0xA0, 0x60, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x60, 0xA0, 0xAD, 0x80, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x80, 0xAD, 0xA0, 0x60, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x60, 0xA0, 0xAD, 0x80, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x80, 0xC0, 0x80, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x80, 0xAD, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x80, 0xAD, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x80, 0xC0, 0x80, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x60, 0xA0, 0xAD, 0x80, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x80, 0xAD, 0xA0, 0x60, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x60, 0xA0, 0xAD, 0x80, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xAD, 0xA0, 0x60, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x26, 0x53, 0x80, 0xA0, 0xAD, 0x80, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x26, 0x40, 0x60, 0x80, 0xA0, 0xAD, 0x80, 0x60, 0x39, 0x00, 0x00, 0x00, 0x00, 0x39, 0x60, 0x60, 0x60, 0x80, 0x80, 0xA0, 0xAD, 0x80, 0x60, 0x39, 0x0E, 0x00, 0x00, 0x00, 0x01, 0x40, 0x80, 0xA0, 0xA0, 0xA0, 0xC0, 0xA0, 0x80, 0x60, 0x39, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x80, 0xA0, 0xA0, 0xA0, 0x80, 0x80, 0x60, 0x39, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x60, 0x60, 0x60, 0x60, 0x60, 0x40, 0x26, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x21, 0x21, 0x21, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 8}, /* ) */
+    { -1,   0, 18, 18, 16, (const uint8_t[]){0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x0E, 0x0E, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xAD, 0x80, 0x60, 0x39, 0x39, 0x60, 0x80, 0xAD, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x80, 0xA0, 0xAD, 0x80, 0x60, 0x60, 0x80, 0xAD, 0xA0, 0x80, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xAD, 0x80, 0x80, 0xAD, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x26, 0x53, 0x80, 0xA0, 0xC0, 0xC0, 0xA0, 0x80, 0x53, 0x26, 0x21, 0x21, 0x1C, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0x60, 0xA0, 0xDF, 0xDF, 0xA0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xE4, 0xE4, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xE4, 0xE4, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0x60, 0xA0, 0xDF, 0xDF, 0xA0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x1C, 0x21, 0x21, 0x26, 0x53, 0x80, 0xA0, 0xC0, 0xC0, 0xA0, 0x80, 0x53, 0x26, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xAD, 0x80, 0x80, 0xAD, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x80, 0xA0, 0xAD, 0x80, 0x60, 0x60, 0x80, 0xAD, 0xA0, 0x80, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xAD, 0x80, 0x60, 0x39, 0x39, 0x60, 0x80, 0xAD, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x0E, 0x0E, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00}, 8}, /* * */
+    {  1,   2, 14, 14, 16, (const uint8_t[]){0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x1C, 0x21, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00}, 8}, /* + */
+    {  3,  -4,  8, 10, 16, (const uint8_t[]){0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x1C, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x53, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xAD, 0xA0, 0x80, 0x40, 0x0E, 0x21, 0x60, 0xA0, 0x80, 0x80, 0x53, 0x26, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x40, 0x26, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x0E, 0x00, 0x00, 0x00}, 8}, /* , */
+    {  0,   6, 16,  6, 16, (const uint8_t[]){0x00, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00}, 8}, /* - */
+    {  5,  -2,  6,  7, 16, (const uint8_t[]){0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00}, 8}, /* . */
+    { -1,  -5, 18, 30, 16, (const uint8_t[]){0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x80, 0xAD, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x60, 0xA0, 0xAD, 0x80, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x80, 0xAD, 0xA0, 0x60, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x60, 0xA0, 0xAD, 0x80, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x80, 0xAD, 0xA0, 0x60, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x60, 0xA0, 0xAD, 0x80, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x80, 0xAD, 0xA0, 0x60, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x60, 0xA0, 0xAD, 0x80, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x80, 0xAD, 0xA0, 0x60, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x60, 0xA0, 0xAD, 0x80, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x80, 0xAD, 0xA0, 0x60, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x60, 0xA0, 0xAD, 0x80, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x80, 0xAD, 0xA0, 0x60, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x60, 0xA0, 0xAD, 0x80, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x80, 0xAD, 0xA0, 0x60, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x60, 0xA0, 0xAD, 0x80, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x80, 0xAD, 0xA0, 0x60, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x60, 0xA0, 0xAD, 0x80, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x80, 0xAD, 0xA0, 0x60, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x60, 0xA0, 0xAD, 0x80, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x80, 0xAD, 0xA0, 0x60, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x60, 0xA0, 0xAD, 0x80, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x80, 0xAD, 0xA0, 0x60, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xAD, 0x80, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 8}, /* / */
+    {  0,  -2, 16, 24, 16, (const uint8_t[]){0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x40, 0x26, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0x80, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x80, 0x80, 0x53, 0x26, 0x00, 0x0E, 0x40, 0x80, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x80, 0x40, 0x0E, 0x21, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x21, 0x21, 0x21, 0x21, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xC7, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xC0, 0xC7, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x26, 0x53, 0x80, 0xA0, 0xAD, 0x80, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x26, 0x53, 0x80, 0xA0, 0xAD, 0x80, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x53, 0x80, 0xA0, 0xAD, 0x80, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x80, 0xA0, 0xAD, 0x80, 0x60, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x80, 0xA0, 0xAD, 0x80, 0x60, 0x39, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xAD, 0xA0, 0xAD, 0x80, 0x60, 0x39, 0x0E, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xDA, 0xAD, 0x80, 0x60, 0x39, 0x0E, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xAD, 0x80, 0x60, 0x39, 0x0E, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x0E, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x21, 0x21, 0x21, 0x21, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x21, 0x0E, 0x40, 0x80, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x80, 0x40, 0x0E, 0x00, 0x26, 0x53, 0x80, 0x80, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x80, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x26, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x40, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x0E, 0x00, 0x00, 0x00}, 8}, /* 0 */
+    {  1,  -2, 14, 24, 16, (const uint8_t[]){0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xA0, 0xAD, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x80, 0xA0, 0xA0, 0x80, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x80, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0x80, 0x53, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x53, 0x26, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00}, 8}, /* 1 */
+    {  0,  -2, 16, 24, 16, (const uint8_t[]){0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x40, 0x26, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0x80, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x80, 0x80, 0x53, 0x26, 0x00, 0x0E, 0x40, 0x80, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x80, 0x40, 0x0E, 0x21, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x21, 0x21, 0x21, 0x21, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0x80, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xA0, 0x80, 0x40, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x1C, 0x53, 0x80, 0xA0, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0x80, 0x53, 0x26, 0x21, 0x21, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00}, 8}, /* 2 */
+    {  0,  -2, 16, 24, 16, (const uint8_t[]){0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x40, 0x26, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0x80, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x80, 0x80, 0x53, 0x26, 0x00, 0x0E, 0x40, 0x80, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x80, 0x40, 0x0E, 0x21, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x21, 0x21, 0x21, 0x21, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x21, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0xA0, 0x80, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0xA0, 0x80, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x21, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x21, 0x21, 0x21, 0x21, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x21, 0x0E, 0x40, 0x80, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x80, 0x40, 0x0E, 0x00, 0x26, 0x53, 0x80, 0x80, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x80, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x26, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x40, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x0E, 0x00, 0x00, 0x00}, 8}, /* 3 */
+    {  0,  -2, 16, 24, 16, (const uint8_t[]){0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xAD, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xAD, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00}, 8}, /* 4 */
+    {  0,  -2, 16, 24, 16, (const uint8_t[]){0x00, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x0E, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x40, 0x26, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x80, 0x80, 0x53, 0x26, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x80, 0x40, 0x0E, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x21, 0x00, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x21, 0x21, 0x21, 0x21, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x21, 0x0E, 0x40, 0x80, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x80, 0x40, 0x0E, 0x00, 0x26, 0x53, 0x80, 0x80, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x80, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x26, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x40, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x0E, 0x00, 0x00, 0x00}, 8}, /* 5 */
+    {  0,  -2, 16, 24, 16, (const uint8_t[]){0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x40, 0x26, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0x80, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x80, 0x80, 0x53, 0x26, 0x00, 0x0E, 0x40, 0x80, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x80, 0x40, 0x0E, 0x21, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x21, 0x21, 0x21, 0x21, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x0E, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x40, 0x26, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x80, 0x80, 0x53, 0x26, 0x00, 0x21, 0x60, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x80, 0x40, 0x0E, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x21, 0x21, 0x21, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x21, 0x21, 0x21, 0x21, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x21, 0x0E, 0x40, 0x80, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x80, 0x40, 0x0E, 0x00, 0x26, 0x53, 0x80, 0x80, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x80, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x26, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x40, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x0E, 0x00, 0x00, 0x00}, 8}, /* 6 */
+    {  0,  -2, 16, 24, 16, (const uint8_t[]){0x00, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xA0, 0x80, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x80, 0xA0, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 8}, /* 7 */
+    {  0,  -2, 16, 24, 16, (const uint8_t[]){0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x40, 0x26, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0x80, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x80, 0x80, 0x53, 0x26, 0x00, 0x0E, 0x40, 0x80, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x80, 0x40, 0x0E, 0x21, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x21, 0x21, 0x21, 0x21, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x21, 0x21, 0x21, 0x21, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x53, 0x80, 0xA0, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0xA0, 0x80, 0x53, 0x1C, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x1C, 0x53, 0x80, 0xA0, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0xA0, 0x80, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x21, 0x21, 0x21, 0x21, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x21, 0x21, 0x21, 0x21, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x21, 0x0E, 0x40, 0x80, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x80, 0x40, 0x0E, 0x00, 0x26, 0x53, 0x80, 0x80, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x80, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x26, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x40, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x0E, 0x00, 0x00, 0x00}, 8}, /* 8 */
+    {  0,  -2, 16, 24, 16, (const uint8_t[]){0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x40, 0x26, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0x80, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x80, 0x80, 0x53, 0x26, 0x00, 0x0E, 0x40, 0x80, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x80, 0x40, 0x0E, 0x21, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x21, 0x21, 0x21, 0x21, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x21, 0x21, 0x21, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x0E, 0x40, 0x80, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x60, 0x21, 0x00, 0x26, 0x53, 0x80, 0x80, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x26, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x21, 0x21, 0x21, 0x21, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x21, 0x0E, 0x40, 0x80, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x80, 0x40, 0x0E, 0x00, 0x26, 0x53, 0x80, 0x80, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x80, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x26, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x40, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x0E, 0x00, 0x00, 0x00}, 8}, /* 9 */
+    {  5,  -2,  6, 17, 16, (const uint8_t[]){0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00}, 8}, /* : */
+    {  3,  -4,  8, 19, 16, (const uint8_t[]){0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x1C, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x53, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xAD, 0xA0, 0x80, 0x40, 0x0E, 0x21, 0x60, 0xA0, 0x80, 0x80, 0x53, 0x26, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x40, 0x26, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x0E, 0x00, 0x00, 0x00}, 8}, /* ; */
+    {  0,  -2, 16, 24, 16, (const uint8_t[]){0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xA0, 0x80, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xAD, 0x80, 0x60, 0x39, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xAD, 0x80, 0x60, 0x39, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xAD, 0x80, 0x60, 0x39, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xAD, 0x80, 0x60, 0x39, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xAD, 0x80, 0x60, 0x39, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xAD, 0x80, 0x60, 0x39, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xAD, 0x80, 0x60, 0x39, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x80, 0xA0, 0xAD, 0x80, 0x60, 0x39, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xC7, 0xA0, 0x60, 0x39, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xC7, 0xA0, 0x60, 0x39, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x80, 0xA0, 0xAD, 0x80, 0x60, 0x39, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xAD, 0x80, 0x60, 0x39, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xAD, 0x80, 0x60, 0x39, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xAD, 0x80, 0x60, 0x39, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xAD, 0x80, 0x60, 0x39, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xAD, 0x80, 0x60, 0x39, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xAD, 0x80, 0x60, 0x39, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xAD, 0x80, 0x60, 0x39, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xA0, 0x80, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x21, 0x1C, 0x00}, 8}, /* < */
+    {  0,   4, 16, 12, 16, (const uint8_t[]){0x00, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00}, 8}, /* = */
+    {  0,  -2, 16, 24, 16, (const uint8_t[]){0x00, 0x1C, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0x80, 0xA0, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x39, 0x60, 0x80, 0xAD, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x39, 0x60, 0x80, 0xAD, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x39, 0x60, 0x80, 0xAD, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x39, 0x60, 0x80, 0xAD, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x39, 0x60, 0x80, 0xAD, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x39, 0x60, 0x80, 0xAD, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x39, 0x60, 0x80, 0xAD, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x39, 0x60, 0x80, 0xAD, 0xA0, 0x80, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x39, 0x60, 0xA0, 0xC7, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x39, 0x60, 0xA0, 0xC7, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x39, 0x60, 0x80, 0xAD, 0xA0, 0x80, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x39, 0x60, 0x80, 0xAD, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x39, 0x60, 0x80, 0xAD, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x39, 0x60, 0x80, 0xAD, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x39, 0x60, 0x80, 0xAD, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x39, 0x60, 0x80, 0xAD, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x39, 0x60, 0x80, 0xAD, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x39, 0x60, 0x80, 0xAD, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0x80, 0xA0, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 8}, /* > */
+    {  0,  -2, 16, 24, 16, (const uint8_t[]){0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x40, 0x26, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0x80, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x80, 0x80, 0x53, 0x26, 0x00, 0x0E, 0x40, 0x80, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x80, 0x40, 0x0E, 0x21, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x21, 0x21, 0x21, 0x21, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x39, 0x60, 0x80, 0xA0, 0x80, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x39, 0x60, 0x80, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x60, 0x80, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x80, 0xAD, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x80, 0xAD, 0x80, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 8}, /* ? */
+    {  0,  -2, 16, 22, 16, (const uint8_t[]){0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x40, 0x26, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0x80, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x80, 0x80, 0x53, 0x26, 0x00, 0x0E, 0x40, 0x80, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x80, 0x40, 0x0E, 0x21, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x21, 0x21, 0x21, 0x21, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x53, 0x60, 0x60, 0x60, 0x53, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x60, 0xA0, 0xDF, 0xA0, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x60, 0xA0, 0xDF, 0xA0, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x60, 0xA0, 0xDF, 0xA0, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x60, 0xA0, 0xDF, 0xA0, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x60, 0xA0, 0xDF, 0xA0, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x60, 0xA0, 0xDF, 0xAD, 0xA0, 0xA0, 0xAD, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x53, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x21, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x0E, 0x40, 0x80, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x26, 0x53, 0x80, 0x80, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x26, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x00}, 8}, /* @ */
+    {  0,  -2, 16, 24, 16, (const uint8_t[]){0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x40, 0x26, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0x80, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x80, 0x80, 0x53, 0x26, 0x00, 0x0E, 0x40, 0x80, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x80, 0x40, 0x0E, 0x21, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x21, 0x21, 0x21, 0x21, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00}, 8}, /* A */
+    {  0,  -2, 16, 24, 16, (const uint8_t[]){0x00, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x0E, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x40, 0x26, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x80, 0x80, 0x53, 0x26, 0x00, 0x21, 0x60, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x80, 0x40, 0x0E, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x21, 0x21, 0x21, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x21, 0x21, 0x21, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0xA0, 0x80, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x21, 0x60, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0xA0, 0x80, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x21, 0x21, 0x21, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x21, 0x21, 0x21, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x80, 0x40, 0x0E, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x80, 0x80, 0x53, 0x26, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x40, 0x26, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x0E, 0x00, 0x00, 0x00}, 8}, /* B */
+    {  0,  -2, 16, 24, 16, (const uint8_t[]){0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x26, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x26, 0x53, 0x80, 0x80, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x0E, 0x40, 0x80, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x21, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x0E, 0x40, 0x80, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x26, 0x53, 0x80, 0x80, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x26, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00}, 8}, /* C */
+    {  0,  -2, 16, 24, 16, (const uint8_t[]){0x00, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x0E, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x40, 0x26, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x80, 0x80, 0x53, 0x26, 0x00, 0x21, 0x60, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x80, 0x40, 0x0E, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x21, 0x21, 0x21, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x21, 0x21, 0x21, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x80, 0x40, 0x0E, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x80, 0x80, 0x53, 0x26, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x40, 0x26, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x0E, 0x00, 0x00, 0x00}, 8}, /* D */
+    {  0,  -2, 16, 24, 16, (const uint8_t[]){0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x26, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x26, 0x53, 0x80, 0x80, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x0E, 0x40, 0x80, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x21, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x0E, 0x40, 0x80, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x26, 0x53, 0x80, 0x80, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x26, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00}, 8}, /* E */
+    {  0,  -2, 16, 24, 16, (const uint8_t[]){0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x26, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x26, 0x53, 0x80, 0x80, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x0E, 0x40, 0x80, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 8}, /* F */
+    {  0,  -2, 16, 24, 16, (const uint8_t[]){0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x26, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x26, 0x53, 0x80, 0x80, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x0E, 0x40, 0x80, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x1C, 0x21, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x21, 0x21, 0x21, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x0E, 0x40, 0x80, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x60, 0x21, 0x00, 0x26, 0x53, 0x80, 0x80, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x26, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00}, 8}, /* G */
+    {  0,  -2, 16, 24, 16, (const uint8_t[]){0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00}, 8}, /* H */
+    {  1,  -2, 14, 24, 16, (const uint8_t[]){0x00, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x1C, 0x21, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00}, 8}, /* I */
+    { -1,  -2, 16, 24, 16, (const uint8_t[]){0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x80, 0x40, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x80, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x40, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 8}, /* J */
+    {  0,  -2, 16, 24, 16, (const uint8_t[]){0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x26, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x21, 0x26, 0x53, 0x80, 0xA0, 0xA0, 0x80, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0xA0, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x21, 0x60, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0xA0, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x21, 0x26, 0x53, 0x80, 0xA0, 0xA0, 0x80, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x26, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00}, 8}, /* K */
+    {  0,  -2, 16, 24, 16, (const uint8_t[]){0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x21, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x0E, 0x40, 0x80, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x26, 0x53, 0x80, 0x80, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x26, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00}, 8}, /* L */
+    {  0,  -2, 16, 24, 16, (const uint8_t[]){0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xC7, 0xA0, 0x80, 0x53, 0x26, 0x26, 0x53, 0x80, 0xA0, 0xC7, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xC7, 0xC0, 0xA0, 0x80, 0x53, 0x53, 0x80, 0xA0, 0xC0, 0xC7, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x80, 0xAD, 0xA0, 0x80, 0x80, 0xA0, 0xAD, 0x80, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x80, 0xAD, 0xA0, 0xA0, 0xAD, 0x80, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x80, 0xAD, 0xAD, 0x80, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x60, 0x80, 0x80, 0x60, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x39, 0x60, 0x60, 0x39, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x0E, 0x21, 0x21, 0x0E, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00}, 8}, /* M */
+    {  0,  -2, 16, 24, 16, (const uint8_t[]){0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xAD, 0x80, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xC7, 0xA0, 0x60, 0x39, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xDF, 0xAD, 0x80, 0x53, 0x1C, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xDF, 0xC7, 0xA0, 0x60, 0x39, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xAD, 0xA0, 0xAD, 0x80, 0x53, 0x1C, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x80, 0xAD, 0xA0, 0x60, 0x39, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0xA0, 0xAD, 0x80, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x80, 0xAD, 0xA0, 0x60, 0x39, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0xA0, 0xAD, 0x80, 0x53, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x53, 0x80, 0xAD, 0xA0, 0x60, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x60, 0xA0, 0xAD, 0x80, 0x53, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x53, 0x80, 0xAD, 0xA0, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x39, 0x60, 0xA0, 0xAD, 0x80, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x53, 0x80, 0xAD, 0xA0, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x39, 0x60, 0xA0, 0xAD, 0x80, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x1C, 0x53, 0x80, 0xAD, 0xA0, 0xAD, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x39, 0x60, 0xA0, 0xC7, 0xDF, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x1C, 0x53, 0x80, 0xAD, 0xDF, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x39, 0x60, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x21, 0x1C, 0x00}, 8}, /* N */
+    {  0,  -2, 16, 24, 16, (const uint8_t[]){0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x40, 0x26, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0x80, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x80, 0x80, 0x53, 0x26, 0x00, 0x0E, 0x40, 0x80, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x80, 0x40, 0x0E, 0x21, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x21, 0x21, 0x21, 0x21, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x21, 0x21, 0x21, 0x21, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x21, 0x0E, 0x40, 0x80, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x80, 0x40, 0x0E, 0x00, 0x26, 0x53, 0x80, 0x80, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x80, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x26, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x40, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x0E, 0x00, 0x00, 0x00}, 8}, /* O */
+    {  0,  -2, 16, 24, 16, (const uint8_t[]){0x00, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x0E, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x40, 0x26, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x80, 0x80, 0x53, 0x26, 0x00, 0x21, 0x60, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x80, 0x40, 0x0E, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x21, 0x21, 0x21, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x21, 0x21, 0x21, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x80, 0x40, 0x0E, 0x21, 0x60, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x80, 0x80, 0x53, 0x26, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x40, 0x26, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x0E, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 8}, /* P */
+    {  0,  -6, 16, 28, 16, (const uint8_t[]){0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x40, 0x26, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0x80, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x80, 0x80, 0x53, 0x26, 0x00, 0x0E, 0x40, 0x80, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x80, 0x40, 0x0E, 0x21, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x21, 0x21, 0x21, 0x21, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x21, 0x21, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x53, 0x60, 0x60, 0x53, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x60, 0xA0, 0xAD, 0x80, 0x53, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x53, 0x80, 0xAD, 0xA0, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x60, 0x60, 0xA0, 0xAD, 0x80, 0x80, 0xAD, 0x80, 0x60, 0x21, 0x0E, 0x40, 0x80, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xAD, 0xC7, 0xA0, 0xAD, 0xA0, 0x80, 0x40, 0x0E, 0x00, 0x26, 0x53, 0x80, 0x80, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xC0, 0x80, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x26, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0xAD, 0xA0, 0x60, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x21, 0x21, 0x39, 0x60, 0xA0, 0xAD, 0x80, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x80, 0xAD, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00}, 8}, /* Q */
+    {  0,  -2, 16, 24, 16, (const uint8_t[]){0x00, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x0E, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x40, 0x26, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x80, 0x80, 0x53, 0x26, 0x00, 0x21, 0x60, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x80, 0x40, 0x0E, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x21, 0x21, 0x21, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x26, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x21, 0x21, 0x26, 0x53, 0x80, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0xA0, 0xA0, 0x80, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x21, 0x60, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0xA0, 0xA0, 0x80, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x21, 0x21, 0x26, 0x53, 0x80, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x26, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00}, 8}, /* R */
+    {  0,  -2, 16, 24, 16, (const uint8_t[]){0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x26, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x26, 0x53, 0x80, 0x80, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x0E, 0x40, 0x80, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x0E, 0x00, 0x00, 0x00, 0x21, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x40, 0x26, 0x00, 0x00, 0x0E, 0x40, 0x80, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x80, 0x80, 0x53, 0x26, 0x00, 0x00, 0x26, 0x53, 0x80, 0x80, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x80, 0x40, 0x0E, 0x00, 0x00, 0x26, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x21, 0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x80, 0x40, 0x0E, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x80, 0x80, 0x53, 0x26, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x40, 0x26, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x0E, 0x00, 0x00, 0x00}, 8}, /* S */
+    { -1,  -2, 18, 24, 16, (const uint8_t[]){0x00, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 8}, /* T */
+    {  0,  -2, 16, 24, 16, (const uint8_t[]){0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x21, 0x21, 0x21, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x0E, 0x40, 0x80, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x60, 0x21, 0x00, 0x26, 0x53, 0x80, 0x80, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x26, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00}, 8}, /* U */
+    {  0,  -2, 16, 24, 16, (const uint8_t[]){0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x0E, 0x00, 0x00, 0x0E, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xAD, 0x80, 0x60, 0x39, 0x0E, 0x0E, 0x39, 0x60, 0x80, 0xAD, 0xA0, 0x60, 0x21, 0x1C, 0x53, 0x80, 0xA0, 0xAD, 0x80, 0x60, 0x39, 0x39, 0x60, 0x80, 0xAD, 0xA0, 0x80, 0x53, 0x1C, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xAD, 0x80, 0x60, 0x60, 0x80, 0xAD, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xAD, 0x80, 0x80, 0xAD, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xC0, 0xC0, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x60, 0x60, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 8}, /* V */
+    {  0,  -2, 16, 24, 16, (const uint8_t[]){0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x0E, 0x21, 0x21, 0x0E, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x39, 0x60, 0x60, 0x39, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x60, 0x80, 0x80, 0x60, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x80, 0xAD, 0xAD, 0x80, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x80, 0xAD, 0xA0, 0xA0, 0xAD, 0x80, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x80, 0xAD, 0xA0, 0x80, 0x80, 0xA0, 0xAD, 0x80, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xC7, 0xC0, 0xA0, 0x80, 0x53, 0x53, 0x80, 0xA0, 0xC0, 0xC7, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xC7, 0xA0, 0x80, 0x53, 0x26, 0x26, 0x53, 0x80, 0xA0, 0xC7, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00}, 8}, /* W */
+    {  0,  -2, 16, 24, 16, (const uint8_t[]){0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x26, 0x00, 0x00, 0x00, 0x00, 0x26, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0x80, 0xAD, 0xA0, 0x80, 0x53, 0x26, 0x26, 0x53, 0x80, 0xA0, 0xAD, 0x80, 0x60, 0x21, 0x0E, 0x39, 0x60, 0x80, 0xAD, 0xA0, 0x80, 0x60, 0x60, 0x80, 0xA0, 0xAD, 0x80, 0x60, 0x39, 0x0E, 0x00, 0x0E, 0x39, 0x60, 0x80, 0xC0, 0xA0, 0xA0, 0xA0, 0xA0, 0xC0, 0x80, 0x60, 0x39, 0x0E, 0x00, 0x00, 0x0E, 0x39, 0x60, 0x80, 0xC0, 0xA0, 0xA0, 0xA0, 0xA0, 0xC0, 0x80, 0x60, 0x39, 0x0E, 0x00, 0x0E, 0x39, 0x60, 0x80, 0xAD, 0xA0, 0x80, 0x60, 0x60, 0x80, 0xA0, 0xAD, 0x80, 0x60, 0x39, 0x0E, 0x21, 0x60, 0x80, 0xAD, 0xA0, 0x80, 0x53, 0x26, 0x26, 0x53, 0x80, 0xA0, 0xAD, 0x80, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x26, 0x00, 0x00, 0x00, 0x00, 0x26, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00}, 8}, /* X */
+    {  0,  -2, 16, 24, 16, (const uint8_t[]){0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x21, 0x21, 0x21, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x0E, 0x40, 0x80, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x60, 0x21, 0x00, 0x26, 0x53, 0x80, 0x80, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x26, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x80, 0x40, 0x0E, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x80, 0x80, 0x53, 0x26, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x40, 0x26, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x0E, 0x00, 0x00, 0x00}, 8}, /* Y */
+    {  0,  -2, 16, 24, 16, (const uint8_t[]){0x00, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x60, 0x21, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xA0, 0x80, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x80, 0xA0, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x26, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00}, 8}, /* Z */
+    {  2,  -6, 14, 32, 16, (const uint8_t[]){0x00, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00}, 8}, /* [ */
+    { -1,  -5, 18, 30, 16, (const uint8_t[]){0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xAD, 0x80, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x80, 0xAD, 0xA0, 0x60, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x60, 0xA0, 0xAD, 0x80, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x80, 0xAD, 0xA0, 0x60, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x60, 0xA0, 0xAD, 0x80, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x80, 0xAD, 0xA0, 0x60, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x60, 0xA0, 0xAD, 0x80, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x80, 0xAD, 0xA0, 0x60, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x60, 0xA0, 0xAD, 0x80, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x80, 0xAD, 0xA0, 0x60, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x60, 0xA0, 0xAD, 0x80, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x80, 0xAD, 0xA0, 0x60, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x60, 0xA0, 0xAD, 0x80, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x80, 0xAD, 0xA0, 0x60, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x60, 0xA0, 0xAD, 0x80, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x80, 0xAD, 0xA0, 0x60, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x60, 0xA0, 0xAD, 0x80, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x80, 0xAD, 0xA0, 0x60, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x60, 0xA0, 0xAD, 0x80, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x80, 0xAD, 0xA0, 0x60, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x60, 0xA0, 0xAD, 0x80, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x80, 0xAD, 0xA0, 0x60, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x60, 0xA0, 0xAD, 0x80, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x80, 0xAD, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00}, 8}, /* \ */
+    {  0,  -6, 14, 32, 16, (const uint8_t[]){0x00, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x60, 0x21, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00}, 8}, /* ] */
+    { -1,  12, 18, 12, 16, (const uint8_t[]){0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x60, 0x60, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xC7, 0xC7, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xAD, 0xA0, 0xA0, 0xAD, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xAD, 0x80, 0x60, 0x60, 0x80, 0xAD, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xAD, 0x80, 0x60, 0x39, 0x39, 0x60, 0x80, 0xAD, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x1C, 0x53, 0x80, 0xA0, 0xAD, 0x80, 0x60, 0x39, 0x0E, 0x0E, 0x39, 0x60, 0x80, 0xAD, 0xA0, 0x80, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xAD, 0x80, 0x60, 0x39, 0x0E, 0x00, 0x00, 0x0E, 0x39, 0x60, 0x80, 0xAD, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0x80, 0x60, 0x39, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x39, 0x60, 0x80, 0xA0, 0x60, 0x21, 0x1C, 0x53, 0x60, 0x60, 0x39, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x39, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x1C, 0x21, 0x21, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x1C, 0x00}, 8}, /* ^ */
+    { -1,  -6, 18,  6, 16, (const uint8_t[]){0x00, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00}, 8}, /* _ */
+    {  3,  14, 10, 10, 16, (const uint8_t[]){0x00, 0x1C, 0x21, 0x21, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x39, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0x80, 0x60, 0x39, 0x0E, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xAD, 0x80, 0x60, 0x39, 0x0E, 0x00, 0x00, 0x1C, 0x53, 0x80, 0xA0, 0xAD, 0x80, 0x60, 0x39, 0x0E, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xAD, 0x80, 0x60, 0x39, 0x0E, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xAD, 0x80, 0x60, 0x21, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00}, 8}, /* ` */
+    {  0,  -2, 16, 18, 16, (const uint8_t[]){0x00, 0x00, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x40, 0x26, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x80, 0x80, 0x53, 0x26, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x80, 0x40, 0x0E, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x21, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x26, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x26, 0x53, 0x80, 0x80, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x60, 0x21, 0x0E, 0x40, 0x80, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x60, 0x21, 0x21, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x21, 0x21, 0x21, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x21, 0x21, 0x21, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x0E, 0x40, 0x80, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x60, 0x21, 0x00, 0x26, 0x53, 0x80, 0x80, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x26, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00}, 8}, /* a */
+    {  0,  -2, 16, 24, 16, (const uint8_t[]){0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x0E, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x40, 0x26, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x80, 0x80, 0x53, 0x26, 0x00, 0x21, 0x60, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x80, 0x40, 0x0E, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x21, 0x21, 0x21, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x21, 0x21, 0x21, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x80, 0x40, 0x0E, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x80, 0x80, 0x53, 0x26, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x40, 0x26, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x0E, 0x00, 0x00, 0x00}, 8}, /* b */
+    {  0,  -2, 16, 18, 16, (const uint8_t[]){0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x26, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x26, 0x53, 0x80, 0x80, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x0E, 0x40, 0x80, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x21, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x0E, 0x40, 0x80, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x26, 0x53, 0x80, 0x80, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x26, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00}, 8}, /* c */
+    {  0,  -2, 16, 24, 16, (const uint8_t[]){0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x26, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x26, 0x53, 0x80, 0x80, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x60, 0x21, 0x0E, 0x40, 0x80, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x60, 0x21, 0x21, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x21, 0x21, 0x21, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x21, 0x21, 0x21, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x0E, 0x40, 0x80, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x60, 0x21, 0x00, 0x26, 0x53, 0x80, 0x80, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x26, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00}, 8}, /* d */
+    {  0,  -2, 16, 18, 16, (const uint8_t[]){0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x26, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x26, 0x53, 0x80, 0x80, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x0E, 0x40, 0x80, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x60, 0x21, 0x21, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x21, 0x21, 0x21, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x21, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x0E, 0x40, 0x80, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x26, 0x53, 0x80, 0x80, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x26, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00}, 8}, /* e */
+    {  1,  -2, 14, 24, 16, (const uint8_t[]){0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0x80, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x0E, 0x40, 0x80, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x21, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0xAD, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0xAD, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 8}, /* f */
+    {  0,  -8, 16, 24, 16, (const uint8_t[]){0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x26, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x26, 0x53, 0x80, 0x80, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x0E, 0x40, 0x80, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x60, 0x21, 0x21, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x21, 0x21, 0x21, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x21, 0x21, 0x21, 0x21, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x21, 0x0E, 0x40, 0x80, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0x80, 0x60, 0x39, 0x0E, 0x00, 0x26, 0x53, 0x80, 0x80, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0x80, 0x60, 0x39, 0x00, 0x00, 0x00, 0x26, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0xAD, 0x80, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x80, 0x40, 0x0E, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x80, 0x80, 0x53, 0x26, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x40, 0x26, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x0E, 0x00, 0x00, 0x00}, 8}, /* g */
+    {  0,  -2, 16, 24, 16, (const uint8_t[]){0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x0E, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x40, 0x26, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x80, 0x80, 0x53, 0x26, 0x00, 0x21, 0x60, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x80, 0x40, 0x0E, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x21, 0x21, 0x21, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00}, 8}, /* h */
+    {  3,  -2, 10, 24, 16, (const uint8_t[]){0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0xAD, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xAD, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00}, 8}, /* i */
+    {  1,  -8, 10, 30, 16, (const uint8_t[]){0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x1C, 0x21, 0x21, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x80, 0x40, 0x0E, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0x80, 0x80, 0x53, 0x26, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0x40, 0x26, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x0E, 0x00, 0x00, 0x00}, 8}, /* j */
+    {  1,  -2, 15, 24, 16, (const uint8_t[]){0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x0E, 0x39, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x0E, 0x39, 0x60, 0x80, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x39, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x21, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x39, 0x0E, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x39, 0x0E, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x39, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xAD, 0xA0, 0xAD, 0xA0, 0x60, 0x39, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xAD, 0xA0, 0xAD, 0xA0, 0x60, 0x39, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x39, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x39, 0x0E, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x39, 0x0E, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x39, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x39, 0x0E, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x0E, 0x39, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x39, 0x0E, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x0E, 0x39, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x0E, 0x39, 0x60, 0x80, 0xA0, 0x60, 0x21, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x0E, 0x39, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x1C, 0x00}, 8}, /* k */
+    {  3,  -2, 12, 24, 16, (const uint8_t[]){0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x21, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x0E, 0x40, 0x80, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x26, 0x53, 0x80, 0x80, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x26, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00}, 8}, /* l */
+    {  0,  -2, 16, 18, 16, (const uint8_t[]){0x00, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x1C, 0x21, 0x21, 0x21, 0x0E, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x53, 0x60, 0x60, 0x60, 0x40, 0x26, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x60, 0xA0, 0xA0, 0x80, 0x80, 0x53, 0x26, 0x00, 0x21, 0x60, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0x60, 0x60, 0xA0, 0xA0, 0xAD, 0xA0, 0x80, 0x40, 0x0E, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x53, 0x60, 0x60, 0x53, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x21, 0x21, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00}, 8}, /* m */
+    {  0,  -2, 16, 18, 16, (const uint8_t[]){0x00, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x0E, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x40, 0x26, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x80, 0x80, 0x53, 0x26, 0x00, 0x21, 0x60, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x80, 0x40, 0x0E, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x21, 0x21, 0x21, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00}, 8}, /* n */
+    {  0,  -2, 16, 18, 16, (const uint8_t[]){0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x40, 0x26, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0x80, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x80, 0x80, 0x53, 0x26, 0x00, 0x0E, 0x40, 0x80, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x80, 0x40, 0x0E, 0x21, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x21, 0x21, 0x21, 0x21, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x21, 0x21, 0x21, 0x21, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x21, 0x0E, 0x40, 0x80, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x80, 0x40, 0x0E, 0x00, 0x26, 0x53, 0x80, 0x80, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x80, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x26, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x40, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x0E, 0x00, 0x00, 0x00}, 8}, /* o */
+    {  0,  -8, 16, 24, 16, (const uint8_t[]){0x00, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x0E, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x40, 0x26, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x80, 0x80, 0x53, 0x26, 0x00, 0x21, 0x60, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x80, 0x40, 0x0E, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x21, 0x21, 0x21, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x21, 0x21, 0x21, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x80, 0x40, 0x0E, 0x21, 0x60, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x80, 0x80, 0x53, 0x26, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x40, 0x26, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x0E, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 8}, /* p */
+    {  0,  -8, 16, 24, 16, (const uint8_t[]){0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x26, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x26, 0x53, 0x80, 0x80, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x0E, 0x40, 0x80, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x60, 0x21, 0x21, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x21, 0x21, 0x21, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x21, 0x21, 0x21, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x0E, 0x40, 0x80, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x60, 0x21, 0x00, 0x26, 0x53, 0x80, 0x80, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x26, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00}, 8}, /* q */
+    {  0,  -2, 16, 18, 16, (const uint8_t[]){0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x26, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x26, 0x53, 0x80, 0x80, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x0E, 0x40, 0x80, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x60, 0x21, 0x21, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x21, 0x21, 0x21, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 8}, /* r */
+    {  0,  -2, 16, 18, 16, (const uint8_t[]){0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x26, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x26, 0x53, 0x80, 0x80, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x0E, 0x40, 0x80, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x0E, 0x00, 0x00, 0x00, 0x21, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x40, 0x26, 0x00, 0x00, 0x0E, 0x40, 0x80, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x80, 0x80, 0x53, 0x26, 0x00, 0x00, 0x26, 0x53, 0x80, 0x80, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x80, 0x40, 0x0E, 0x00, 0x00, 0x26, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x21, 0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x80, 0x40, 0x0E, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x80, 0x80, 0x53, 0x26, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x40, 0x26, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x0E, 0x00, 0x00, 0x00}, 8}, /* s */
+    {  1,  -2, 14, 24, 16, (const uint8_t[]){0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0xAD, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0xAD, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x21, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x0E, 0x40, 0x80, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0x80, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x26, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00}, 8}, /* t */
+    {  0,  -2, 16, 18, 16, (const uint8_t[]){0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x21, 0x21, 0x21, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x0E, 0x40, 0x80, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x60, 0x21, 0x00, 0x26, 0x53, 0x80, 0x80, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x26, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00}, 8}, /* u */
+    {  0,  -2, 16, 18, 16, (const uint8_t[]){0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x26, 0x00, 0x00, 0x00, 0x00, 0x26, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x53, 0x80, 0xA0, 0xA0, 0x80, 0x53, 0x26, 0x26, 0x53, 0x80, 0xA0, 0xA0, 0x80, 0x53, 0x1C, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xA0, 0x80, 0x53, 0x53, 0x80, 0xA0, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xA0, 0x80, 0x80, 0xA0, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xA0, 0xA0, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x60, 0x60, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 8}, /* v */
+    {  0,  -2, 16, 18, 16, (const uint8_t[]){0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x21, 0x21, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x53, 0x60, 0x60, 0x53, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x0E, 0x40, 0x80, 0xA0, 0xAD, 0xA0, 0xA0, 0x60, 0x60, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x60, 0x21, 0x00, 0x26, 0x53, 0x80, 0x80, 0xA0, 0xA0, 0x60, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x26, 0x40, 0x60, 0x60, 0x60, 0x53, 0x53, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x21, 0x1C, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00}, 8}, /* w */
+    {  0,  -2, 16, 18, 16, (const uint8_t[]){0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x26, 0x00, 0x00, 0x00, 0x00, 0x26, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x53, 0x80, 0xA0, 0xA0, 0x80, 0x53, 0x26, 0x26, 0x53, 0x80, 0xA0, 0xA0, 0x80, 0x53, 0x1C, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xA0, 0x80, 0x53, 0x53, 0x80, 0xA0, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xA0, 0x80, 0x80, 0xA0, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xA0, 0xA0, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xA0, 0xA0, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xA0, 0x80, 0x80, 0xA0, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x80, 0xA0, 0xA0, 0x80, 0x53, 0x53, 0x80, 0xA0, 0xA0, 0x80, 0x53, 0x1C, 0x00, 0x00, 0x39, 0x60, 0xA0, 0xA0, 0x80, 0x53, 0x26, 0x26, 0x53, 0x80, 0xA0, 0xA0, 0x60, 0x39, 0x00, 0x1C, 0x53, 0x80, 0xAD, 0xA0, 0x60, 0x26, 0x00, 0x00, 0x26, 0x60, 0xA0, 0xAD, 0x80, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xAD, 0x80, 0x53, 0x1C, 0x00, 0x00, 0x1C, 0x53, 0x80, 0xAD, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x00, 0x00, 0x00, 0x00, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00}, 8}, /* x */
+    {  0,  -8, 16, 24, 16, (const uint8_t[]){0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x21, 0x21, 0x21, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x0E, 0x40, 0x80, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x60, 0x21, 0x00, 0x26, 0x53, 0x80, 0x80, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x26, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x80, 0x40, 0x0E, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x80, 0x80, 0x53, 0x26, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x40, 0x26, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x0E, 0x00, 0x00, 0x00}, 8}, /* y */
+    {  0,  -2, 16, 18, 16, (const uint8_t[]){0x00, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x60, 0x21, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x26, 0x53, 0x80, 0xA0, 0xA0, 0x80, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xA0, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0xA0, 0xA0, 0x80, 0x53, 0x26, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x1C, 0x53, 0x80, 0xA0, 0xA0, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xC7, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00}, 8}, /* z */
+    {  0,  -6, 16, 32, 16, (const uint8_t[]){0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0x80, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x40, 0x80, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x26, 0x53, 0x80, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x80, 0xA0, 0xAD, 0x80, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xAD, 0x80, 0x60, 0x39, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xDF, 0xDF, 0xA0, 0x60, 0x39, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xDF, 0xDF, 0xA0, 0x60, 0x39, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xAD, 0x80, 0x60, 0x39, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x80, 0xA0, 0xAD, 0x80, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x26, 0x53, 0x80, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x40, 0x80, 0xA0, 0xAD, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x53, 0x80, 0x80, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1C, 0x00}, 8}, /* { */
+    {  5,  -4,  6, 28, 16, (const uint8_t[]){0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00}, 8}, /* | */
+    {  0,  -6, 16, 32, 16, (const uint8_t[]){0x00, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x40, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x80, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x80, 0x40, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x80, 0x53, 0x26, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0x80, 0xAD, 0xA0, 0x80, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x39, 0x60, 0x80, 0xAD, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x39, 0x60, 0xA0, 0xDF, 0xDF, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x39, 0x60, 0xA0, 0xDF, 0xDF, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x39, 0x60, 0x80, 0xAD, 0xA0, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0x80, 0xAD, 0xA0, 0x80, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x80, 0x53, 0x26, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0xAD, 0x80, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xAD, 0xA0, 0x80, 0x40, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x21, 0x60, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x80, 0x80, 0x53, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x40, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, 8}, /* } */
+    {  0,   5, 16,  9, 16, (const uint8_t[]){0x00, 0x00, 0x00, 0x0E, 0x21, 0x21, 0x21, 0x0E, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x26, 0x40, 0x60, 0x60, 0x60, 0x40, 0x26, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x00, 0x26, 0x53, 0x80, 0x80, 0xA0, 0x80, 0x80, 0x53, 0x26, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x1C, 0x53, 0x80, 0xA0, 0xAD, 0xA0, 0xAD, 0xA0, 0x80, 0x53, 0x39, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xAD, 0x80, 0x60, 0x80, 0xAD, 0xA0, 0x80, 0x60, 0x80, 0xAD, 0xA0, 0x60, 0x21, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x39, 0x60, 0x80, 0xAD, 0xA0, 0xA0, 0xAD, 0xA0, 0x80, 0x53, 0x1C, 0x21, 0x60, 0xA0, 0xA0, 0x60, 0x21, 0x39, 0x60, 0x80, 0xA0, 0xA0, 0x80, 0x80, 0x53, 0x26, 0x00, 0x1C, 0x53, 0x60, 0x60, 0x53, 0x1C, 0x0E, 0x39, 0x53, 0x60, 0x60, 0x60, 0x40, 0x26, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x1C, 0x00, 0x00, 0x00, 0x1C, 0x21, 0x21, 0x21, 0x0E, 0x00, 0x00, 0x00}, 8}, /* ~ */
+    {  0,   0,  0,  0, 16, NULL, 8}, /* � */
+};
+const ILI9341_SDFFontDef ILI9341_Font_SpleenSDF = { 0x20, 0x7F, 26, 6, 2, ILI9341_Font_SpleenSDF_Glyphs };
@@ -0,0 +1,129 @@
+#include "ili9341_framebuffer.h"
+
+#include "string.h"
+
+ILI9341_HandleTypeDef* ILI9341_Framebuffer_Init(
+    ILI9341_Framebuffer* framebuffer,
+    const ILI9341_HandleTypeDef* ili9341,
+    uint8_t* pixels,
+    uint_fast8_t bpp,
+    const uint16_t* palette,
+    uint_fast16_t count
+) {
+    if ((bpp != 1 && bpp != 2 && bpp != 4 && bpp != 8) || count == 0 || count > (1u << bpp)) return NULL;
+    if (ili9341->width > ILI9341_FRAMEBUFFER_MAX_WIDTH) return NULL;
+
+    memset(pixels, 0, ILI9341_FRAMEBUFFER_SIZE(ili9341->width, ili9341->height, bpp));
+    framebuffer->ili9341 = ili9341;
+    framebuffer->surface = (ILI9341_Surface){
+        .buffer = pixels,
+        .bpp = bpp,
+        .palette = framebuffer->palette,
+        .paletteSize = count,
+        .x = 0,
+        .y = 0,
+        .width = ili9341->width,
+        .height = ili9341->height
+    };
+    ILI9341_Framebuffer_SetPalette(framebuffer, 0, palette, count);
+
+    framebuffer->drawer = *ili9341;
+    framebuffer->drawer.surface = &framebuffer->surface;
+    framebuffer->drawer.displayList = NULL;
+    framebuffer->drawer.clip = NULL;
+
+    return &framebuffer->drawer;
+}
+
+void ILI9341_Framebuffer_SetPalette(
+    ILI9341_Framebuffer* framebuffer,
+    uint_fast16_t first,
+    const uint16_t* colors,
+    uint_fast16_t count
+) {
+    for (uint_fast16_t i = 0; i < count && first + i < framebuffer->surface.paletteSize; i++)
+        framebuffer->palette[first + i] = (colors[i] >> 8) | (colors[i] << 8);
+}
+
+/**
+ * @brief Expand a row segment of palette indices to RGB565
+ * @param framebuffer Pointer to the framebuffer
+ * @param y Row to expand
+ * @param x0 First column
+ * @param width Number of pixels
+ * @param output Output pixels in RGB565 format with the 2 bytes swapped
+ */
+static void ILI9341_Framebuffer_ExpandRow(
+    const ILI9341_Framebuffer* framebuffer,
+    int_fast16_t y,
+    int_fast16_t x0,
+    int_fast16_t width,
+    uint16_t* output
+) {
+    const ILI9341_Surface* surface = &framebuffer->surface;
+    const uint16_t* palette = framebuffer->palette;
+    const uint_fast8_t bpp = surface->bpp;
+    const uint8_t* line = (const uint8_t*)surface->buffer + y * ((surface->width * bpp + 7) / 8);
+
+    if (bpp == 8) {
+        for (int_fast16_t i = 0; i < width; i++) output[i] = palette[line[x0 + i]];
+        return;
+    }
+
+    const uint_fast8_t mask = (1 << bpp) - 1;
+    uint_fast32_t bit = (uint_fast32_t)x0 * bpp;
+    const uint8_t* byte = &line[bit >> 3];
+    uint_fast8_t shift = 8 - bpp - (bit & 7);
+
+    // walk the bytes instead of computing the position of every pixel
+    for (int_fast16_t i = 0; i < width; i++) {
+        output[i] = palette[(*byte >> shift) & mask];
+        if (shift == 0) {
+            shift = 8 - bpp;
+            byte++;
+        } else {
+            shift -= bpp;
+        }
+    }
+}
+
+void ILI9341_Framebuffer_FlushRect(
+    ILI9341_Framebuffer* framebuffer,
+    int_fast16_t x0,
+    int_fast16_t y0,
+    int_fast16_t x1,
+    int_fast16_t y1
+) {
+    const ILI9341_HandleTypeDef* ili9341 = framebuffer->ili9341;
+
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 >= framebuffer->surface.width) x1 = framebuffer->surface.width - 1;
+    if (y1 >= framebuffer->surface.height) y1 = framebuffer->surface.height - 1;
+    if (x0 > x1 || y0 > y1) return;
+
+    const int_fast16_t width = x1 - x0 + 1;
+    const int_fast16_t rows = ILI9341_FRAMEBUFFER_LINES * ILI9341_FRAMEBUFFER_MAX_WIDTH / width;
+    uint_fast8_t index = 0;
+    bool sending = false;
+
+    for (int_fast16_t y = y0; y <= y1; y += rows, index ^= 1) {
+        const int_fast16_t height = y1 - y + 1 < rows ? y1 - y + 1 : rows;
+        uint16_t* buffer = framebuffer->lines[index];
+
+        for (int_fast16_t row = 0; row < height; row++)
+            ILI9341_Framebuffer_ExpandRow(framebuffer, y + row, x0, width, &buffer[row * width]);
+
+        if (sending) ILI9341_WaitTransfer(ili9341);
+        ILI9341_StartTransfer(ili9341, x0, y, x1, y + height - 1, buffer);
+        sending = true;
+    }
+
+    ILI9341_WaitTransfer(ili9341);
+}
+
+void ILI9341_Framebuffer_Flush(ILI9341_Framebuffer* framebuffer) {
+    ILI9341_Framebuffer_FlushRect(
+        framebuffer, 0, 0, framebuffer->surface.width - 1, framebuffer->surface.height - 1
+    );
+}
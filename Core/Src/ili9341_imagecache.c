@@ -0,0 +1,338 @@
+#include "ili9341_imagecache.h"
+
+#include "string.h"
+
+void ILI9341_ImageCache_Init(ILI9341_ImageCache* cache, uint16_t* arena, size_t capacity) {
+    cache->arena = arena;
+    cache->capacity = capacity;
+    cache->useCounter = 0;
+    cache->hits = 0;
+    cache->misses = 0;
+    cache->evictions = 0;
+    ILI9341_ImageCache_Clear(cache);
+}
+
+void ILI9341_ImageCache_Clear(ILI9341_ImageCache* cache) {
+    cache->top = 0;
+    cache->count = 0;
+}
+
+/**
+ * @brief Find a cached image and mark it as the most recently used, counting a hit or a miss
+ * @param cache Pointer to the cache
+ * @param id Id of the image
+ * @param scale Scale of the image
+ * @return Pointer to the entry of the image, NULL if it is not cached
+ */
+static ILI9341_ImageCacheEntry* ILI9341_ImageCache_Lookup(ILI9341_ImageCache* cache, uint32_t id, uint_fast8_t scale) {
+    for (size_t i = 0; i < cache->count; i++) {
+        ILI9341_ImageCacheEntry* entry = &cache->entries[i];
+        if (entry->id == id && entry->scale == scale) {
+            entry->lastUse = ++cache->useCounter;
+            cache->hits++;
+            return entry;
+        }
+    }
+
+    cache->misses++;
+    return NULL;
+}
+
+/**
+ * @brief Move the images down to the start of the arena, closing the gaps left by evictions
+ * @param cache Pointer to the cache
+ */
+static void ILI9341_ImageCache_Compact(ILI9341_ImageCache* cache) {
+    ILI9341_ImageCacheEntry* entries = cache->entries;
+
+    // entries sorted by offset, so each image only moves down over free space
+    for (size_t i = 1; i < cache->count; i++) {
+        ILI9341_ImageCacheEntry entry = entries[i];
+        size_t j = i;
+        for (; j > 0 && entries[j - 1].offset > entry.offset; j--) entries[j] = entries[j - 1];
+        entries[j] = entry;
+    }
+
+    size_t top = 0;
+    for (size_t i = 0; i < cache->count; i++) {
+        const size_t size = (size_t)entries[i].width * entries[i].height;
+        if (entries[i].offset != top)
+            memmove(&cache->arena[top], &cache->arena[entries[i].offset], size * sizeof(uint16_t));
+        entries[i].offset = top;
+        top += size;
+    }
+    cache->top = top;
+}
+
+/**
+ * @brief Allocate an image at the end of the arena, evicting the least recently used images until it fits
+ * @param cache Pointer to the cache
+ * @param id Id of the image
+ * @param scale Scale of the image
+ * @param width Width of the space allocated
+ * @param height Height of the space allocated
+ * @return Pointer to the new entry, NULL if the image is larger than the arena
+ */
+static ILI9341_ImageCacheEntry* ILI9341_ImageCache_Allocate(
+    ILI9341_ImageCache* cache,
+    uint32_t id,
+    uint_fast8_t scale,
+    int_fast16_t width,
+    int_fast16_t height
+) {
+    const size_t size = (size_t)width * height;
+    if (size > cache->capacity) return NULL;
+
+    for (;;) {
+        size_t used = 0;
+        for (size_t i = 0; i < cache->count; i++) used += (size_t)cache->entries[i].width * cache->entries[i].height;
+        if (cache->count < ILI9341_IMAGECACHE_MAX_ENTRIES && cache->capacity - used >= size) break;
+
+        size_t oldest = 0;
+        for (size_t i = 1; i < cache->count; i++) {
+            if (cache->entries[i].lastUse < cache->entries[oldest].lastUse) oldest = i;
+        }
+        cache->entries[oldest] = cache->entries[--cache->count];
+        cache->evictions++;
+    }
+
+    if (cache->capacity - cache->top < size) ILI9341_ImageCache_Compact(cache);
+
+    ILI9341_ImageCacheEntry* entry = &cache->entries[cache->count++];
+    *entry = (ILI9341_ImageCacheEntry){
+        .id = id,
+        .scale = scale,
+        .width = width,
+        .height = height,
+        .offset = cache->top,
+        .lastUse = ++cache->useCounter
+    };
+    cache->top += size;
+    return entry;
+}
+
+/**
+ * @brief Remove the image allocated last, its decoding failed
+ * @param cache Pointer to the cache
+ */
+static void ILI9341_ImageCache_Discard(ILI9341_ImageCache* cache) {
+    cache->top = cache->entries[--cache->count].offset;
+}
+
+/**
+ * @brief Make a handle drawing into the space of an image instead of the panel
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @param surface Surface to set up on the pixels of the image
+ * @param pixels Pixels of the image
+ * @param width Width of the image
+ * @param height Height of the image
+ * @return The handle
+ */
+static ILI9341_HandleTypeDef ILI9341_ImageCache_Renderer(
+    const ILI9341_HandleTypeDef* ili9341,
+    ILI9341_Surface* surface,
+    uint16_t* pixels,
+    int_fast16_t width,
+    int_fast16_t height
+) {
+    ILI9341_HandleTypeDef renderer = *ili9341;
+
+    *surface = (ILI9341_Surface){.buffer = pixels, .width = width, .height = height};
+    renderer.surface = surface;
+    renderer.displayList = NULL;
+    renderer.clip = NULL;
+    renderer.width = width;
+    renderer.height = height;
+    return renderer;
+}
+
+/**
+ * @brief Shrink an image in place by averaging boxes of pixels
+ * @param pixels Pixels in RGB565 format with the 2 bytes swapped, the result is written over the start
+ * @param width Width of the image
+ * @param height Height of the image
+ * @param scale The image shrinks to 1 / (1 << scale) of its size, rounded up
+ * @note Each output pixel only overwrites pixels that were already read.
+ */
+static void ILI9341_ImageCache_Downsample(
+    uint16_t* pixels,
+    int_fast16_t width,
+    int_fast16_t height,
+    uint_fast8_t scale
+) {
+    const int_fast16_t factor = 1 << scale;
+    const int_fast16_t outWidth = (width + factor - 1) >> scale, outHeight = (height + factor - 1) >> scale;
+
+    for (int_fast16_t y = 0; y < outHeight; y++) {
+        const int_fast16_t rows = height - y * factor < factor ? height - y * factor : factor;
+
+        for (int_fast16_t x = 0; x < outWidth; x++) {
+            const int_fast16_t columns = width - x * factor < factor ? width - x * factor : factor;
+            uint_fast32_t r = 0, g = 0, b = 0;
+
+            for (int_fast16_t j = 0; j < rows; j++) {
+                const uint16_t* row = &pixels[(y * factor + j) * width + x * factor];
+                for (int_fast16_t i = 0; i < columns; i++) {
+                    const uint16_t color = (row[i] >> 8) | (row[i] << 8);
+                    r += color >> 11;
+                    g += (color >> 5) & 0x3F;
+                    b += color & 0x1F;
+                }
+            }
+
+            const uint_fast32_t count = rows * columns;
+            const uint16_t color = ((r + count / 2) / count) << 11 | ((g + count / 2) / count) << 5 |
+                                   (b + count / 2) / count;
+            pixels[y * outWidth + x] = (color >> 8) | (color << 8);
+        }
+    }
+}
+
+/**
+ * @brief Draw a shrunk compressed image without caching it, decoded and shrunk band by band
+ * @param cache Pointer to the cache, the bands are decoded in its arena
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @param x X coordinate of the top-left corner of the shrunk image
+ * @param y Y coordinate of the top-left corner of the shrunk image
+ * @param id Id of the image
+ * @param image Pointer to the compressed image
+ * @param scale 1, 2 or 3 for 1/2, 1/4 or 1/8 of the size
+ * @note The bands take the free space of the arena, images are only evicted when not even 1 << scale rows fit. Each
+ * band decodes the rows above it again, so fewer and taller bands are faster.
+ */
+static void ILI9341_ImageCache_DrawShrunk(
+    ILI9341_ImageCache* cache,
+    const ILI9341_HandleTypeDef* ili9341,
+    int_fast16_t x,
+    int_fast16_t y,
+    uint32_t id,
+    const ILI9341_CompressedImage* image,
+    uint_fast8_t scale
+) {
+    const int_fast16_t factor = 1 << scale, width = image->width, height = image->height;
+
+    size_t used = 0;
+    for (size_t i = 0; i < cache->count; i++) used += (size_t)cache->entries[i].width * cache->entries[i].height;
+
+    // whole output rows, the last band may be shorter
+    const size_t fit = (cache->capacity - used) / width / factor * factor;
+    const int_fast16_t rows = fit < (size_t)factor ? factor : fit > (size_t)height ? height : (int_fast16_t)fit;
+
+    ILI9341_ImageCacheEntry* band = ILI9341_ImageCache_Allocate(cache, id, scale, width, rows);
+    if (!band) return;
+
+    uint16_t* pixels = &cache->arena[band->offset];
+    for (int_fast16_t top = 0; top < height; top += rows) {
+        const int_fast16_t bandHeight = height - top < rows ? height - top : rows;
+
+        ILI9341_Surface surface;
+        ILI9341_HandleTypeDef renderer = ILI9341_ImageCache_Renderer(ili9341, &surface, pixels, width, bandHeight);
+        ILI9341_DrawImageCompressed(&renderer, 0, -top, image);
+        ILI9341_ImageCache_Downsample(pixels, width, bandHeight, scale);
+
+        ILI9341_DrawImage(
+            ili9341,
+            x,
+            y + (top >> scale),
+            (width + factor - 1) >> scale,
+            (bandHeight + factor - 1) >> scale,
+            pixels
+        );
+    }
+
+    ILI9341_ImageCache_Discard(cache);
+}
+
+bool ILI9341_ImageCache_DrawCompressed(
+    ILI9341_ImageCache* cache,
+    const ILI9341_HandleTypeDef* ili9341,
+    int_fast16_t x,
+    int_fast16_t y,
+    uint32_t id,
+    const ILI9341_CompressedImage* image,
+    uint_fast8_t scale
+) {
+    ILI9341_ImageCacheEntry* entry = ILI9341_ImageCache_Lookup(cache, id, scale);
+
+    if (!entry) {
+        // decoded at full size, then shrunk in place
+        entry = ILI9341_ImageCache_Allocate(cache, id, scale, image->width, image->height);
+        if (!entry) {
+            if (scale == 0) {
+                ILI9341_DrawImageCompressed(ili9341, x, y, image);
+            } else {
+                ILI9341_ImageCache_DrawShrunk(cache, ili9341, x, y, id, image, scale);
+            }
+            return false;
+        }
+
+        ILI9341_Surface surface;
+        ILI9341_HandleTypeDef renderer = ILI9341_ImageCache_Renderer(
+            ili9341,
+            &surface,
+            &cache->arena[entry->offset],
+            image->width,
+            image->height
+        );
+        ILI9341_DrawImageCompressed(&renderer, 0, 0, image);
+
+        if (scale > 0) {
+            ILI9341_ImageCache_Downsample(&cache->arena[entry->offset], image->width, image->height, scale);
+            entry->width = (image->width + (1 << scale) - 1) >> scale;
+            entry->height = (image->height + (1 << scale) - 1) >> scale;
+            cache->top = entry->offset + (size_t)entry->width * entry->height;
+        }
+    }
+
+    ILI9341_DrawImage(ili9341, x, y, entry->width, entry->height, &cache->arena[entry->offset]);
+    return true;
+}
+
+bool ILI9341_ImageCache_DrawJpeg(
+    ILI9341_ImageCache* cache,
+    const ILI9341_HandleTypeDef* ili9341,
+    int_fast16_t x,
+    int_fast16_t y,
+    uint32_t id,
+    ILI9341_Jpeg* jpeg,
+    uint_fast8_t scale
+) {
+    ILI9341_ImageCacheEntry* entry = ILI9341_ImageCache_Lookup(cache, id, scale);
+
+    if (!entry) {
+        // the decoder scales while decoding, only the scaled image is allocated
+        const int_fast16_t width = (jpeg->width + (1 << scale) - 1) >> scale;
+        const int_fast16_t height = (jpeg->height + (1 << scale) - 1) >> scale;
+        entry = ILI9341_ImageCache_Allocate(cache, id, scale, width, height);
+        if (!entry) {
+            ILI9341_Jpeg_Draw(jpeg, ili9341, x, y, scale);
+            return false;
+        }
+
+        ILI9341_Surface surface;
+        ILI9341_HandleTypeDef renderer =
+            ILI9341_ImageCache_Renderer(ili9341, &surface, &cache->arena[entry->offset], width, height);
+        if (!ILI9341_Jpeg_Draw(jpeg, &renderer, 0, 0, scale)) {
+            ILI9341_ImageCache_Discard(cache);
+            return false;
+        }
+    }
+
+    ILI9341_DrawImage(ili9341, x, y, entry->width, entry->height, &cache->arena[entry->offset]);
+    return true;
+}
+
+bool ILI9341_ImageCache_DrawAsset(
+    ILI9341_ImageCache* cache,
+    const ILI9341_HandleTypeDef* ili9341,
+    int_fast16_t x,
+    int_fast16_t y,
+    const ILI9341_AssetHeader* bundle,
+    uint32_t id,
+    uint_fast8_t scale
+) {
+    ILI9341_CompressedImage image;
+    if (!ILI9341_Assets_GetCompressedImage(bundle, id, &image)) return false;
+
+    return ILI9341_ImageCache_DrawCompressed(cache, ili9341, x, y, id, &image, scale);
+}
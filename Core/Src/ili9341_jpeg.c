@@ -0,0 +1,691 @@
+#include "ili9341_jpeg.h"
+
+#include "string.h"
+
+// Markers
+#define ILI9341_JPEG_SOI 0xD8
+#define ILI9341_JPEG_EOI 0xD9
+#define ILI9341_JPEG_SOF0 0xC0
+#define ILI9341_JPEG_SOF1 0xC1
+#define ILI9341_JPEG_DHT 0xC4
+#define ILI9341_JPEG_DQT 0xDB
+#define ILI9341_JPEG_DRI 0xDD
+#define ILI9341_JPEG_SOS 0xDA
+#define ILI9341_JPEG_RST0 0xD0
+#define ILI9341_JPEG_RST7 0xD7
+
+// IDCT constants in 12-bit fixed point
+#define ILI9341_JPEG_FIX(x) ((int32_t)((x) * 4096 + 0.5))
+
+// Index in the block of each coefficient in file order
+static const uint8_t ILI9341_JpegZigzag[64] = {
+    0,  1,  8,  16, 9,  2,  3,  10, 17, 24, 32, 25, 18, 11, 4,  5,  12, 19, 26, 33, 40, 48,
+    41, 34, 27, 20, 13, 6,  7,  14, 21, 28, 35, 42, 49, 56, 57, 50, 43, 36, 29, 22, 15, 23,
+    30, 37, 44, 51, 58, 59, 52, 45, 38, 31, 39, 46, 53, 60, 61, 54, 47, 55, 62, 63
+};
+
+/**
+ * @brief Build a Huffman table from the code counts and values of a DHT segment
+ * @param table Table to build
+ * @param counts Number of codes of each length from 1 to 16
+ * @param values Values of the codes in code order
+ * @return false if the counts do not make a prefix code
+ */
+static bool ILI9341_Jpeg_BuildHuffman(ILI9341_JpegHuffman* table, const uint8_t* counts, const uint8_t* values) {
+    int32_t code = 0;
+    size_t index = 0;
+
+    memset(table->fast, 0, sizeof(table->fast));
+
+    for (uint_fast8_t length = 1; length <= 16; length++) {
+        if (code + counts[length - 1] > (1 << length)) return false;
+
+        table->valueOffset[length] = index - code;
+        for (uint_fast8_t i = 0; i < counts[length - 1]; i++, code++, index++) {
+            table->values[index] = values[index];
+
+            // every entry starting with a short code gets its value
+            if (length <= ILI9341_JPEG_FAST_BITS) {
+                const uint_fast8_t shift = ILI9341_JPEG_FAST_BITS - length;
+                for (uint_fast16_t j = 0; j < (1u << shift); j++)
+                    table->fast[(code << shift) | j] = (length << 8) | values[index];
+            }
+        }
+        table->maxCode[length] = counts[length - 1] ? code - 1 : -1;
+        code <<= 1;
+    }
+
+    return true;
+}
+
+bool ILI9341_Jpeg_Open(ILI9341_Jpeg* jpeg, const uint8_t* data, size_t size) {
+    const uint8_t* position = data;
+    const uint8_t* end = data + size;
+    bool frame = false;
+
+    jpeg->componentCount = 0;
+    jpeg->restartInterval = 0;
+    jpeg->dither = false;
+    // tables never defined decode nothing
+    for (uint_fast8_t i = 0; i < 4; i++) {
+        for (uint_fast8_t length = 0; length <= 16; length++) jpeg->huffmanTables[i].maxCode[length] = -1;
+        memset(jpeg->huffmanTables[i].fast, 0, sizeof(jpeg->huffmanTables[i].fast));
+    }
+
+    if (size < 4 || data[0] != 0xFF || data[1] != ILI9341_JPEG_SOI) return false;
+    position += 2;
+
+    while (true) {
+        if (end - position < 2 || position[0] != 0xFF) return false;
+        // markers may be preceded by fill bytes
+        while (position < end && *position == 0xFF) position++;
+        if (position >= end) return false;
+
+        const uint_fast8_t marker = *(position++);
+        if (marker == ILI9341_JPEG_EOI) return false;
+        if (marker == 0x01 || (marker >= ILI9341_JPEG_RST0 && marker <= ILI9341_JPEG_RST7)) continue;
+        if (end - position < 2) return false;
+
+        const size_t length = (position[0] << 8) | position[1];
+        if (length < 2 || length > (size_t)(end - position)) return false;
+        const uint8_t* segment = position + 2;
+        const uint8_t* segmentEnd = position + length;
+
+        switch (marker) {
+            case ILI9341_JPEG_DQT:
+                while (segment < segmentEnd) {
+                    const uint_fast8_t precision = segment[0] >> 4, id = segment[0] & 0x0F;
+                    if (id > 3 || precision > 1 || segmentEnd - segment < 1 + 64 * (precision + 1)) return false;
+
+                    for (uint_fast8_t k = 0; k < 64; k++)
+                        jpeg->quantTables[id][k] =
+                            precision ? (segment[1 + 2 * k] << 8) | segment[2 + 2 * k] : segment[1 + k];
+                    segment += 1 + 64 * (precision + 1);
+                }
+                break;
+            case ILI9341_JPEG_DHT:
+                while (segment < segmentEnd) {
+                    const uint_fast8_t tableClass = segment[0] >> 4, id = segment[0] & 0x0F;
+                    size_t count = 0;
+                    if (tableClass > 1 || id > 1 || segmentEnd - segment < 17) return false;
+
+                    for (uint_fast8_t length = 0; length < 16; length++) count += segment[1 + length];
+                    if (count > 256 || (size_t)(segmentEnd - segment) < 17 + count) return false;
+                    ILI9341_JpegHuffman* table = &jpeg->huffmanTables[tableClass * 2 + id];
+                    if (!ILI9341_Jpeg_BuildHuffman(table, segment + 1, segment + 17)) return false;
+                    segment += 17 + count;
+                }
+                break;
+            case ILI9341_JPEG_SOF0:
+            case ILI9341_JPEG_SOF1: {
+                if (length < 8) return false;
+                const uint_fast8_t count = segment[5];
+                if (segment[0] != 8 || (count != 1 && count != 3) || length < 8 + 3u * count) return false;
+
+                jpeg->height = (segment[1] << 8) | segment[2];
+                jpeg->width = (segment[3] << 8) | segment[4];
+                if (jpeg->width == 0 || jpeg->height == 0) return false;
+
+                jpeg->componentCount = count;
+                jpeg->maxH = jpeg->maxV = 1;
+                for (uint_fast8_t i = 0; i < count; i++) {
+                    ILI9341_JpegComponent* component = &jpeg->components[i];
+                    component->id = segment[6 + 3 * i];
+                    // a single component is not interleaved, its MCU is one block whatever its sampling factors
+                    component->h = count == 1 ? 1 : segment[7 + 3 * i] >> 4;
+                    component->v = count == 1 ? 1 : segment[7 + 3 * i] & 0x0F;
+                    component->quantTable = segment[8 + 3 * i];
+                    if (component->h < 1 || component->h > 2 || component->v < 1 || component->v > 2 ||
+                        component->quantTable > 3)
+                        return false;
+                    if (component->h > jpeg->maxH) jpeg->maxH = component->h;
+                    if (component->v > jpeg->maxV) jpeg->maxV = component->v;
+                }
+                frame = true;
+                break;
+            }
+            case ILI9341_JPEG_DRI:
+                if (length < 4) return false;
+                jpeg->restartInterval = (segment[0] << 8) | segment[1];
+                break;
+            case ILI9341_JPEG_SOS: {
+                if (!frame || length < 3) return false;
+                const uint_fast8_t count = segment[0];
+                if (count != jpeg->componentCount || length < 6 + 2u * count) return false;
+
+                for (uint_fast8_t i = 0; i < count; i++) {
+                    ILI9341_JpegComponent* component = NULL;
+                    for (uint_fast8_t j = 0; j < jpeg->componentCount; j++) {
+                        if (jpeg->components[j].id == segment[1 + 2 * i]) component = &jpeg->components[j];
+                    }
+                    if (!component) return false;
+
+                    component->dcTable = segment[2 + 2 * i] >> 4;
+                    component->acTable = segment[2 + 2 * i] & 0x0F;
+                    if (component->dcTable > 1 || component->acTable > 1) return false;
+                }
+
+                jpeg->scan = segmentEnd;
+                jpeg->end = end;
+                return true;
+            }
+            default:
+                // progressive, lossless, hierarchical and arithmetic coded frames
+                if (marker >= 0xC2 && marker <= 0xCF && marker != ILI9341_JPEG_DHT && marker != 0xC8 &&
+                    marker != 0xCC)
+                    return false;
+                break;
+        }
+
+        position = segmentEnd;
+    }
+}
+
+/**
+ * @brief Fill the bit buffer with at least 25 bits, zeros once a marker or the end of the data is reached
+ * @param jpeg Pointer to the decoder
+ */
+static void ILI9341_Jpeg_FillBits(ILI9341_Jpeg* jpeg) {
+    while (jpeg->bitCount <= 24) {
+        uint_fast8_t byte = 0;
+
+        if (!jpeg->marker && jpeg->position < jpeg->end) {
+            byte = *jpeg->position;
+            if (byte != 0xFF) {
+                jpeg->position++;
+            } else if (jpeg->position + 1 < jpeg->end && jpeg->position[1] == 0x00) {
+                // stuffed byte
+                jpeg->position += 2;
+            } else {
+                jpeg->marker = true;
+                byte = 0;
+            }
+        }
+
+        jpeg->bits |= (uint32_t)byte << (24 - jpeg->bitCount);
+        jpeg->bitCount += 8;
+    }
+}
+
+/**
+ * @brief Read bits from the entropy-coded data
+ * @param jpeg Pointer to the decoder
+ * @param count Number of bits, from 1 to 16
+ * @return The bits, first bit as MSB
+ */
+static inline uint_fast32_t ILI9341_Jpeg_GetBits(ILI9341_Jpeg* jpeg, uint_fast8_t count) {
+    ILI9341_Jpeg_FillBits(jpeg);
+
+    const uint_fast32_t value = jpeg->bits >> (32 - count);
+    jpeg->bits <<= count;
+    jpeg->bitCount -= count;
+    return value;
+}
+
+/**
+ * @brief Decode the sign of a coefficient
+ * @param value Bits of the coefficient
+ * @param size Number of bits, at least 1
+ * @return Coefficient value
+ */
+static inline int_fast32_t ILI9341_Jpeg_Extend(uint_fast32_t value, uint_fast8_t size) {
+    return value < (1u << (size - 1)) ? (int_fast32_t)value - (1 << size) + 1 : (int_fast32_t)value;
+}
+
+/**
+ * @brief Decode one Huffman-coded symbol
+ * @param jpeg Pointer to the decoder
+ * @param table Huffman table
+ * @return The symbol, -1 if no code matches
+ */
+static int_fast16_t ILI9341_Jpeg_DecodeSymbol(ILI9341_Jpeg* jpeg, const ILI9341_JpegHuffman* table) {
+    ILI9341_Jpeg_FillBits(jpeg);
+
+    const uint_fast16_t entry = table->fast[jpeg->bits >> (32 - ILI9341_JPEG_FAST_BITS)];
+    if (entry) {
+        jpeg->bits <<= entry >> 8;
+        jpeg->bitCount -= entry >> 8;
+        return entry & 0xFF;
+    }
+
+    for (uint_fast8_t length = ILI9341_JPEG_FAST_BITS + 1; length <= 16; length++) {
+        const int32_t code = jpeg->bits >> (32 - length);
+        if (code <= table->maxCode[length]) {
+            jpeg->bits <<= length;
+            jpeg->bitCount -= length;
+            return table->values[table->valueOffset[length] + code];
+        }
+    }
+
+    return -1;
+}
+
+/**
+ * @brief Decode the coefficients of one block
+ * @param jpeg Pointer to the decoder
+ * @param component Component of the block
+ * @param full Store all the dequantized coefficients in natural order, otherwise only the DC one
+ * @return false if the data is corrupt
+ */
+static bool ILI9341_Jpeg_DecodeBlock(ILI9341_Jpeg* jpeg, ILI9341_JpegComponent* component, bool full) {
+    const uint16_t* quant = jpeg->quantTables[component->quantTable];
+    const ILI9341_JpegHuffman* acTable = &jpeg->huffmanTables[2 + component->acTable];
+
+    const int_fast16_t size = ILI9341_Jpeg_DecodeSymbol(jpeg, &jpeg->huffmanTables[component->dcTable]);
+    if (size < 0 || size > 11) return false;
+    if (size > 0) component->dc += ILI9341_Jpeg_Extend(ILI9341_Jpeg_GetBits(jpeg, size), size);
+
+    if (full) memset(jpeg->coefficients, 0, sizeof(jpeg->coefficients));
+    jpeg->coefficients[0] = component->dc * quant[0];
+
+    for (uint_fast8_t k = 1; k < 64;) {
+        const int_fast16_t symbol = ILI9341_Jpeg_DecodeSymbol(jpeg, acTable);
+        if (symbol < 0) return false;
+
+        const uint_fast8_t run = symbol >> 4, bits = symbol & 0x0F;
+        if (bits == 0) {
+            // end of block, or 16 zeros
+            if (run != 15) break;
+            k += 16;
+            continue;
+        }
+
+        k += run;
+        if (k > 63) return false;
+        const int_fast32_t value = ILI9341_Jpeg_Extend(ILI9341_Jpeg_GetBits(jpeg, bits), bits);
+        if (full) jpeg->coefficients[ILI9341_JpegZigzag[k]] = value * quant[k];
+        k++;
+    }
+
+    return true;
+}
+
+/**
+ * @brief One-dimensional IDCT of 8 values
+ * @param s Input values
+ * @param bias Added to every output
+ * @param out Output values, scaled by 4096 * sqrt(8)
+ */
+static inline void ILI9341_Jpeg_Idct1D(const int32_t* s, int32_t bias, int32_t* out) {
+    int32_t p1, p2, p3, p4, p5, t0, t1, t2, t3, x0, x1, x2, x3;
+
+    // even part
+    p2 = s[2];
+    p3 = s[6];
+    p1 = (p2 + p3) * ILI9341_JPEG_FIX(0.5411961);
+    t2 = p1 + p3 * ILI9341_JPEG_FIX(-1.847759065);
+    t3 = p1 + p2 * ILI9341_JPEG_FIX(0.765366865);
+    t0 = (s[0] + s[4]) * 4096;
+    t1 = (s[0] - s[4]) * 4096;
+    x0 = t0 + t3 + bias;
+    x3 = t0 - t3 + bias;
+    x1 = t1 + t2 + bias;
+    x2 = t1 - t2 + bias;
+
+    // odd part
+    t0 = s[7];
+    t1 = s[5];
+    t2 = s[3];
+    t3 = s[1];
+    p3 = t0 + t2;
+    p4 = t1 + t3;
+    p1 = t0 + t3;
+    p2 = t1 + t2;
+    p5 = (p3 + p4) * ILI9341_JPEG_FIX(1.175875602);
+    t0 *= ILI9341_JPEG_FIX(0.298631336);
+    t1 *= ILI9341_JPEG_FIX(2.053119869);
+    t2 *= ILI9341_JPEG_FIX(3.072711026);
+    t3 *= ILI9341_JPEG_FIX(1.501321110);
+    p1 = p5 + p1 * ILI9341_JPEG_FIX(-0.899976223);
+    p2 = p5 + p2 * ILI9341_JPEG_FIX(-2.562915447);
+    p3 *= ILI9341_JPEG_FIX(-1.961570560);
+    p4 *= ILI9341_JPEG_FIX(-0.390180644);
+    t3 += p1 + p4;
+    t2 += p2 + p3;
+    t1 += p2 + p4;
+    t0 += p1 + p3;
+
+    out[0] = x0 + t3;
+    out[7] = x0 - t3;
+    out[1] = x1 + t2;
+    out[6] = x1 - t2;
+    out[2] = x2 + t1;
+    out[5] = x2 - t1;
+    out[3] = x3 + t0;
+    out[4] = x3 - t0;
+}
+
+/**
+ * @brief Clamp a sample to 0..255
+ */
+static inline uint8_t ILI9341_Jpeg_Clamp(int32_t value) {
+    return value < 0 ? 0 : value > 255 ? 255 : value;
+}
+
+/**
+ * @brief Inverse DCT of the coefficients of the decoder into samples
+ * @param coefficients Dequantized coefficients in natural order
+ * @param out Output samples, 8 rows of 8
+ * @param stride Distance between the output rows
+ */
+static void ILI9341_Jpeg_Idct(const int16_t* coefficients, uint8_t* out, size_t stride) {
+    int32_t workspace[64], column[8], values[8];
+
+    // columns, with 2 more bits of precision
+    for (uint_fast8_t x = 0; x < 8; x++) {
+        const int16_t* d = &coefficients[x];
+
+        if (!d[8] && !d[16] && !d[24] && !d[32] && !d[40] && !d[48] && !d[56]) {
+            for (uint_fast8_t y = 0; y < 8; y++) workspace[y * 8 + x] = d[0] * 4;
+            continue;
+        }
+
+        for (uint_fast8_t y = 0; y < 8; y++) column[y] = d[y * 8];
+        ILI9341_Jpeg_Idct1D(column, 512, values);
+        for (uint_fast8_t y = 0; y < 8; y++) workspace[y * 8 + x] = values[y] >> 10;
+    }
+
+    // rows, level shift of 128 included in the bias
+    for (uint_fast8_t y = 0; y < 8; y++) {
+        ILI9341_Jpeg_Idct1D(&workspace[y * 8], 65536 + (128 << 17), values);
+        for (uint_fast8_t x = 0; x < 8; x++) out[y * stride + x] = ILI9341_Jpeg_Clamp(values[x] >> 17);
+    }
+}
+
+/**
+ * @brief Scale of the samples of a component, subsampled chroma keeps up to the resolution of the output
+ * @param jpeg Pointer to the decoder
+ * @param component Pointer to the component
+ * @param scale One of ILI9341_JPEG_SCALE_* values
+ * @return Scale of the blocks of the component, blocks give (8 >> scale) x (8 >> scale) samples
+ */
+static uint_fast8_t ILI9341_Jpeg_ComponentScale(
+    const ILI9341_Jpeg* jpeg,
+    const ILI9341_JpegComponent* component,
+    uint_fast8_t scale
+) {
+    const uint_fast8_t subsampling = component->h < jpeg->maxH && component->v < jpeg->maxV;
+    return scale > subsampling ? scale - subsampling : 0;
+}
+
+/**
+ * @brief Decode the blocks of one MCU into the sample planes
+ * @param jpeg Pointer to the decoder
+ * @param scale One of ILI9341_JPEG_SCALE_* values
+ * @param visible Compute the samples, otherwise the MCU is only entropy decoded
+ * @return false if the data is corrupt
+ */
+static bool ILI9341_Jpeg_DecodeMcu(ILI9341_Jpeg* jpeg, uint_fast8_t scale, bool visible) {
+    for (uint_fast8_t c = 0; c < jpeg->componentCount; c++) {
+        ILI9341_JpegComponent* component = &jpeg->components[c];
+        const uint_fast8_t componentScale = ILI9341_Jpeg_ComponentScale(jpeg, component, scale);
+        const uint_fast8_t blockSize = 8 >> componentScale, factor = 1 << componentScale;
+        const size_t planeWidth = component->h * blockSize;
+
+        for (uint_fast8_t by = 0; by < component->v; by++) {
+            for (uint_fast8_t bx = 0; bx < component->h; bx++) {
+                if (!ILI9341_Jpeg_DecodeBlock(jpeg, component, visible && componentScale < ILI9341_JPEG_SCALE_1_8))
+                    return false;
+                if (!visible) continue;
+
+                uint8_t* out = &jpeg->samples[c][by * blockSize * planeWidth + bx * blockSize];
+                if (componentScale == ILI9341_JPEG_SCALE_1_8) {
+                    // the DC coefficient alone is the mean of the block
+                    *out = ILI9341_Jpeg_Clamp(((jpeg->coefficients[0] + 4) >> 3) + 128);
+                } else if (componentScale == ILI9341_JPEG_SCALE_1) {
+                    ILI9341_Jpeg_Idct(jpeg->coefficients, out, planeWidth);
+                } else {
+                    uint8_t block[64];
+                    ILI9341_Jpeg_Idct(jpeg->coefficients, block, 8);
+
+                    for (uint_fast8_t y = 0; y < blockSize; y++) {
+                        for (uint_fast8_t x = 0; x < blockSize; x++) {
+                            uint_fast16_t sum = 0;
+                            for (uint_fast8_t j = 0; j < factor; j++) {
+                                const uint8_t* row = &block[(y * factor + j) * 8 + x * factor];
+                                for (uint_fast8_t i = 0; i < factor; i++) sum += row[i];
+                            }
+                            out[y * planeWidth + x] = (sum + factor * factor / 2) >> (2 * componentScale);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief Convert the samples of the current MCU to pixels
+ * @param jpeg Pointer to the decoder
+ * @param scale One of ILI9341_JPEG_SCALE_* values
+ * @param pixels Output pixels in RGB565 format with the 2 bytes swapped
+ * @param stride Distance between the output rows
+ * @param width Columns to convert, less than the MCU at the right edge of the image
+ * @param height Rows to convert, less than the MCU at the bottom edge of the image
+ * @param originX X coordinate of the MCU in the scaled image, the phase of the dithering
+ * @param originY Y coordinate of the MCU in the scaled image
+ */
+static void ILI9341_Jpeg_ConvertMcu(
+    const ILI9341_Jpeg* jpeg,
+    uint_fast8_t scale,
+    uint16_t* pixels,
+    size_t stride,
+    int_fast16_t width,
+    int_fast16_t height,
+    int_fast16_t originX,
+    int_fast16_t originY
+) {
+    const uint_fast8_t blockSize = 8 >> scale;
+    const ILI9341_JpegComponent* components = jpeg->components;
+    // dithered rows are converted to RGB888 first, an MCU is at most 16 pixels wide
+    ILI9341_Dither dither = {.mode = ILI9341_DITHER_ORDERED, .swap = true};
+    uint8_t rgb[16 * 3];
+
+    if (jpeg->componentCount == 1) {
+        for (int_fast16_t y = 0; y < height; y++) {
+            const uint8_t* grayRow = &jpeg->samples[0][y * blockSize];
+
+            if (jpeg->dither) {
+                for (int_fast16_t x = 0; x < width; x++) rgb[3 * x] = rgb[3 * x + 1] = rgb[3 * x + 2] = grayRow[x];
+                ILI9341_Dither_ConvertRow(&dither, &pixels[y * stride], rgb, originX, originY + y, width);
+                continue;
+            }
+
+            for (int_fast16_t x = 0; x < width; x++) {
+                const uint_fast8_t gray = grayRow[x];
+                const uint16_t color = ((gray & 0xF8) << 8) | ((gray & 0xFC) << 3) | (gray >> 3);
+                pixels[y * stride + x] = (color >> 8) | (color << 8);
+            }
+        }
+        return;
+    }
+
+    // chroma planes with fewer samples than the output are upsampled by repeating their samples
+    uint_fast8_t shiftX[3], shiftY[3];
+    size_t planeWidth[3];
+    for (uint_fast8_t c = 0; c < 3; c++) {
+        const uint_fast8_t componentScale = ILI9341_Jpeg_ComponentScale(jpeg, &components[c], scale);
+        shiftX[c] = (components[c].h < jpeg->maxH) - (scale - componentScale);
+        shiftY[c] = (components[c].v < jpeg->maxV) - (scale - componentScale);
+        planeWidth[c] = components[c].h * (8 >> componentScale);
+    }
+
+    for (int_fast16_t y = 0; y < height; y++) {
+        const uint8_t* yRow = &jpeg->samples[0][(y >> shiftY[0]) * planeWidth[0]];
+        const uint8_t* cbRow = &jpeg->samples[1][(y >> shiftY[1]) * planeWidth[1]];
+        const uint8_t* crRow = &jpeg->samples[2][(y >> shiftY[2]) * planeWidth[2]];
+
+        for (int_fast16_t x = 0; x < width; x++) {
+            const int32_t luma = yRow[x >> shiftX[0]];
+            const int32_t cb = cbRow[x >> shiftX[1]] - 128, cr = crRow[x >> shiftX[2]] - 128;
+
+            // ITU-R BT.601 in 16-bit fixed point, as in JFIF
+            const uint_fast8_t r = ILI9341_Jpeg_Clamp(luma + ((91881 * cr + 32768) >> 16));
+            const uint_fast8_t g = ILI9341_Jpeg_Clamp(luma + ((-22554 * cb - 46802 * cr + 32768) >> 16));
+            const uint_fast8_t b = ILI9341_Jpeg_Clamp(luma + ((116130 * cb + 32768) >> 16));
+
+            if (jpeg->dither) {
+                rgb[3 * x] = r;
+                rgb[3 * x + 1] = g;
+                rgb[3 * x + 2] = b;
+            } else {
+                const uint16_t color = ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+                pixels[y * stride + x] = (color >> 8) | (color << 8);
+            }
+        }
+
+        if (jpeg->dither)
+            ILI9341_Dither_ConvertRow(&dither, &pixels[y * stride], rgb, originX, originY + y, width);
+    }
+}
+
+/**
+ * @brief Skip to the data after the next restart marker and reset the decoder state
+ * @param jpeg Pointer to the decoder
+ * @return false if there is no restart marker
+ */
+static bool ILI9341_Jpeg_Restart(ILI9341_Jpeg* jpeg) {
+    const uint8_t* position = jpeg->position;
+
+    // 0xFF in entropy-coded data is always stuffed, so this only finds markers
+    while (position + 1 < jpeg->end &&
+           !(position[0] == 0xFF && position[1] >= ILI9341_JPEG_RST0 && position[1] <= ILI9341_JPEG_RST7))
+        position++;
+    if (position + 1 >= jpeg->end) return false;
+
+    jpeg->position = position + 2;
+    jpeg->bits = 0;
+    jpeg->bitCount = 0;
+    jpeg->marker = false;
+    for (uint_fast8_t c = 0; c < jpeg->componentCount; c++) jpeg->components[c].dc = 0;
+
+    return true;
+}
+
+bool ILI9341_Jpeg_Draw(
+    ILI9341_Jpeg* jpeg,
+    const ILI9341_HandleTypeDef* ili9341,
+    int_fast16_t x,
+    int_fast16_t y,
+    uint_fast8_t scale
+) {
+    if (scale > ILI9341_JPEG_SCALE_1_8) scale = ILI9341_JPEG_SCALE_1_8;
+
+    const uint_fast8_t blockSize = 8 >> scale;
+    const int_fast16_t mcuWidth = 8 * jpeg->maxH, mcuHeight = 8 * jpeg->maxV;
+    const int_fast16_t mcusX = (jpeg->width + mcuWidth - 1) / mcuWidth;
+    const int_fast16_t mcusY = (jpeg->height + mcuHeight - 1) / mcuHeight;
+    const int_fast16_t outMcuWidth = jpeg->maxH * blockSize, outMcuHeight = jpeg->maxV * blockSize;
+    const int_fast16_t outWidth = (jpeg->width + (1 << scale) - 1) >> scale;
+    const int_fast16_t outHeight = (jpeg->height + (1 << scale) - 1) >> scale;
+    // MCUs side by side in one address window
+    const int_fast16_t groupSize = ILI9341_JPEG_BUFFER_SIZE / (outMcuWidth * outMcuHeight);
+
+    // visible part of the image on the display and in the clip rectangle
+    ILI9341_Rect visible = {
+        .x0 = x < 0 ? 0 : x,
+        .y0 = y < 0 ? 0 : y,
+        .x1 = x + outWidth - 1 >= ili9341->width ? ili9341->width - 1 : x + outWidth - 1,
+        .y1 = y + outHeight - 1 >= ili9341->height ? ili9341->height - 1 : y + outHeight - 1
+    };
+    if (ili9341->clip && ili9341->clip->depth > 0) {
+        const ILI9341_Rect* rect = &ili9341->clip->rects[ili9341->clip->depth - 1];
+        if (rect->x0 > visible.x0) visible.x0 = rect->x0;
+        if (rect->y0 > visible.y0) visible.y0 = rect->y0;
+        if (rect->x1 < visible.x1) visible.x1 = rect->x1;
+        if (rect->y1 < visible.y1) visible.y1 = rect->y1;
+    }
+    if (visible.x0 > visible.x1 || visible.y0 > visible.y1) return true;
+
+    jpeg->position = jpeg->scan;
+    jpeg->bits = 0;
+    jpeg->bitCount = 0;
+    jpeg->marker = false;
+    for (uint_fast8_t c = 0; c < jpeg->componentCount; c++) jpeg->components[c].dc = 0;
+
+    uint_fast16_t restartsLeft = jpeg->restartInterval;
+    uint_fast8_t current = 0;
+    bool sending = false, ok = true;
+
+    for (int_fast16_t mcuY = 0; mcuY < mcusY && ok; mcuY++) {
+        const int_fast16_t groupY = y + mcuY * outMcuHeight;
+        const int_fast16_t groupHeight =
+            outHeight - mcuY * outMcuHeight < outMcuHeight ? outHeight - mcuY * outMcuHeight : outMcuHeight;
+        if (groupY > visible.y1) break;
+
+        for (int_fast16_t mcuX = 0; mcuX < mcusX && ok; mcuX += groupSize) {
+            const int_fast16_t count = mcusX - mcuX < groupSize ? mcusX - mcuX : groupSize;
+            const int_fast16_t groupX = x + mcuX * outMcuWidth;
+            const int_fast16_t groupWidth = outWidth - mcuX * outMcuWidth < count * outMcuWidth
+                                                ? outWidth - mcuX * outMcuWidth
+                                                : count * outMcuWidth;
+            uint16_t* buffer = jpeg->buffers[current];
+
+            const ILI9341_Rect window = {
+                .x0 = groupX > visible.x0 ? groupX : visible.x0,
+                .y0 = groupY > visible.y0 ? groupY : visible.y0,
+                .x1 = groupX + groupWidth - 1 < visible.x1 ? groupX + groupWidth - 1 : visible.x1,
+                .y1 = groupY + groupHeight - 1 < visible.y1 ? groupY + groupHeight - 1 : visible.y1
+            };
+            const bool groupVisible = window.x0 <= window.x1 && window.y0 <= window.y1;
+
+            for (int_fast16_t i = 0; i < count; i++) {
+                if (jpeg->restartInterval) {
+                    if (restartsLeft == 0) {
+                        if (!ILI9341_Jpeg_Restart(jpeg)) {
+                            ok = false;
+                            break;
+                        }
+                        restartsLeft = jpeg->restartInterval;
+                    }
+                    restartsLeft--;
+                }
+
+                const int_fast16_t mcuLeft = groupX + i * outMcuWidth;
+                const bool mcuVisible = groupVisible && mcuLeft <= window.x1 && mcuLeft + outMcuWidth - 1 >= window.x0;
+                if (!ILI9341_Jpeg_DecodeMcu(jpeg, scale, mcuVisible)) {
+                    ok = false;
+                    break;
+                }
+
+                if (mcuVisible) {
+                    const int_fast16_t width =
+                        groupWidth - i * outMcuWidth < outMcuWidth ? groupWidth - i * outMcuWidth : outMcuWidth;
+                    ILI9341_Jpeg_ConvertMcu(
+                        jpeg,
+                        scale,
+                        &buffer[i * outMcuWidth],
+                        groupWidth,
+                        width,
+                        groupHeight,
+                        (mcuX + i) * outMcuWidth,
+                        mcuY * outMcuHeight
+                    );
+                }
+            }
+
+            if (!ok || !groupVisible) continue;
+
+            // the visible part of the group is moved to the start of the buffer
+            const int_fast16_t windowWidth = window.x1 - window.x0 + 1;
+            if (window.x0 != groupX || window.y0 != groupY || windowWidth != groupWidth) {
+                for (int_fast16_t row = 0; row <= window.y1 - window.y0; row++)
+                    memmove(
+                        &buffer[row * windowWidth],
+                        &buffer[(window.y0 - groupY + row) * groupWidth + window.x0 - groupX],
+                        windowWidth * sizeof(uint16_t)
+                    );
+            }
+
+            if (sending) ILI9341_WaitTransfer(ili9341);
+            ILI9341_StartTransfer(ili9341, window.x0, window.y0, window.x1, window.y1, buffer);
+            sending = true;
+            current ^= 1;
+        }
+    }
+
+    if (sending) ILI9341_WaitTransfer(ili9341);
+    return ok;
+}
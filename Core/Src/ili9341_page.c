@@ -0,0 +1,21 @@
+#include "ili9341_page.h"
+
+void ILI9341_Page_Draw(const ILI9341_Page* page, const ILI9341_HandleTypeDef* ili9341) {
+    for (size_t i = 0; i < page->opCount; i++) {
+        const ILI9341_PageOp* op = &page->ops[i];
+
+        switch (op->type) {
+            case ILI9341_PAGE_OP_FILL:
+                ILI9341_FillRectangle(ili9341, op->x, op->y, op->w, op->h, op->color);
+                break;
+            case ILI9341_PAGE_OP_GLYPH: {
+                const ILI9341_FontDef* font = op->data;
+                ILI9341_DrawGlyph(ili9341, op->x, op->y, &font->glyphs[op->glyph], op->color, op->bgColor, 1);
+                break;
+            }
+            case ILI9341_PAGE_OP_IMAGE:
+                ILI9341_DrawImage(ili9341, op->x, op->y, op->w, op->h, op->data);
+                break;
+        }
+    }
+}
@@ -0,0 +1,189 @@
+#include "ili9341_pagecache.h"
+
+#include "string.h"
+
+// Runs of at least this many equal pixels are encoded as repeats, shorter ones stay in literal runs
+#define ILI9341_PAGECACHE_MIN_REPEAT 3
+
+void ILI9341_PageCache_Init(
+    ILI9341_PageCache* cache,
+    const ILI9341_HandleTypeDef* ili9341,
+    uint16_t* arena,
+    size_t capacity
+) {
+    cache->ili9341 = ili9341;
+    cache->arena = arena;
+    cache->capacity = capacity;
+    cache->used = 0;
+    cache->count = 0;
+}
+
+/**
+ * @brief Encode one row of pixels at the end of the arena
+ * @param cache Pointer to the cache
+ * @param pixels Pixels of the row
+ * @param width Number of pixels
+ * @return false if the arena is full
+ */
+static bool ILI9341_PageCache_EncodeRow(ILI9341_PageCache* cache, const uint16_t* pixels, int_fast16_t width) {
+    uint16_t* arena = cache->arena;
+    size_t used = cache->used;
+    int_fast16_t literalStart = 0;
+
+    for (int_fast16_t x = 0; x <= width;) {
+        int_fast16_t repeat = 1;
+        while (x < width && x + repeat < width && pixels[x + repeat] == pixels[x]) repeat++;
+
+        // the pending literal run ends before a long repeat and at the end of the row
+        if (x == width || repeat >= ILI9341_PAGECACHE_MIN_REPEAT) {
+            if (x > literalStart) {
+                if (used + 1 + (x - literalStart) > cache->capacity) return false;
+                arena[used++] = 0x8000 | (x - literalStart);
+                memcpy(&arena[used], &pixels[literalStart], (x - literalStart) * sizeof(uint16_t));
+                used += x - literalStart;
+            }
+            if (x == width) break;
+
+            if (used + 2 > cache->capacity) return false;
+            arena[used++] = repeat;
+            arena[used++] = pixels[x];
+            x += repeat;
+            literalStart = x;
+        } else {
+            x += repeat;
+        }
+    }
+
+    cache->used = used;
+    return true;
+}
+
+bool ILI9341_PageCache_Add(ILI9341_PageCache* cache, const ILI9341_Page* page) {
+    const int_fast16_t width = page->width, height = page->height;
+    const size_t start = cache->used;
+
+    if (cache->count >= ILI9341_PAGECACHE_MAX_PAGES || width > ILI9341_PAGECACHE_MAX_WIDTH ||
+        start + height > cache->capacity)
+        return false;
+
+    // the row offsets come first, the rows follow
+    uint16_t* offsets = &cache->arena[start];
+    cache->used += height;
+
+    ILI9341_ClipStack clip;
+    ILI9341_Surface surface;
+    ILI9341_HandleTypeDef renderer = *cache->ili9341;
+    memset(&clip, 0, sizeof(clip));
+    renderer.surface = &surface;
+    renderer.displayList = NULL;
+    renderer.clip = &clip;
+
+    const int_fast16_t rows = ILI9341_PAGECACHE_STRIP_HEIGHT * ILI9341_PAGECACHE_MAX_WIDTH / width;
+    for (int_fast16_t y = 0; y < height; y += rows) {
+        const int_fast16_t stripHeight = height - y < rows ? height - y : rows;
+        uint16_t* buffer = cache->buffers[0];
+
+        // the ops outside the strip return before any drawing
+        surface = (ILI9341_Surface){.buffer = buffer, .x = 0, .y = y, .width = width, .height = stripHeight};
+        ILI9341_PushClip(&renderer, 0, y, width, stripHeight);
+        ILI9341_Page_Draw(page, &renderer);
+        ILI9341_PopClip(&renderer);
+
+        for (int_fast16_t row = 0; row < stripHeight; row++) {
+            // offsets are 16-bit, larger pages are not cached
+            if (cache->used - start > UINT16_MAX ||
+                !ILI9341_PageCache_EncodeRow(cache, &buffer[row * width], width)) {
+                cache->used = start;
+                return false;
+            }
+            offsets[y + row] = cache->used - start;
+        }
+    }
+
+    // each offset is the end of its row, shifted by one row to be the start
+    for (int_fast16_t row = height - 1; row > 0; row--) offsets[row] = offsets[row - 1];
+    offsets[0] = height;
+
+    cache->entries[cache->count++] = (ILI9341_PageCacheEntry){.page = page, .data = offsets};
+    return true;
+}
+
+/**
+ * @brief Decode a part of a row
+ * @param runs Runs of the row
+ * @param x0 First pixel to decode
+ * @param count Number of pixels to decode
+ * @param pixels Output pixels
+ */
+static void ILI9341_PageCache_DecodeRow(const uint16_t* runs, int_fast16_t x0, int_fast16_t count, uint16_t* pixels) {
+    while (count > 0) {
+        uint16_t header = *(runs++);
+        int_fast16_t length = header & 0x7FFF;
+
+        if (x0 >= length) {
+            x0 -= length;
+            runs += header & 0x8000 ? length : 1;
+            continue;
+        }
+
+        int_fast16_t n = length - x0 < count ? length - x0 : count;
+        if (header & 0x8000) {
+            memcpy(pixels, &runs[x0], n * sizeof(uint16_t));
+            runs += length;
+        } else {
+            for (int_fast16_t i = 0; i < n; i++) pixels[i] = *runs;
+            runs++;
+        }
+
+        pixels += n;
+        count -= n;
+        x0 = 0;
+    }
+}
+
+bool ILI9341_PageCache_Draw(
+    ILI9341_PageCache* cache,
+    const ILI9341_Page* page,
+    const ILI9341_HandleTypeDef* ili9341
+) {
+    const ILI9341_PageCacheEntry* entry = NULL;
+    for (size_t i = 0; i < cache->count && !entry; i++) {
+        if (cache->entries[i].page == page) entry = &cache->entries[i];
+    }
+    if (!entry || ili9341->displayList || ili9341->surface) return false;
+
+    // only the part inside the clip rectangle is decoded and sent, with one address window per strip
+    ILI9341_Rect area = {.x0 = 0, .y0 = 0, .x1 = page->width - 1, .y1 = page->height - 1};
+    if (ili9341->clip && ili9341->clip->depth > 0) {
+        const ILI9341_Rect* rect = &ili9341->clip->rects[ili9341->clip->depth - 1];
+        if (rect->x0 > area.x0) area.x0 = rect->x0;
+        if (rect->y0 > area.y0) area.y0 = rect->y0;
+        if (rect->x1 < area.x1) area.x1 = rect->x1;
+        if (rect->y1 < area.y1) area.y1 = rect->y1;
+    }
+    if (area.x1 >= ili9341->width) area.x1 = ili9341->width - 1;
+    if (area.y1 >= ili9341->height) area.y1 = ili9341->height - 1;
+    if (area.x0 > area.x1 || area.y0 > area.y1) return true;
+
+    const int_fast16_t width = area.x1 - area.x0 + 1;
+    const int_fast16_t rows = ILI9341_PAGECACHE_STRIP_HEIGHT * ILI9341_PAGECACHE_MAX_WIDTH / width;
+    uint_fast8_t current = 0;
+    bool sending = false;
+
+    for (int_fast16_t y = area.y0; y <= area.y1; y += rows) {
+        const int_fast16_t height = area.y1 - y + 1 < rows ? area.y1 - y + 1 : rows;
+        uint16_t* buffer = cache->buffers[current];
+
+        // this buffer was sent two strips ago, the transfer of the previous strip may still be running
+        for (int_fast16_t row = 0; row < height; row++)
+            ILI9341_PageCache_DecodeRow(&entry->data[entry->data[y + row]], area.x0, width, &buffer[row * width]);
+
+        if (sending) ILI9341_WaitTransfer(ili9341);
+        ILI9341_StartTransfer(ili9341, area.x0, y, area.x1, y + height - 1, buffer);
+        sending = true;
+        current ^= 1;
+    }
+
+    ILI9341_WaitTransfer(ili9341);
+    return true;
+}
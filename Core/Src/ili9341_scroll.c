@@ -0,0 +1,299 @@
+#include "ili9341_scroll.h"
+
+#include "string.h"
+
+/**
+ * @brief Get the glyph of a character, using the fallback glyph for out-of-range characters
+ * @param font Font to get the glyph from
+ * @param c Character to get the glyph of
+ */
+static const ILI9341_GlyphDef* ILI9341_Scroll_GetGlyph(const ILI9341_FontDef* font, unsigned char c) {
+    if (c < font->startCodepoint || c > font->endCodepoint) c = FALLBACK_CODEPOINT;
+    return &font->glyphs[c - font->startCodepoint];
+}
+
+/**
+ * @brief Render one text column of the ticker band
+ * @param ticker Pointer to the ticker
+ * @param buffer Output buffer of (ascent + descent) * scale pixels in RGB565 format with the 2 bytes swapped
+ */
+static void ILI9341_Ticker_RenderColumn(const ILI9341_Ticker* ticker, uint16_t* buffer) {
+    const int_fast16_t scale = ticker->scale;
+    const int_fast16_t height = (ticker->font.ascent + ticker->font.descent) * scale;
+    const uint16_t bgColor = (ticker->bgColor >> 8) | (ticker->bgColor << 8);
+
+    for (int_fast16_t row = 0; row < height; row++) buffer[row] = bgColor;
+
+    // past the end of the string is the gap
+    if (ticker->str[ticker->charIndex] == '\0') return;
+
+    const ILI9341_GlyphDef* glyph = ILI9341_Scroll_GetGlyph(&ticker->font, ticker->str[ticker->charIndex]);
+    int_fast16_t col = ticker->position - ticker->charStart - glyph->bbX * scale;
+    if (glyph->bbW == 0 || glyph->bbH == 0 || col < 0 || col >= glyph->bbW * scale) return;
+
+    uint16_t binaryPalette[2];
+    const uint16_t* palette = binaryPalette;
+    const uint_fast8_t bpp = glyph->bpp > 1 ? glyph->bpp : 1;
+    const uint_fast8_t pixelsPerByteShift = bpp == 1 ? 3 : bpp == 2 ? 2 : 1;
+    const uint_fast8_t pixelInByteMask = (1 << pixelsPerByteShift) - 1;
+    const uint_fast8_t levelMask = (1 << bpp) - 1;
+
+    if (bpp > 1) {
+        palette = ILI9341_GetBlendPalette(ticker->color, ticker->bgColor, bpp);
+    } else {
+        binaryPalette[0] = bgColor;
+        binaryPalette[1] = (ticker->color >> 8) | (ticker->color << 8);
+    }
+
+    // band row 0 is the ascent line, glyph row 0 is its top row
+    int_fast16_t glyphTop = (ticker->font.ascent - glyph->bbY - glyph->bbH) * scale;
+    int_fast16_t startRow = glyphTop < 0 ? 0 : glyphTop;
+    int_fast16_t endRow = glyphTop + glyph->bbH * scale;
+    if (endRow > height) endRow = height;
+
+    for (int_fast16_t row = startRow; row < endRow; row++) {
+        int_fast32_t pixelIndex = (row - glyphTop) / scale * glyph->bbW + col / scale;
+        uint_fast8_t shift = 8 - bpp * ((pixelIndex & pixelInByteMask) + 1);
+
+        buffer[row] = palette[(glyph->data[pixelIndex >> pixelsPerByteShift] >> shift) & levelMask];
+    }
+}
+
+/**
+ * @brief Move the ticker to the next text column
+ * @param ticker Pointer to the ticker
+ */
+static void ILI9341_Ticker_Advance(ILI9341_Ticker* ticker) {
+    ticker->position++;
+
+    if (ticker->position >= ticker->length) {
+        ticker->position = 0;
+        ticker->charIndex = 0;
+        ticker->charStart = 0;
+        return;
+    }
+
+    char c = ticker->str[ticker->charIndex];
+    if (c == '\0') return;
+
+    int_fast16_t advance = ILI9341_Scroll_GetGlyph(&ticker->font, c)->advance * ticker->scale;
+    if (ticker->position >= ticker->charStart + advance) {
+        ticker->charIndex++;
+        ticker->charStart += advance;
+    }
+}
+
+bool ILI9341_Ticker_Init(
+    ILI9341_Ticker* ticker,
+    ILI9341_HandleTypeDef* ili9341,
+    bool hardware,
+    int_fast16_t x,
+    int_fast16_t width,
+    int_fast16_t y,
+    const char* str,
+    ILI9341_FontDef font,
+    uint16_t color,
+    uint16_t bgColor,
+    int_fast16_t scale,
+    int_fast16_t gap
+) {
+    if (hardware && ili9341->rotation != ILI9341_ROTATION_HORIZONTAL_1 &&
+        ili9341->rotation != ILI9341_ROTATION_HORIZONTAL_2)
+        return false;
+    if (scale < 1 || (font.ascent + font.descent) * scale > ILI9341_TICKER_MAX_HEIGHT) return false;
+
+    int_fast16_t length = gap > 0 ? gap : 0;
+    for (const char* c = str; *c; c++) length += ILI9341_Scroll_GetGlyph(&font, *c)->advance * scale;
+    if (length < 1) length = 1;
+
+    const ILI9341_Ticker result = {
+        .ili9341 = ili9341,
+        .hardware = hardware,
+        .x = x,
+        .width = width,
+        .str = str,
+        .font = font,
+        .color = color,
+        .bgColor = bgColor,
+        .y = y,
+        .scale = scale,
+        .gap = gap,
+        .length = length,
+        .position = 0,
+        .charIndex = 0,
+        .charStart = 0
+    };
+    memcpy(ticker, &result, sizeof(result));
+
+    if (hardware) ILI9341_SetScrollArea(ili9341, x, width);
+
+    return true;
+}
+
+/**
+ * @brief Draw the whole band from the text column at its left, without hardware scrolling
+ * @param ticker Pointer to the ticker, its position is left unchanged
+ * @param top Y coordinate of the top of the band
+ * @param height Height of the band in pixels
+ */
+static void ILI9341_Ticker_DrawBand(ILI9341_Ticker* ticker, int_fast16_t top, int_fast16_t height) {
+    const int_fast16_t position = ticker->position, charStart = ticker->charStart;
+    const size_t charIndex = ticker->charIndex;
+
+    // columns are rendered top to bottom and drawn a few at a time as a row-major image
+    uint16_t column[ILI9341_TICKER_MAX_HEIGHT];
+    uint16_t buffer[ILI9341_TICKER_COLUMNS * ILI9341_TICKER_MAX_HEIGHT];
+    for (int_fast16_t left = 0; left < ticker->width; left += ILI9341_TICKER_COLUMNS) {
+        int_fast16_t count = ticker->width - left;
+        if (count > ILI9341_TICKER_COLUMNS) count = ILI9341_TICKER_COLUMNS;
+
+        for (int_fast16_t col = 0; col < count; col++) {
+            ILI9341_Ticker_RenderColumn(ticker, column);
+            for (int_fast16_t row = 0; row < height; row++) buffer[row * count + col] = column[row];
+            ILI9341_Ticker_Advance(ticker);
+        }
+
+        ILI9341_DrawImage(ticker->ili9341, ticker->x + left, top, count, height, buffer);
+    }
+
+    ticker->position = position;
+    ticker->charIndex = charIndex;
+    ticker->charStart = charStart;
+}
+
+void ILI9341_Ticker_Step(ILI9341_Ticker* ticker, int_fast16_t pixels) {
+    ILI9341_HandleTypeDef* ili9341 = ticker->ili9341;
+    const int_fast16_t end = ili9341->scrollStart + ili9341->scrollLength;
+    const int_fast16_t top = ticker->y - ticker->font.ascent * ticker->scale + 1;
+    const int_fast16_t height = (ticker->font.ascent + ticker->font.descent) * ticker->scale;
+
+    if (!ticker->hardware) {
+        if (pixels <= 0 || ticker->width <= 0) return;
+
+        for (pixels %= ticker->length; pixels > 0; pixels--) ILI9341_Ticker_Advance(ticker);
+        ILI9341_Ticker_DrawBand(ticker, top, height);
+        return;
+    }
+
+    if (pixels <= 0 || ili9341->scrollLength == 0) return;
+    if (pixels > ili9341->scrollLength) pixels = ili9341->scrollLength;
+
+    ILI9341_SetScrollOffset(ili9341, ili9341->scrollOffset + pixels);
+
+    // the columns that wrapped around from the left are now the rightmost ones
+    uint16_t buffer[ILI9341_TICKER_MAX_HEIGHT];
+    for (int_fast16_t position = end - pixels; position < end; position++) {
+        ILI9341_Ticker_RenderColumn(ticker, buffer);
+        ILI9341_DrawImage(ili9341, ILI9341_GetScrollPosition(ili9341, position), top, 1, height, buffer);
+        ILI9341_Ticker_Advance(ticker);
+    }
+}
+
+void ILI9341_Console_Init(
+    ILI9341_Console* console,
+    ILI9341_HandleTypeDef* ili9341,
+    int_fast16_t y,
+    int_fast16_t height,
+    ILI9341_FontDef font,
+    uint16_t color,
+    uint16_t bgColor
+) {
+    int_fast16_t lineHeight = font.ascent + font.descent;
+    int_fast16_t visibleLines = height / lineHeight;
+
+    // the line being written must not be visible
+    if (visibleLines > ILI9341_CONSOLE_LINES - 1) visibleLines = ILI9341_CONSOLE_LINES - 1;
+    if (visibleLines < 1) visibleLines = 1;
+
+    const ILI9341_Console result = {
+        .ili9341 = ili9341,
+        .font = font,
+        .color = color,
+        .bgColor = bgColor,
+        .y = y,
+        .lineHeight = lineHeight,
+        .visibleLines = visibleLines,
+        .hardware = ili9341->rotation == ILI9341_ROTATION_VERTICAL_1 || ili9341->rotation == ILI9341_ROTATION_VERTICAL_2,
+        .written = 0,
+        .drawn = 0,
+        .column = 0
+    };
+    memcpy(console, &result, sizeof(result));
+
+    if (result.hardware) ILI9341_SetScrollArea(ili9341, y, visibleLines * lineHeight);
+
+    ILI9341_FillRectangle(ili9341, 0, y, ili9341->width, visibleLines * lineHeight, bgColor);
+}
+
+void ILI9341_Console_Print(ILI9341_Console* console, const char* str) {
+    for (; *str; str++) {
+        char* line = console->lines[console->written % ILI9341_CONSOLE_LINES];
+
+        if (*str == '\r') continue;
+        if (*str != '\n') line[console->column++] = *str;
+
+        if (*str == '\n' || console->column >= ILI9341_CONSOLE_LINE_LENGTH) {
+            line[console->column] = '\0';
+            console->column = 0;
+            console->written++;
+        }
+    }
+}
+
+/**
+ * @brief Draw a console line at the specified position, clearing the rest of the line
+ * @param console Pointer to the console
+ * @param y Y coordinate of the top of the line
+ * @param line Null-terminated line to draw
+ */
+static void ILI9341_Console_DrawLine(const ILI9341_Console* console, int_fast16_t y, const char* line) {
+    const ILI9341_HandleTypeDef* ili9341 = console->ili9341;
+
+    ILI9341_FillRectangle(ili9341, 0, y, ili9341->width, console->lineHeight, console->bgColor);
+    ILI9341_WriteString(
+        ili9341,
+        0,
+        y + console->font.ascent - 1,
+        line,
+        console->font,
+        console->color,
+        console->bgColor,
+        false,
+        1,
+        0,
+        0
+    );
+}
+
+void ILI9341_Console_Update(ILI9341_Console* console) {
+    const uint_fast32_t written = console->written;
+    const int_fast16_t visibleLines = console->visibleLines;
+
+    if (console->drawn == written) return;
+
+    if (console->hardware) {
+        // lines scrolled out before being drawn are skipped
+        if (written - console->drawn > (uint_fast32_t)visibleLines) console->drawn = written - visibleLines;
+
+        const int_fast16_t bottom = console->y + (visibleLines - 1) * console->lineHeight;
+        for (; console->drawn < written; console->drawn++) {
+            ILI9341_SetScrollOffset(console->ili9341, console->ili9341->scrollOffset + console->lineHeight);
+            ILI9341_Console_DrawLine(
+                console,
+                ILI9341_GetScrollPosition(console->ili9341, bottom),
+                console->lines[console->drawn % ILI9341_CONSOLE_LINES]
+            );
+        }
+    } else {
+        // newest line at the bottom, same as with hardware scrolling
+        for (int_fast16_t i = 0; i < visibleLines; i++) {
+            int_fast32_t index = (int_fast32_t)written - visibleLines + i;
+            ILI9341_Console_DrawLine(
+                console,
+                console->y + i * console->lineHeight,
+                index >= 0 ? console->lines[index % ILI9341_CONSOLE_LINES] : ""
+            );
+        }
+        console->drawn = written;
+    }
+}
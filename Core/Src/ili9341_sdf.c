@@ -0,0 +1,242 @@
+#include "ili9341_sdf.h"
+
+#include "string.h"
+
+/**
+ * @brief Rasterized glyphs of one SDF font at one pixel height
+ */
+typedef struct {
+    const ILI9341_SDFFontDef* font;
+    int_fast16_t height;
+    uint32_t lastUse;
+    size_t used;
+    int_fast16_t averageWidth;
+    bool rasterized[ILI9341_SDF_CACHE_GLYPHS];
+    ILI9341_GlyphDef glyphs[ILI9341_SDF_CACHE_GLYPHS];
+    uint8_t data[ILI9341_SDF_CACHE_BUFFER_SIZE];
+} ILI9341_SDF_CacheSlot;
+
+static ILI9341_SDF_CacheSlot ILI9341_SDF_Cache[ILI9341_SDF_CACHE_SLOTS];
+static uint32_t ILI9341_SDF_UseCounter = 0;
+
+/**
+ * @brief Integer division rounding towards negative infinity
+ */
+static int_fast32_t ILI9341_SDF_FloorDiv(int_fast32_t a, int_fast32_t b) {
+    return a >= 0 ? a / b : -((-a + b - 1) / b);
+}
+
+/**
+ * @brief Integer division rounding towards positive infinity
+ */
+static int_fast32_t ILI9341_SDF_CeilDiv(int_fast32_t a, int_fast32_t b) {
+    return a >= 0 ? (a + b - 1) / b : -(-a / b);
+}
+
+/**
+ * @brief Get the number of glyphs of the font that fit in a cache slot
+ * @param font Pointer to the SDF font definition
+ */
+static size_t ILI9341_SDF_GlyphCount(const ILI9341_SDFFontDef* font) {
+    size_t count = font->endCodepoint - font->startCodepoint + 1;
+    return count > ILI9341_SDF_CACHE_GLYPHS ? ILI9341_SDF_CACHE_GLYPHS : count;
+}
+
+/**
+ * @brief Drop all rasterized glyphs of a slot, leaving empty glyphs with scaled advance
+ * @param slot Cache slot to reset
+ */
+static void ILI9341_SDF_ResetSlot(ILI9341_SDF_CacheSlot* slot) {
+    const ILI9341_SDFFontDef* font = slot->font;
+    int_fast32_t size = font->ascent + font->descent;
+    size_t count = ILI9341_SDF_GlyphCount(font);
+    int_fast32_t advanceSum = 0;
+
+    for (size_t i = 0; i < count; i++) {
+        int_fast32_t advance = (font->glyphs[i].advance * slot->height * 2 + size) / (2 * size);
+        const ILI9341_GlyphDef empty = {0, 0, 0, 0, advance, NULL, 4};
+        memcpy(&slot->glyphs[i], &empty, sizeof(empty));
+        slot->rasterized[i] = false;
+        advanceSum += advance;
+    }
+
+    slot->averageWidth = advanceSum * 10 / count;
+    slot->used = 0;
+}
+
+/**
+ * @brief Find the cache slot of a (font, height) pair, reusing the least recently used slot on miss
+ * @param font Pointer to the SDF font definition
+ * @param height Pixel height of the rendered font
+ */
+static ILI9341_SDF_CacheSlot* ILI9341_SDF_GetSlot(const ILI9341_SDFFontDef* font, int_fast16_t height) {
+    ILI9341_SDF_CacheSlot* slot = &ILI9341_SDF_Cache[0];
+
+    for (size_t i = 0; i < ILI9341_SDF_CACHE_SLOTS; i++) {
+        if (ILI9341_SDF_Cache[i].font == font && ILI9341_SDF_Cache[i].height == height) {
+            slot = &ILI9341_SDF_Cache[i];
+            slot->lastUse = ++ILI9341_SDF_UseCounter;
+            return slot;
+        }
+        if (ILI9341_SDF_Cache[i].lastUse < slot->lastUse) slot = &ILI9341_SDF_Cache[i];
+    }
+
+    slot->font = font;
+    slot->height = height;
+    slot->lastUse = ++ILI9341_SDF_UseCounter;
+    ILI9341_SDF_ResetSlot(slot);
+
+    return slot;
+}
+
+/**
+ * @brief Bilinearly sample a distance field, coordinates outside the field are clamped to the edge
+ * @param glyph SDF glyph to sample
+ * @param u Column in texels, 16.16 fixed point, 0 is the center of the first column
+ * @param v Row in texels from the top, 16.16 fixed point, 0 is the center of the first row
+ * @return Distance value in 8.8 fixed point
+ */
+static int_fast32_t ILI9341_SDF_Sample(const ILI9341_GlyphDef* glyph, int_fast32_t u, int_fast32_t v) {
+    int_fast32_t col0 = u >> 16, row0 = v >> 16;
+    int_fast32_t fx = (u >> 8) & 0xFF, fy = (v >> 8) & 0xFF;
+    int_fast32_t col1 = col0 + 1, row1 = row0 + 1;
+
+    if (col0 < 0) col0 = 0;
+    if (col0 >= glyph->bbW) col0 = glyph->bbW - 1;
+    if (col1 < 0) col1 = 0;
+    if (col1 >= glyph->bbW) col1 = glyph->bbW - 1;
+    if (row0 < 0) row0 = 0;
+    if (row0 >= glyph->bbH) row0 = glyph->bbH - 1;
+    if (row1 < 0) row1 = 0;
+    if (row1 >= glyph->bbH) row1 = glyph->bbH - 1;
+
+    const uint8_t* top = &glyph->data[row0 * glyph->bbW];
+    const uint8_t* bottom = &glyph->data[row1 * glyph->bbW];
+    int_fast32_t upper = top[col0] * (256 - fx) + top[col1] * fx;
+    int_fast32_t lower = bottom[col0] * (256 - fx) + bottom[col1] * fx;
+
+    return (upper * (256 - fy) + lower * fy) >> 8;
+}
+
+/**
+ * @brief Rasterize one glyph of a slot into 4bpp coverage
+ * @param slot Cache slot of the (font, height) pair
+ * @param index Glyph index (codepoint - startCodepoint)
+ * @return false if the glyph does not fit in the remaining slot buffer
+ */
+static bool ILI9341_SDF_RasterizeGlyph(ILI9341_SDF_CacheSlot* slot, size_t index) {
+    const ILI9341_SDFFontDef* font = slot->font;
+    const ILI9341_GlyphDef* src = &font->glyphs[index];
+    int_fast32_t size = font->ascent + font->descent;
+    int_fast32_t height = slot->height;
+
+    if (src->bbW == 0 || src->bbH == 0 || src->data == NULL) {
+        slot->rasterized[index] = true;
+        return true;
+    }
+
+    int_fast32_t x0 = ILI9341_SDF_FloorDiv(src->bbX * height, size);
+    int_fast32_t x1 = ILI9341_SDF_CeilDiv((src->bbX + src->bbW) * height, size);
+    int_fast32_t y0 = ILI9341_SDF_FloorDiv(src->bbY * height, size);
+    int_fast32_t y1 = ILI9341_SDF_CeilDiv((src->bbY + src->bbH) * height, size);
+    int_fast32_t w = x1 - x0 > 127 ? 127 : x1 - x0;
+    int_fast32_t h = y1 - y0 > 127 ? 127 : y1 - y0;
+    size_t bytes = (w * h + 1) / 2;
+
+    if (slot->used + bytes > ILI9341_SDF_CACHE_BUFFER_SIZE) return false;
+
+    uint8_t* out = &slot->data[slot->used];
+    memset(out, 0, bytes);
+
+    // texels per output pixel, and field units per output pixel which is the width of the anti-aliased edge
+    int_fast32_t step = (size << 16) / height;
+    int_fast32_t edgeWidth = ((step * 127) / font->spread) >> 8;
+    if (edgeWidth < 1) edgeWidth = 1;
+
+    // sample at pixel centers, texel centers are at +0.5
+    int_fast32_t v = ((src->bbY + src->bbH) << 16) - (2 * y1 - 1) * step / 2 - 0x8000;
+    int_fast32_t uStart = (2 * x0 + 1) * step / 2 - (src->bbX << 16) - 0x8000;
+    size_t pixel = 0;
+
+    for (int_fast32_t row = 0; row < h; row++, v += step) {
+        int_fast32_t u = uStart;
+        for (int_fast32_t col = 0; col < w; col++, u += step, pixel++) {
+            int_fast32_t coverage = (((ILI9341_SDF_Sample(src, u, v) - (128 << 8)) << 8) / edgeWidth) + 128;
+            if (coverage <= 0) continue;
+            if (coverage > 255) coverage = 255;
+
+            uint8_t level = (coverage * 15 + 127) / 255;
+            out[pixel >> 1] |= (pixel & 1) ? level : level << 4;
+        }
+    }
+
+    const ILI9341_GlyphDef glyph = {x0, y0, w, h, slot->glyphs[index].advance, out, 4};
+    memcpy(&slot->glyphs[index], &glyph, sizeof(glyph));
+    slot->rasterized[index] = true;
+    slot->used += bytes;
+
+    return true;
+}
+
+/**
+ * @brief Rasterize a glyph if it is not cached yet
+ * @param slot Cache slot of the (font, height) pair
+ * @param c Character to rasterize
+ * @return false if the glyph does not fit in the remaining slot buffer
+ */
+static bool ILI9341_SDF_PrepareGlyph(ILI9341_SDF_CacheSlot* slot, unsigned char c) {
+    const ILI9341_SDFFontDef* font = slot->font;
+    if (c < font->startCodepoint || c > font->endCodepoint) c = FALLBACK_CODEPOINT;
+
+    size_t index = c - font->startCodepoint;
+    if (index >= ILI9341_SDF_GlyphCount(font) || slot->rasterized[index]) return true;
+
+    return ILI9341_SDF_RasterizeGlyph(slot, index);
+}
+
+ILI9341_FontDef ILI9341_SDF_GetFont(const ILI9341_SDFFontDef* font, int_fast16_t height, const char* str) {
+    if (height < 1) height = 1;
+    if (height > ILI9341_SDF_MAX_HEIGHT) height = ILI9341_SDF_MAX_HEIGHT;
+
+    ILI9341_SDF_CacheSlot* slot = ILI9341_SDF_GetSlot(font, height);
+
+    // on overflow start over with an empty slot once, glyphs that still don't fit are left empty
+    for (int_fast8_t attempt = 0; attempt < 2; attempt++) {
+        bool fits = ILI9341_SDF_PrepareGlyph(slot, FALLBACK_CODEPOINT);
+        for (const char* c = str; c && *c; c++) { fits = ILI9341_SDF_PrepareGlyph(slot, *c) && fits; }
+
+        if (fits) break;
+        if (attempt == 0) ILI9341_SDF_ResetSlot(slot);
+    }
+
+    int_fast16_t ascent = ILI9341_SDF_CeilDiv(font->ascent * height, font->ascent + font->descent);
+    const ILI9341_FontDef result = {
+        font->startCodepoint,
+        font->startCodepoint + ILI9341_SDF_GlyphCount(font) - 1,
+        slot->averageWidth,
+        ascent,
+        height - ascent,
+        slot->glyphs
+    };
+
+    return result;
+}
+
+void ILI9341_WriteStringSDF(
+    const ILI9341_HandleTypeDef* ili9341,
+    int_fast16_t x,
+    int_fast16_t y,
+    const char* str,
+    const ILI9341_SDFFontDef* font,
+    int_fast16_t height,
+    uint16_t color,
+    uint16_t bgcolor,
+    bool wrap,
+    int_fast16_t tracking,
+    int_fast16_t leading
+) {
+    if (height < 1) return;
+
+    ILI9341_FontDef bitmapFont = ILI9341_SDF_GetFont(font, height, str);
+    ILI9341_WriteString(ili9341, x, y, str, bitmapFont, color, bgcolor, wrap, 1, tracking, leading);
+}
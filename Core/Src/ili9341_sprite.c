@@ -0,0 +1,198 @@
+#include "ili9341_sprite.h"
+
+#include "string.h"
+
+void ILI9341_SpriteLayer_Init(
+    ILI9341_SpriteLayer* layer,
+    const ILI9341_HandleTypeDef* ili9341,
+    ILI9341_SpriteBackground background,
+    void* context
+) {
+    layer->ili9341 = ili9341;
+    layer->background = background;
+    layer->context = context;
+    layer->count = 0;
+    layer->buffer = 0;
+    layer->sending = false;
+}
+
+void ILI9341_Sprite_Init(
+    ILI9341_Sprite* sprite,
+    const uint16_t* image,
+    const uint8_t* mask,
+    uint16_t colorKey,
+    int_fast16_t width,
+    int_fast16_t height
+) {
+    const ILI9341_Sprite result = {
+        .image = image,
+        .mask = mask,
+        .colorKey = colorKey,
+        .x = 0,
+        .y = 0,
+        .width = width,
+        .height = height,
+        .drawnX = 0,
+        .drawnY = 0,
+        .drawn = false,
+        .visible = false,
+        .dirty = false
+    };
+    memcpy(sprite, &result, sizeof(result));
+}
+
+bool ILI9341_SpriteLayer_Add(ILI9341_SpriteLayer* layer, ILI9341_Sprite* sprite) {
+    if (layer->count >= ILI9341_SPRITE_MAX) return false;
+
+    layer->sprites[layer->count++] = sprite;
+    sprite->dirty = true;
+
+    return true;
+}
+
+void ILI9341_Sprite_MoveTo(ILI9341_Sprite* sprite, int_fast16_t x, int_fast16_t y) {
+    if (x == sprite->x && y == sprite->y) return;
+
+    sprite->x = x;
+    sprite->y = y;
+    sprite->dirty = true;
+}
+
+void ILI9341_Sprite_Show(ILI9341_Sprite* sprite, bool visible) {
+    if (visible == sprite->visible) return;
+
+    sprite->visible = visible;
+    sprite->dirty = true;
+}
+
+void ILI9341_Sprite_SetImage(ILI9341_Sprite* sprite, const uint16_t* image, const uint8_t* mask) {
+    if (image == sprite->image && mask == sprite->mask) return;
+
+    sprite->image = image;
+    sprite->mask = mask;
+    sprite->dirty = true;
+}
+
+/**
+ * @brief Draw the rows of a sprite inside a strip
+ * @param sprite Pointer to the sprite
+ * @param renderer Handle drawing to the strip
+ * @param y0 Y coordinate of the top row of the strip
+ * @param y1 Y coordinate of the bottom row of the strip (inclusive)
+ * @note Only the rows inside the strip are given to ILI9341_DrawImageTransparent, the columns are clipped by the
+ * surface.
+ */
+static void ILI9341_Sprite_DrawRows(
+    const ILI9341_Sprite* sprite,
+    const ILI9341_HandleTypeDef* renderer,
+    int_fast16_t y0,
+    int_fast16_t y1
+) {
+    int_fast16_t first = y0 > sprite->y ? y0 - sprite->y : 0;
+    int_fast16_t last = y1 < sprite->y + sprite->height - 1 ? y1 - sprite->y : sprite->height - 1;
+    if (first > last) return;
+
+    const int_fast16_t stride = (sprite->width + 7) / 8;
+
+    ILI9341_DrawImageTransparent(
+        renderer,
+        sprite->x,
+        sprite->y + first,
+        sprite->width,
+        last - first + 1,
+        &sprite->image[first * sprite->width],
+        sprite->mask ? &sprite->mask[first * stride] : NULL,
+        sprite->colorKey
+    );
+}
+
+/**
+ * @brief Render an area in strips and send them, one strip is sent while the next one is rendered
+ * @param layer Pointer to the layer
+ * @param x0 X coordinate of the top-left corner of the area
+ * @param y0 Y coordinate of the top-left corner of the area
+ * @param x1 X coordinate of the bottom-right corner of the area (inclusive)
+ * @param y1 Y coordinate of the bottom-right corner of the area (inclusive)
+ * @note The area is clipped to the display. The last strip may still be sending on return.
+ */
+static void ILI9341_SpriteLayer_RenderRect(
+    ILI9341_SpriteLayer* layer,
+    int_fast16_t x0,
+    int_fast16_t y0,
+    int_fast16_t x1,
+    int_fast16_t y1
+) {
+    const ILI9341_HandleTypeDef* ili9341 = layer->ili9341;
+
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 >= ili9341->width) x1 = ili9341->width - 1;
+    if (y1 >= ili9341->height) y1 = ili9341->height - 1;
+    if (x0 > x1 || y0 > y1) return;
+
+    const int_fast16_t width = x1 - x0 + 1;
+    const int_fast16_t rows = ILI9341_SPRITE_BUFFER_SIZE / width;
+
+    ILI9341_HandleTypeDef renderer = *ili9341;
+    ILI9341_Surface surface;
+    renderer.surface = &surface;
+    renderer.displayList = NULL;
+    renderer.clip = NULL;
+
+    for (int_fast16_t y = y0; y <= y1; y += rows) {
+        const int_fast16_t height = y1 - y + 1 < rows ? y1 - y + 1 : rows;
+        const ILI9341_Rect strip = {.x0 = x0, .y0 = y, .x1 = x1, .y1 = y + height - 1};
+        uint16_t* buffer = layer->buffers[layer->buffer];
+
+        // this buffer was sent two strips ago, the transfer of the previous strip may still be running
+        surface = (ILI9341_Surface){.buffer = buffer, .x = x0, .y = y, .width = width, .height = height};
+        layer->background(&renderer, &strip, layer->context);
+
+        for (size_t i = 0; i < layer->count; i++) {
+            const ILI9341_Sprite* sprite = layer->sprites[i];
+            if (!sprite->visible || sprite->x > x1 || sprite->x + sprite->width - 1 < x0) continue;
+
+            ILI9341_Sprite_DrawRows(sprite, &renderer, strip.y0, strip.y1);
+        }
+
+        if (layer->sending) ILI9341_WaitTransfer(ili9341);
+        ILI9341_StartTransfer(ili9341, x0, strip.y0, x1, strip.y1, buffer);
+        layer->sending = true;
+        layer->buffer ^= 1;
+    }
+}
+
+void ILI9341_SpriteLayer_Update(ILI9341_SpriteLayer* layer) {
+    for (size_t i = 0; i < layer->count; i++) {
+        ILI9341_Sprite* sprite = layer->sprites[i];
+        if (!sprite->dirty) continue;
+
+        const int_fast16_t oldX0 = sprite->drawnX, oldY0 = sprite->drawnY;
+        const int_fast16_t oldX1 = oldX0 + sprite->width - 1, oldY1 = oldY0 + sprite->height - 1;
+        const int_fast16_t newX0 = sprite->x, newY0 = sprite->y;
+        const int_fast16_t newX1 = newX0 + sprite->width - 1, newY1 = newY0 + sprite->height - 1;
+
+        if (sprite->drawn && sprite->visible && oldX0 <= newX1 + 1 && newX0 <= oldX1 + 1 && oldY0 <= newY1 + 1 &&
+            newY0 <= oldY1 + 1) {
+            // small moves send the union of both areas once
+            ILI9341_SpriteLayer_RenderRect(
+                layer,
+                oldX0 < newX0 ? oldX0 : newX0,
+                oldY0 < newY0 ? oldY0 : newY0,
+                oldX1 > newX1 ? oldX1 : newX1,
+                oldY1 > newY1 ? oldY1 : newY1
+            );
+        } else {
+            if (sprite->drawn) ILI9341_SpriteLayer_RenderRect(layer, oldX0, oldY0, oldX1, oldY1);
+            if (sprite->visible) ILI9341_SpriteLayer_RenderRect(layer, newX0, newY0, newX1, newY1);
+        }
+
+        sprite->drawnX = sprite->x;
+        sprite->drawnY = sprite->y;
+        sprite->drawn = sprite->visible;
+        sprite->dirty = false;
+    }
+
+    if (layer->sending) ILI9341_WaitTransfer(layer->ili9341);
+    layer->sending = false;
+}
@@ -0,0 +1,486 @@
+#include "ili9341_widget.h"
+
+#include "string.h"
+
+/**
+ * @brief Initialize the fields common to all widgets, the widget starts visible and dirty
+ * @param widget Pointer to the widget
+ * @param type Widget type, one of ILI9341_WIDGET_* values
+ * @param x X coordinate of the top-left corner of the box
+ * @param y Y coordinate of the top-left corner of the box
+ * @param width Width of the box
+ * @param height Height of the box
+ */
+static void ILI9341_Widget_Init(
+    ILI9341_Widget* widget,
+    uint_fast8_t type,
+    int_fast16_t x,
+    int_fast16_t y,
+    int_fast16_t width,
+    int_fast16_t height
+) {
+    memset(widget, 0, sizeof(*widget));
+    widget->type = type;
+    widget->visible = true;
+    widget->dirty = true;
+    widget->x = x;
+    widget->y = y;
+    widget->width = width;
+    widget->height = height;
+}
+
+/**
+ * @brief Format the value and the suffix of a number
+ * @param widget Pointer to the number
+ * @param text Output buffer of ILI9341_WIDGET_TEXT_SIZE characters
+ */
+static void ILI9341_Widget_FormatNumber(const ILI9341_Widget* widget, char* text) {
+    char digits[11];
+    size_t count = 0, length = 0;
+    uint32_t value = widget->value < 0 ? -(uint32_t)widget->value : (uint32_t)widget->value;
+
+    do {
+        digits[count++] = '0' + value % 10;
+        value /= 10;
+    } while (value > 0);
+
+    if (widget->value < 0) text[length++] = '-';
+    while (count > 0) text[length++] = digits[--count];
+
+    const char* suffix = widget->suffix ? widget->suffix : "";
+    while (*suffix && length < ILI9341_WIDGET_TEXT_SIZE - 1) text[length++] = *(suffix++);
+    text[length] = '\0';
+}
+
+void ILI9341_Widget_InitContainer(
+    ILI9341_Widget* widget,
+    int_fast16_t x,
+    int_fast16_t y,
+    int_fast16_t width,
+    int_fast16_t height,
+    uint16_t bgColor
+) {
+    ILI9341_Widget_Init(widget, ILI9341_WIDGET_CONTAINER, x, y, width, height);
+    widget->bgColor = bgColor;
+}
+
+void ILI9341_Widget_InitLabel(
+    ILI9341_Widget* widget,
+    int_fast16_t x,
+    int_fast16_t y,
+    int_fast16_t width,
+    int_fast16_t height,
+    const char* text,
+    ILI9341_FontDef font,
+    uint16_t color,
+    uint16_t bgColor,
+    uint_fast8_t align
+) {
+    ILI9341_Widget_Init(widget, ILI9341_WIDGET_LABEL, x, y, width, height);
+    memcpy(&widget->font, &font, sizeof(font));
+    widget->color = color;
+    widget->bgColor = bgColor;
+    widget->align = align;
+    strncpy(widget->text, text, ILI9341_WIDGET_TEXT_SIZE - 1);
+}
+
+void ILI9341_Widget_InitNumber(
+    ILI9341_Widget* widget,
+    int_fast16_t x,
+    int_fast16_t y,
+    int_fast16_t width,
+    int_fast16_t height,
+    int32_t value,
+    const char* suffix,
+    ILI9341_FontDef font,
+    uint16_t color,
+    uint16_t bgColor,
+    uint_fast8_t align
+) {
+    ILI9341_Widget_Init(widget, ILI9341_WIDGET_NUMBER, x, y, width, height);
+    memcpy(&widget->font, &font, sizeof(font));
+    widget->color = color;
+    widget->bgColor = bgColor;
+    widget->align = align;
+    widget->value = value;
+    widget->suffix = suffix;
+    ILI9341_Widget_FormatNumber(widget, widget->text);
+}
+
+void ILI9341_Widget_InitImage(
+    ILI9341_Widget* widget,
+    int_fast16_t x,
+    int_fast16_t y,
+    int_fast16_t width,
+    int_fast16_t height,
+    const uint16_t* image
+) {
+    ILI9341_Widget_Init(widget, ILI9341_WIDGET_IMAGE, x, y, width, height);
+    widget->image = image;
+}
+
+void ILI9341_Widget_InitProgress(
+    ILI9341_Widget* widget,
+    int_fast16_t x,
+    int_fast16_t y,
+    int_fast16_t width,
+    int_fast16_t height,
+    int32_t value,
+    int32_t max,
+    uint16_t color,
+    uint16_t bgColor
+) {
+    ILI9341_Widget_Init(widget, ILI9341_WIDGET_PROGRESS, x, y, width, height);
+    widget->value = value;
+    widget->max = max > 0 ? max : 1;
+    widget->color = color;
+    widget->bgColor = bgColor;
+}
+
+void ILI9341_Widget_InitPage(ILI9341_Widget* widget, const ILI9341_Page* page) {
+    ILI9341_Widget_Init(widget, ILI9341_WIDGET_PAGE, 0, 0, page->width, page->height);
+    widget->page = page;
+}
+
+void ILI9341_Widget_SetPageCache(ILI9341_Widget* widget, ILI9341_PageCache* cache) {
+    widget->cache = cache;
+}
+
+void ILI9341_Widget_InitField(ILI9341_Widget* widget, const ILI9341_PageField* field, int32_t value) {
+    ILI9341_Widget_InitNumber(
+        widget,
+        field->x,
+        field->y,
+        field->width,
+        field->height,
+        value,
+        field->suffix,
+        *field->font,
+        field->color,
+        field->bgColor,
+        field->align
+    );
+}
+
+void ILI9341_Widget_Add(ILI9341_Widget* parent, ILI9341_Widget* child) {
+    ILI9341_Widget** last = &parent->firstChild;
+    while (*last) last = &(*last)->nextSibling;
+
+    *last = child;
+    child->nextSibling = NULL;
+    child->dirty = true;
+}
+
+void ILI9341_Widget_SetText(ILI9341_Widget* widget, const char* text) {
+    if (strncmp(widget->text, text, ILI9341_WIDGET_TEXT_SIZE - 1) == 0) return;
+
+    const size_t length = strnlen(text, ILI9341_WIDGET_TEXT_SIZE - 1);
+    memcpy(widget->text, text, length);
+    widget->text[length] = '\0';
+    widget->textDirty = true;
+}
+
+void ILI9341_Widget_SetValue(ILI9341_Widget* widget, int32_t value) {
+    if (value == widget->value) return;
+
+    widget->value = value;
+
+    if (widget->type == ILI9341_WIDGET_NUMBER) {
+        char text[ILI9341_WIDGET_TEXT_SIZE];
+        ILI9341_Widget_FormatNumber(widget, text);
+        ILI9341_Widget_SetText(widget, text);
+    } else {
+        widget->dirty = true;
+    }
+}
+
+void ILI9341_Widget_SetImage(ILI9341_Widget* widget, const uint16_t* image) {
+    if (image == widget->image) return;
+
+    widget->image = image;
+    widget->dirty = true;
+}
+
+void ILI9341_Widget_SetColor(ILI9341_Widget* widget, uint16_t color, uint16_t bgColor) {
+    if (color == widget->color && bgColor == widget->bgColor) return;
+
+    widget->color = color;
+    widget->bgColor = bgColor;
+    widget->dirty = true;
+}
+
+void ILI9341_Widget_SetVisible(ILI9341_Widget* widget, bool visible) {
+    if (visible == widget->visible) return;
+
+    widget->visible = visible;
+    widget->dirty = true;
+}
+
+void ILI9341_Widget_Invalidate(ILI9341_Widget* widget) {
+    widget->dirty = true;
+}
+
+/**
+ * @brief Get the position and the area of the text of a label or a number
+ * @param widget Pointer to the label or number
+ * @param x Set to the X coordinate of the left of the string
+ * @param y Set to the Y coordinate of the baseline of the string
+ * @return Area covered by the text, full line height, inside the box
+ */
+static ILI9341_Rect ILI9341_Widget_GetTextArea(const ILI9341_Widget* widget, int_fast16_t* x, int_fast16_t* y) {
+    const ILI9341_FontDef font = widget->font;
+    ILI9341_TextBounds bounds = ILI9341_MeasureString(widget->text, font, 1, 0, 0);
+
+    *x = widget->x - bounds.x;
+    if (widget->align == ILI9341_ALIGN_CENTER) *x += (widget->width - bounds.width) / 2;
+    if (widget->align == ILI9341_ALIGN_RIGHT) *x += widget->width - bounds.width;
+    *y = widget->y + (widget->height - font.ascent - font.descent) / 2 + font.ascent - 1;
+
+    // glyphs may stick out of the ascent by a pixel
+    ILI9341_Rect area = {
+        .x0 = *x + bounds.x,
+        .y0 = *y - font.ascent,
+        .x1 = *x + bounds.x + bounds.width - 1,
+        .y1 = *y + font.descent
+    };
+    if (area.x0 < widget->x) area.x0 = widget->x;
+    if (area.y0 < widget->y) area.y0 = widget->y;
+    if (area.x1 > widget->x + widget->width - 1) area.x1 = widget->x + widget->width - 1;
+    if (area.y1 > widget->y + widget->height - 1) area.y1 = widget->y + widget->height - 1;
+
+    return area;
+}
+
+/**
+ * @brief Draw one widget, without its children
+ * @param widget Pointer to the widget
+ * @param ili9341 Handle to draw with, clipped to the box of the widget
+ * @param filled true if the box was just filled with the color of the widget by its parent
+ */
+static void ILI9341_Widget_Draw(const ILI9341_Widget* widget, const ILI9341_HandleTypeDef* ili9341, bool filled) {
+    switch (widget->type) {
+        case ILI9341_WIDGET_CONTAINER:
+            ILI9341_FillRectangle(ili9341, widget->x, widget->y, widget->width, widget->height, widget->bgColor);
+            break;
+        case ILI9341_WIDGET_LABEL:
+        case ILI9341_WIDGET_NUMBER: {
+            int_fast16_t x, y;
+            ILI9341_Widget_GetTextArea(widget, &x, &y);
+
+            if (!filled)
+                ILI9341_FillRectangle(ili9341, widget->x, widget->y, widget->width, widget->height, widget->bgColor);
+            ILI9341_WriteString(
+                ili9341, x, y, widget->text, widget->font, widget->color, widget->bgColor, false, 1, 0, 0
+            );
+            break;
+        }
+        case ILI9341_WIDGET_IMAGE:
+            if (widget->image)
+                ILI9341_DrawImage(ili9341, widget->x, widget->y, widget->width, widget->height, widget->image);
+            break;
+        case ILI9341_WIDGET_PAGE:
+            if (!widget->cache || !ILI9341_PageCache_Draw(widget->cache, widget->page, ili9341))
+                ILI9341_Page_Draw(widget->page, ili9341);
+            break;
+        case ILI9341_WIDGET_PROGRESS: {
+            int32_t value = widget->value < 0 ? 0 : widget->value > widget->max ? widget->max : widget->value;
+            int_fast16_t length = (int_fast32_t)widget->width * value / widget->max;
+
+            if (length > 0)
+                ILI9341_FillRectangle(ili9341, widget->x, widget->y, length, widget->height, widget->color);
+            if (length < widget->width)
+                ILI9341_FillRectangle(
+                    ili9341, widget->x + length, widget->y, widget->width - length, widget->height, widget->bgColor
+                );
+            break;
+        }
+    }
+}
+
+/**
+ * @brief Check if a visible widget of a list fully covers an area, all widgets are opaque
+ * @param widget First widget of the list
+ * @param area Area to check, inclusive
+ */
+static bool ILI9341_Widget_Covers(const ILI9341_Widget* widget, const ILI9341_Rect* area) {
+    for (; widget; widget = widget->nextSibling) {
+        if (widget->visible && (widget->type != ILI9341_WIDGET_IMAGE || widget->image) && widget->x <= area->x0 &&
+            widget->y <= area->y0 &&
+            widget->x + widget->width - 1 >= area->x1 && widget->y + widget->height - 1 >= area->y1)
+            return true;
+    }
+
+    return false;
+}
+
+/**
+ * @brief Check if a visible widget of a list overlaps an area
+ * @param widget First widget of the list
+ * @param end Widget after the last one checked
+ * @param area Area to check, inclusive
+ */
+static bool ILI9341_Widget_Overlaps(const ILI9341_Widget* widget, const ILI9341_Widget* end, const ILI9341_Rect* area) {
+    for (; widget != end; widget = widget->nextSibling) {
+        if (widget->visible && widget->x <= area->x1 && widget->y <= area->y1 &&
+            widget->x + widget->width - 1 >= area->x0 && widget->y + widget->height - 1 >= area->y0)
+            return true;
+    }
+
+    return false;
+}
+
+/**
+ * @brief Draw a list of widgets and their children inside an area
+ * @param first First widget of the list
+ * @param parent Parent of the list if it was drawn in the area, NULL otherwise
+ * @param ili9341 Handle to draw with, clipped to the area
+ * @param rect Area to draw, inclusive
+ */
+static void ILI9341_Widget_DrawTree(
+    const ILI9341_Widget* first,
+    const ILI9341_Widget* parent,
+    const ILI9341_HandleTypeDef* ili9341,
+    const ILI9341_Rect* rect
+) {
+    for (const ILI9341_Widget* widget = first; widget; widget = widget->nextSibling) {
+        if (!widget->visible || widget->x > rect->x1 || widget->y > rect->y1 ||
+            widget->x + widget->width - 1 < rect->x0 || widget->y + widget->height - 1 < rect->y0)
+            continue;
+
+        // a widget hidden by a widget drawn after it is skipped
+        const ILI9341_Rect area = {
+            .x0 = widget->x > rect->x0 ? widget->x : rect->x0,
+            .y0 = widget->y > rect->y0 ? widget->y : rect->y0,
+            .x1 = widget->x + widget->width - 1 < rect->x1 ? widget->x + widget->width - 1 : rect->x1,
+            .y1 = widget->y + widget->height - 1 < rect->y1 ? widget->y + widget->height - 1 : rect->y1
+        };
+        bool covered = ILI9341_Widget_Covers(widget->nextSibling, &area) ||
+                       ILI9341_Widget_Covers(widget->firstChild, &area);
+
+        // the box does not need to be filled again over a fill of the same color by the parent
+        bool filled = parent && parent->type == ILI9341_WIDGET_CONTAINER && parent->bgColor == widget->bgColor &&
+                      !ILI9341_Widget_Overlaps(first, widget, &area);
+
+        // children are confined to the box of their parent too
+        bool clipped = ILI9341_PushClip(ili9341, widget->x, widget->y, widget->width, widget->height);
+        if (!covered) ILI9341_Widget_Draw(widget, ili9341, filled);
+        ILI9341_Widget_DrawTree(widget->firstChild, covered ? NULL : widget, ili9341, rect);
+        if (clipped) ILI9341_PopClip(ili9341);
+    }
+}
+
+/**
+ * @brief Add an area to the areas to redraw, merging it with the areas it overlaps or touches
+ * @param rects Array of ILI9341_UI_MAX_RECTS areas
+ * @param count Pointer to the number of areas in the array
+ * @param rect Area to add, inclusive
+ */
+static void ILI9341_Ui_AddRect(ILI9341_Rect* rects, size_t* count, ILI9341_Rect rect) {
+    if (rect.x0 > rect.x1 || rect.y0 > rect.y1) return;
+
+    // the merged area can reach areas it did not touch before, restart after each merge
+    for (size_t i = 0; i < *count;) {
+        const ILI9341_Rect* other = &rects[i];
+        if (other->x0 > rect.x1 + 1 || rect.x0 > other->x1 + 1 || other->y0 > rect.y1 + 1 ||
+            rect.y0 > other->y1 + 1) {
+            i++;
+            continue;
+        }
+
+        if (other->x0 < rect.x0) rect.x0 = other->x0;
+        if (other->y0 < rect.y0) rect.y0 = other->y0;
+        if (other->x1 > rect.x1) rect.x1 = other->x1;
+        if (other->y1 > rect.y1) rect.y1 = other->y1;
+        rects[i] = rects[--*count];
+        i = 0;
+    }
+
+    if (*count < ILI9341_UI_MAX_RECTS) {
+        rects[(*count)++] = rect;
+        return;
+    }
+
+    // out of areas, the last one grows to cover the new one
+    ILI9341_Rect* last = &rects[*count - 1];
+    if (rect.x0 < last->x0) last->x0 = rect.x0;
+    if (rect.y0 < last->y0) last->y0 = rect.y0;
+    if (rect.x1 > last->x1) last->x1 = rect.x1;
+    if (rect.y1 > last->y1) last->y1 = rect.y1;
+}
+
+/**
+ * @brief Get the box of a widget
+ * @param widget Pointer to the widget
+ */
+static ILI9341_Rect ILI9341_Widget_GetBox(const ILI9341_Widget* widget) {
+    return (ILI9341_Rect){
+        .x0 = widget->x,
+        .y0 = widget->y,
+        .x1 = widget->x + widget->width - 1,
+        .y1 = widget->y + widget->height - 1
+    };
+}
+
+/**
+ * @brief Collect the areas of the dirty widgets of a tree and clear their dirty flags
+ * @param widget First widget of the tree
+ * @param rects Array of ILI9341_UI_MAX_RECTS areas
+ * @param count Pointer to the number of areas in the array
+ * @param all true when the whole tree is drawn, only the text areas are updated
+ */
+static void ILI9341_Ui_CollectDirty(ILI9341_Widget* widget, ILI9341_Rect* rects, size_t* count, bool all) {
+    for (; widget; widget = widget->nextSibling) {
+        bool text = widget->type == ILI9341_WIDGET_LABEL || widget->type == ILI9341_WIDGET_NUMBER;
+
+        if (text && (all || widget->dirty || widget->textDirty)) {
+            int_fast16_t x, y;
+            ILI9341_Rect previous = widget->textArea;
+            widget->textArea = ILI9341_Widget_GetTextArea(widget, &x, &y);
+
+            // a new text only needs the union of both texts, the rest of the box keeps its color
+            if (!all && !widget->dirty) {
+                ILI9341_Ui_AddRect(rects, count, previous);
+                ILI9341_Ui_AddRect(rects, count, widget->textArea);
+            }
+        }
+
+        if (!all && widget->dirty) ILI9341_Ui_AddRect(rects, count, ILI9341_Widget_GetBox(widget));
+        widget->dirty = false;
+        widget->textDirty = false;
+        ILI9341_Ui_CollectDirty(widget->firstChild, rects, count, all);
+    }
+}
+
+void ILI9341_Ui_Init(ILI9341_Ui* ui, const ILI9341_HandleTypeDef* ili9341) {
+    memset(&ui->clip, 0, sizeof(ui->clip));
+    ui->drawer = *ili9341;
+    ui->drawer.clip = &ui->clip;
+    ui->root = NULL;
+    ui->valid = false;
+}
+
+void ILI9341_Ui_SetRoot(ILI9341_Ui* ui, ILI9341_Widget* root) {
+    ui->root = root;
+    ui->valid = false;
+}
+
+bool ILI9341_Ui_Update(ILI9341_Ui* ui) {
+    if (!ui->root) return false;
+
+    ILI9341_Rect rects[ILI9341_UI_MAX_RECTS];
+    size_t count = 0;
+
+    if (!ui->valid) ILI9341_Ui_AddRect(rects, &count, ILI9341_Widget_GetBox(ui->root));
+    ILI9341_Ui_CollectDirty(ui->root, rects, &count, !ui->valid);
+    ui->valid = true;
+
+    for (size_t i = 0; i < count; i++) {
+        const ILI9341_Rect* rect = &rects[i];
+
+        ILI9341_PushClip(&ui->drawer, rect->x0, rect->y0, rect->x1 - rect->x0 + 1, rect->y1 - rect->y0 + 1);
+        ILI9341_Widget_DrawTree(ui->root, NULL, &ui->drawer, rect);
+        ILI9341_PopClip(&ui->drawer);
+    }
+
+    return count > 0;
+}
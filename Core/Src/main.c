@@ -18,6 +18,7 @@
 /* USER CODE END Header */
 /* Includes ------------------------------------------------------------------*/
 #include "main.h"
+#include "dma.h"
 #include "spi.h"
 #include "tim.h"
 #include "usart.h"
@@ -30,7 +31,12 @@
 #include <string.h>
 #include "state.h"
 #include "ili9341.h"
+#include "ili9341_blend.h"
 #include "ili9341_fonts.h"
+#include "ili9341_effect.h"
+#include "ili9341_jpeg.h"
+#include "ili9341_scroll.h"
+#include "ili9341_sprite.h"
 #include "LCD_pages.h"
 
 /* USER CODE END Includes */
@@ -54,6 +60,19 @@ int timeCount = 0;
 
 /* Private macro -------------------------------------------------------------*/
 /* USER CODE BEGIN PM */
+// Set to 1 to show the UART log on the display instead of the pages
+#define LOG_CONSOLE_ENABLED 0
+// Set to 1 to measure the sprites moved per frame at startup, the results are sent over UART
+#define SPRITE_BENCHMARK_ENABLED 0
+// Set to 1 to compare full-screen raw and compressed image blits at startup, the results are sent over UART
+#define IMAGE_BENCHMARK_ENABLED 0
+// Set to 1 to measure the JPEG decoder at startup, the results are sent over UART. Needs a photo embedded as
+// LCD_Jpeg_Benchmark with Tools/jpeg_embed.py, in Core/Src/LCD_jpeg_benchmark.c
+#define JPEG_BENCHMARK_ENABLED 0
+// Set to 1 to compare the blend kernels with a per-channel blend at startup, the results are sent over UART
+#define BLEND_BENCHMARK_ENABLED 0
+// Set to 1 to measure page switches with and without the page cache at startup, the results are sent over UART
+#define PAGE_BENCHMARK_ENABLED 0
 /* USER CODE END PM */
 
 /* Private variables ---------------------------------------------------------*/
@@ -75,6 +94,24 @@ int timeCount = 0;
 void SystemClock_Config(void);
 /* USER CODE BEGIN PFP */
 void transmitStringUART(const char* format, ...);
+#if LOG_CONSOLE_ENABLED
+void printLogQueue(void);
+#endif
+#if SPRITE_BENCHMARK_ENABLED
+void runSpriteBenchmark(void);
+#endif
+#if IMAGE_BENCHMARK_ENABLED
+void runImageBenchmark(void);
+#endif
+#if JPEG_BENCHMARK_ENABLED
+void runJpegBenchmark(void);
+#endif
+#if BLEND_BENCHMARK_ENABLED
+void runBlendBenchmark(void);
+#endif
+#if PAGE_BENCHMARK_ENABLED
+void runPageBenchmark(void);
+#endif
 
 void home() {
 //	posX *= 1.0;
@@ -131,12 +168,23 @@ void home() {
 
 void playBuzzer(uint16_t duration);
 void playRefereeBuzzer();
+void playStateEffect(uint8_t state);
 
 /* USER CODE END PFP */
 
 /* Private user code ---------------------------------------------------------*/
 /* USER CODE BEGIN 0 */
 ILI9341_HandleTypeDef ili9341;
+ILI9341_Effect displayEffect;
+uint8_t effectState = 255;
+#if LOG_CONSOLE_ENABLED
+#define LOG_QUEUE_LINES 8
+ILI9341_Console logConsole;
+// Messages waiting for the main loop, transmitStringUART is also called from the EXTI interrupt
+char logQueue[LOG_QUEUE_LINES][128];
+volatile uint32_t logQueued = 0;
+volatile uint32_t logPrinted = 0;
+#endif
 /* USER CODE END 0 */
 
 /**
@@ -168,6 +216,7 @@ int main(void)
 
   /* Initialize all configured peripherals */
   MX_GPIO_Init();
+  MX_DMA_Init();
   MX_USART3_UART_Init();
   MX_TIM2_Init();
   MX_SPI5_Init();
@@ -188,6 +237,26 @@ int main(void)
   	320,
   	240
   );
+  ILI9341_Effect_Init(&displayEffect, &ili9341);
+  initPages();
+#if LOG_CONSOLE_ENABLED
+  ILI9341_Console_Init(&logConsole, &ili9341, 0, ili9341.height, ILI9341_Font_Spleen8x16, ILI9341_COLOR_GREEN, ILI9341_COLOR_BLACK);
+#endif
+#if SPRITE_BENCHMARK_ENABLED
+  runSpriteBenchmark();
+#endif
+#if IMAGE_BENCHMARK_ENABLED
+  runImageBenchmark();
+#endif
+#if JPEG_BENCHMARK_ENABLED
+  runJpegBenchmark();
+#endif
+#if BLEND_BENCHMARK_ENABLED
+  runBlendBenchmark();
+#endif
+#if PAGE_BENCHMARK_ENABLED
+  runPageBenchmark();
+#endif
   /* USER CODE END 2 */
 
   /* Infinite loop */
@@ -217,7 +286,18 @@ int main(void)
 	  }
 
 
+	  if (STATE != effectState) {
+		  playStateEffect(STATE);
+		  effectState = STATE;
+	  }
+	  ILI9341_Effect_Update(&displayEffect, HAL_GetTick());
+
+#if LOG_CONSOLE_ENABLED
+	  printLogQueue();
+	  ILI9341_Console_Update(&logConsole);
+#else
 	  renderPage(STATE);
+#endif
 //	  renderPage(DEPOSIT);
 
 	  if (STATE == IDLE) {
@@ -414,7 +494,255 @@ void transmitStringUART(const char* format, ...){
 	va_end(args);
 
 	HAL_UART_Transmit(&huart3, (uint8_t*)buf, strlen(buf), 50);
+#if LOG_CONSOLE_ENABLED
+	// only queued here, the main loop prints to the console so an interrupt never touches it or the display
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+	if (logQueued - logPrinted < LOG_QUEUE_LINES) {
+		strcpy(logQueue[logQueued % LOG_QUEUE_LINES], buf);
+		logQueued++;
+	}
+	__set_PRIMASK(primask);
+#endif
+}
+
+#if LOG_CONSOLE_ENABLED
+void printLogQueue(void){
+	// a slot is only reused once logPrinted has moved past it
+	while (logPrinted != logQueued) {
+		ILI9341_Console_Print(&logConsole, logQueue[logPrinted % LOG_QUEUE_LINES]);
+		logPrinted++;
+	}
+}
+#endif
+
+#if SPRITE_BENCHMARK_ENABLED
+#define SPRITE_BENCHMARK_SIZE 24
+#define SPRITE_BENCHMARK_FRAMES 60
+
+static uint16_t benchmarkImage[SPRITE_BENCHMARK_SIZE * SPRITE_BENCHMARK_SIZE];
+
+static void drawBenchmarkBackground(const ILI9341_HandleTypeDef* target, const ILI9341_Rect* area, void* context){
+	ILI9341_FillRectangle(target, area->x0, area->y0, area->x1 - area->x0 + 1, area->y1 - area->y0 + 1, ILI9341_COLOR_BLUE);
+}
+
+void runSpriteBenchmark(void){
+	static ILI9341_SpriteLayer layer;
+	static ILI9341_Sprite sprites[ILI9341_SPRITE_MAX];
+	int dx[ILI9341_SPRITE_MAX], dy[ILI9341_SPRITE_MAX];
+	const int r = SPRITE_BENCHMARK_SIZE / 2;
+	const int maxX = ili9341.width - SPRITE_BENCHMARK_SIZE, maxY = ili9341.height - SPRITE_BENCHMARK_SIZE;
+	int best = 0;
+
+	// a ball, the corners are the color key
+	for (int y = 0; y < SPRITE_BENCHMARK_SIZE; y++){
+		for (int x = 0; x < SPRITE_BENCHMARK_SIZE; x++){
+			uint16_t color = (x - r) * (x - r) + (y - r) * (y - r) < r * r ? ILI9341_COLOR_YELLOW : ILI9341_COLOR_MAGENTA;
+			benchmarkImage[y * SPRITE_BENCHMARK_SIZE + x] = (color >> 8) | (color << 8);
+		}
+	}
+
+	for (int count = 1; count <= ILI9341_SPRITE_MAX; count++){
+		ILI9341_FillScreen(&ili9341, ILI9341_COLOR_BLUE);
+		ILI9341_SpriteLayer_Init(&layer, &ili9341, drawBenchmarkBackground, NULL);
+		for (int i = 0; i < count; i++){
+			ILI9341_Sprite_Init(&sprites[i], benchmarkImage, NULL, ILI9341_COLOR_MAGENTA, SPRITE_BENCHMARK_SIZE, SPRITE_BENCHMARK_SIZE);
+			// spread over the screen, every sprite stays fully visible to count the whole redraw
+			ILI9341_Sprite_MoveTo(&sprites[i], (20 + 67 * i) % maxX, (20 + 41 * i) % maxY);
+			dx[i] = i & 1 ? -3 : 3;
+			dy[i] = i & 2 ? -2 : 2;
+			ILI9341_Sprite_Show(&sprites[i], true);
+			ILI9341_SpriteLayer_Add(&layer, &sprites[i]);
+		}
+		ILI9341_SpriteLayer_Update(&layer);
+
+		uint32_t start = HAL_GetTick();
+		for (int frame = 0; frame < SPRITE_BENCHMARK_FRAMES; frame++){
+			// bounce off the edges of the screen
+			for (int i = 0; i < count; i++){
+				if (sprites[i].x + dx[i] < 0 || sprites[i].x + dx[i] > maxX) dx[i] = -dx[i];
+				if (sprites[i].y + dy[i] < 0 || sprites[i].y + dy[i] > maxY) dy[i] = -dy[i];
+				ILI9341_Sprite_MoveTo(&sprites[i], sprites[i].x + dx[i], sprites[i].y + dy[i]);
+			}
+			ILI9341_SpriteLayer_Update(&layer);
+		}
+		uint32_t elapsed = HAL_GetTick() - start;
+
+		transmitStringUART("Sprites: %d | %lu us per frame\r\n", count, elapsed * 1000 / SPRITE_BENCHMARK_FRAMES);
+		if (elapsed * 30 <= 1000 * SPRITE_BENCHMARK_FRAMES) best = count;
+	}
+
+	transmitStringUART("Sprites per frame at 30 fps: %d%s\r\n", best, best == ILI9341_SPRITE_MAX ? " or more" : "");
 }
+#endif
+
+#if IMAGE_BENCHMARK_ENABLED
+#define IMAGE_BENCHMARK_FRAMES 10
+
+static uint16_t benchmarkPixels[320 * 240];
+static uint8_t benchmarkData[sizeof(benchmarkPixels)];
+
+void runImageBenchmark(void){
+	static const char* scenes[] = {"Flat", "Gradient"};
+	const int width = ili9341.width, height = ili9341.height;
+	ILI9341_Surface surface = {.buffer = benchmarkPixels, .width = width, .height = height};
+	ILI9341_HandleTypeDef renderer = ili9341;
+	ILI9341_CompressedImage image;
+	renderer.surface = &surface;
+
+	for (int scene = 0; scene < 2; scene++){
+		if (scene == 0){
+			// a page: flat background, a banner and text
+			ILI9341_FillScreen(&renderer, ILI9341_COLOR_WHITE);
+			ILI9341_FillRectangle(&renderer, 0, 0, width, 40, ILI9341_COLOR_BLUE);
+			ILI9341_WriteString(&renderer, 70, 120, "INSERT COIN", ILI9341_Font_Spleen16x32, ILI9341_COLOR_BLACK, ILI9341_COLOR_WHITE, 1, 1, 0, 0);
+		} else {
+			for (int y = 0; y < height; y++){
+				for (int x = 0; x < width; x++){
+					uint16_t color = ILI9341_COLOR565(x * 255 / width, y * 255 / height, (x + y) * 255 / (width + height));
+					benchmarkPixels[y * width + x] = (color >> 8) | (color << 8);
+				}
+			}
+		}
+		if (!ILI9341_CompressImage(&image, benchmarkPixels, width, height, benchmarkData, sizeof(benchmarkData))) continue;
+
+		uint32_t start = HAL_GetTick();
+		for (int frame = 0; frame < IMAGE_BENCHMARK_FRAMES; frame++) ILI9341_DrawImage(&ili9341, 0, 0, width, height, benchmarkPixels);
+		uint32_t raw = HAL_GetTick() - start;
+
+		start = HAL_GetTick();
+		for (int frame = 0; frame < IMAGE_BENCHMARK_FRAMES; frame++) ILI9341_DrawImageCompressed(&ili9341, 0, 0, &image);
+		uint32_t compressed = HAL_GetTick() - start;
+
+		// decoding alone, into the surface
+		start = HAL_GetTick();
+		for (int frame = 0; frame < IMAGE_BENCHMARK_FRAMES; frame++) ILI9341_DrawImageCompressed(&renderer, 0, 0, &image);
+		uint32_t decode = HAL_GetTick() - start;
+
+		transmitStringUART("%s: %lu of %u bytes | raw %lu us | compressed %lu us | decode %lu us\r\n", scenes[scene],
+			image.size, sizeof(benchmarkPixels), raw * 1000 / IMAGE_BENCHMARK_FRAMES,
+			compressed * 1000 / IMAGE_BENCHMARK_FRAMES, decode * 1000 / IMAGE_BENCHMARK_FRAMES);
+	}
+}
+#endif
+
+#if JPEG_BENCHMARK_ENABLED
+#define JPEG_BENCHMARK_FRAMES 10
+
+extern const uint8_t LCD_Jpeg_Benchmark[];
+extern const size_t LCD_Jpeg_Benchmark_Size;
+static ILI9341_Jpeg benchmarkJpeg;
+static uint16_t benchmarkSurface[320 * 240];
+
+void runJpegBenchmark(void){
+	static const char* scales[] = {"1/1", "1/2", "1/4", "1/8"};
+	ILI9341_Surface surface = {.buffer = benchmarkSurface, .width = ili9341.width, .height = ili9341.height};
+	ILI9341_HandleTypeDef renderer = ili9341;
+	renderer.surface = &surface;
+
+	if (!ILI9341_Jpeg_Open(&benchmarkJpeg, LCD_Jpeg_Benchmark, LCD_Jpeg_Benchmark_Size)){
+		transmitStringUART("JPEG: not a supported image\r\n");
+		return;
+	}
+	// source pixels decoded per second, the whole image is entropy decoded at every scale
+	const uint32_t pixels = (uint32_t)benchmarkJpeg.width * benchmarkJpeg.height * JPEG_BENCHMARK_FRAMES;
+
+	for (uint_fast8_t scale = ILI9341_JPEG_SCALE_1; scale <= ILI9341_JPEG_SCALE_1_8; scale++){
+		uint32_t start = HAL_GetTick();
+		for (int frame = 0; frame < JPEG_BENCHMARK_FRAMES; frame++) ILI9341_Jpeg_Draw(&benchmarkJpeg, &ili9341, 0, 0, scale);
+		uint32_t display = HAL_GetTick() - start;
+
+		// decoding alone, into the surface
+		start = HAL_GetTick();
+		for (int frame = 0; frame < JPEG_BENCHMARK_FRAMES; frame++) ILI9341_Jpeg_Draw(&benchmarkJpeg, &renderer, 0, 0, scale);
+		uint32_t decode = HAL_GetTick() - start;
+
+		transmitStringUART("JPEG %ux%u %u bytes at %s: display %lu us | decode %lu us, %lu kpx/s\r\n",
+			benchmarkJpeg.width, benchmarkJpeg.height, LCD_Jpeg_Benchmark_Size, scales[scale],
+			display * 1000 / JPEG_BENCHMARK_FRAMES, decode * 1000 / JPEG_BENCHMARK_FRAMES,
+			decode ? pixels / decode : 0);
+	}
+}
+#endif
+
+#if BLEND_BENCHMARK_ENABLED
+#define BLEND_BENCHMARK_FRAMES 10
+
+static uint16_t blendPixels[320 * 240];
+static uint16_t blendOverlay[320 * 240];
+static uint8_t blendAlpha[320 * 240];
+
+// one pixel and one component at a time, the straightforward blend the kernels replace
+static void blendPerChannel(uint16_t* dst, const uint16_t* src, const uint8_t* alpha, size_t count, uint8_t constantAlpha){
+	for (size_t i = 0; i < count; i++){
+		uint16_t s = (src[i] >> 8) | (src[i] << 8), d = (dst[i] >> 8) | (dst[i] << 8);
+		uint32_t a = alpha ? alpha[i] : constantAlpha;
+		uint32_t r = ((s >> 11) * a + (d >> 11) * (255 - a)) / 255;
+		uint32_t g = (((s >> 5) & 0x3F) * a + ((d >> 5) & 0x3F) * (255 - a)) / 255;
+		uint32_t b = ((s & 0x1F) * a + (d & 0x1F) * (255 - a)) / 255;
+		uint16_t color = r << 11 | g << 5 | b;
+		dst[i] = (color >> 8) | (color << 8);
+	}
+}
+
+void runBlendBenchmark(void){
+	const size_t count = sizeof(blendPixels) / sizeof(blendPixels[0]);
+	uint32_t start, naive, swar, naiveAlpha, swarAlpha, color, shadow;
+
+	// a soft-edged overlay: opaque and clear areas with ramps between them
+	for (size_t i = 0; i < count; i++){
+		int x = i % 320, y = i / 320;
+		uint16_t c = ILI9341_COLOR565(x * 255 / 320, y * 255 / 240, 128);
+		blendPixels[i] = (c >> 8) | (c << 8);
+		blendOverlay[i] = ~blendPixels[i];
+		blendAlpha[i] = x < 64 ? 0 : x < 128 ? (x - 64) * 4 : x < 256 ? 255 : (320 - x) * 4;
+	}
+
+	start = HAL_GetTick();
+	for (int frame = 0; frame < BLEND_BENCHMARK_FRAMES; frame++) blendPerChannel(blendPixels, blendOverlay, NULL, count, 96);
+	naive = HAL_GetTick() - start;
+
+	start = HAL_GetTick();
+	for (int frame = 0; frame < BLEND_BENCHMARK_FRAMES; frame++) ILI9341_Blend_Constant(blendPixels, blendOverlay, count, 96);
+	swar = HAL_GetTick() - start;
+
+	start = HAL_GetTick();
+	for (int frame = 0; frame < BLEND_BENCHMARK_FRAMES; frame++) blendPerChannel(blendPixels, blendOverlay, blendAlpha, count, 0);
+	naiveAlpha = HAL_GetTick() - start;
+
+	start = HAL_GetTick();
+	for (int frame = 0; frame < BLEND_BENCHMARK_FRAMES; frame++) ILI9341_Blend_Alpha(blendPixels, blendOverlay, blendAlpha, count);
+	swarAlpha = HAL_GetTick() - start;
+
+	start = HAL_GetTick();
+	for (int frame = 0; frame < BLEND_BENCHMARK_FRAMES; frame++) ILI9341_Blend_Color(blendPixels, ILI9341_COLOR_BLACK, count, 128);
+	color = HAL_GetTick() - start;
+
+	// the mask is the alpha bytes read as 4-bit pairs, only the timing matters
+	start = HAL_GetTick();
+	for (int frame = 0; frame < BLEND_BENCHMARK_FRAMES; frame++) ILI9341_Blend_Alpha4(blendPixels, ILI9341_COLOR_BLACK, blendAlpha, 0, count);
+	shadow = HAL_GetTick() - start;
+
+	transmitStringUART("Blend constant: per-channel %lu us | SWAR %lu us\r\n", naive * 1000 / BLEND_BENCHMARK_FRAMES,
+		swar * 1000 / BLEND_BENCHMARK_FRAMES);
+	transmitStringUART("Blend per-pixel alpha: per-channel %lu us | SWAR %lu us\r\n",
+		naiveAlpha * 1000 / BLEND_BENCHMARK_FRAMES, swarAlpha * 1000 / BLEND_BENCHMARK_FRAMES);
+	transmitStringUART("Blend dim %lu us | 4-bit shadow %lu us\r\n", color * 1000 / BLEND_BENCHMARK_FRAMES,
+		shadow * 1000 / BLEND_BENCHMARK_FRAMES);
+}
+#endif
+
+#if PAGE_BENCHMARK_ENABLED
+#define PAGE_BENCHMARK_ROUNDS 10
+
+void runPageBenchmark(void){
+	// from a state change to the page and its fields on the panel
+	uint32_t ops = measurePageSwitch(false, PAGE_BENCHMARK_ROUNDS);
+	uint32_t cached = measurePageSwitch(true, PAGE_BENCHMARK_ROUNDS);
+
+	transmitStringUART("Page switch: ops %lu us | cached %lu us\r\n", ops, cached);
+}
+#endif
 
 void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin)
 {
@@ -435,6 +763,23 @@ void playBuzzer(uint16_t duration){
 	HAL_GPIO_WritePin(Buzzer_GPIO_Port, Buzzer_Pin, 1);
 }
 
+void playStateEffect(uint8_t state){
+	switch (state){
+		case GAME:
+			ILI9341_Effect_Flash(&displayEffect, 3, 200, HAL_GetTick());
+			break;
+
+		case IDLE:
+			ILI9341_Effect_Fade(&displayEffect, 32, 1000, HAL_GetTick());
+			break;
+
+		default:
+			// DEPOSIT blocks the loop for seconds, a running effect would freeze midway
+			ILI9341_Effect_Stop(&displayEffect);
+			break;
+	}
+}
+
 void playRefereeBuzzer(){
 	playBuzzer(150);
 	HAL_Delay(300);
@@ -6,12 +6,31 @@
 # Add inputs and outputs from these tool invocations to the build variables 
 C_SRCS += \
 ../Core/Src/LCD_pages.c \
+../Core/Src/LCD_pages_data.c \
+../Core/Src/dma.c \
 ../Core/Src/gpio.c \
 ../Core/Src/ili9341.c \
+../Core/Src/ili9341_animation.c \
+../Core/Src/ili9341_assets.c \
+../Core/Src/ili9341_band.c \
+../Core/Src/ili9341_blend.c \
+../Core/Src/ili9341_canvas.c \
+../Core/Src/ili9341_displaylist.c \
+../Core/Src/ili9341_dither.c \
+../Core/Src/ili9341_effect.c \
 ../Core/Src/ili9341_font_manop.c \
 ../Core/Src/ili9341_font_spleen.c \
 ../Core/Src/ili9341_font_terminus.c \
+../Core/Src/ili9341_framebuffer.c \
+../Core/Src/ili9341_imagecache.c \
+../Core/Src/ili9341_jpeg.c \
+../Core/Src/ili9341_page.c \
+../Core/Src/ili9341_pagecache.c \
+../Core/Src/ili9341_scroll.c \
+../Core/Src/ili9341_sdf.c \
+../Core/Src/ili9341_sprite.c \
 ../Core/Src/ili9341_touch.c \
+../Core/Src/ili9341_widget.c \
 ../Core/Src/main.c \
 ../Core/Src/spi.c \
 ../Core/Src/state.c \
@@ -25,12 +44,31 @@ C_SRCS += \
 
 OBJS += \
 ./Core/Src/LCD_pages.o \
+./Core/Src/LCD_pages_data.o \
+./Core/Src/dma.o \
 ./Core/Src/gpio.o \
 ./Core/Src/ili9341.o \
+./Core/Src/ili9341_animation.o \
+./Core/Src/ili9341_assets.o \
+./Core/Src/ili9341_band.o \
+./Core/Src/ili9341_blend.o \
+./Core/Src/ili9341_canvas.o \
+./Core/Src/ili9341_displaylist.o \
+./Core/Src/ili9341_dither.o \
+./Core/Src/ili9341_effect.o \
 ./Core/Src/ili9341_font_manop.o \
 ./Core/Src/ili9341_font_spleen.o \
 ./Core/Src/ili9341_font_terminus.o \
+./Core/Src/ili9341_framebuffer.o \
+./Core/Src/ili9341_imagecache.o \
+./Core/Src/ili9341_jpeg.o \
+./Core/Src/ili9341_page.o \
+./Core/Src/ili9341_pagecache.o \
+./Core/Src/ili9341_scroll.o \
+./Core/Src/ili9341_sdf.o \
+./Core/Src/ili9341_sprite.o \
 ./Core/Src/ili9341_touch.o \
+./Core/Src/ili9341_widget.o \
 ./Core/Src/main.o \
 ./Core/Src/spi.o \
 ./Core/Src/state.o \
@@ -44,12 +82,31 @@ OBJS += \
 
 C_DEPS += \
 ./Core/Src/LCD_pages.d \
+./Core/Src/LCD_pages_data.d \
+./Core/Src/dma.d \
 ./Core/Src/gpio.d \
 ./Core/Src/ili9341.d \
+./Core/Src/ili9341_animation.d \
+./Core/Src/ili9341_assets.d \
+./Core/Src/ili9341_band.d \
+./Core/Src/ili9341_blend.d \
+./Core/Src/ili9341_canvas.d \
+./Core/Src/ili9341_displaylist.d \
+./Core/Src/ili9341_dither.d \
+./Core/Src/ili9341_effect.d \
 ./Core/Src/ili9341_font_manop.d \
 ./Core/Src/ili9341_font_spleen.d \
 ./Core/Src/ili9341_font_terminus.d \
+./Core/Src/ili9341_framebuffer.d \
+./Core/Src/ili9341_imagecache.d \
+./Core/Src/ili9341_jpeg.d \
+./Core/Src/ili9341_page.d \
+./Core/Src/ili9341_pagecache.d \
+./Core/Src/ili9341_scroll.d \
+./Core/Src/ili9341_sdf.d \
+./Core/Src/ili9341_sprite.d \
 ./Core/Src/ili9341_touch.d \
+./Core/Src/ili9341_widget.d \
 ./Core/Src/main.d \
 ./Core/Src/spi.d \
 ./Core/Src/state.d \
@@ -69,7 +126,7 @@ Core/Src/%.o Core/Src/%.su Core/Src/%.cyclo: ../Core/Src/%.c Core/Src/subdir.mk
 clean: clean-Core-2f-Src
 
 clean-Core-2f-Src:
-	-$(RM) ./Core/Src/LCD_pages.cyclo ./Core/Src/LCD_pages.d ./Core/Src/LCD_pages.o ./Core/Src/LCD_pages.su ./Core/Src/gpio.cyclo ./Core/Src/gpio.d ./Core/Src/gpio.o ./Core/Src/gpio.su ./Core/Src/ili9341.cyclo ./Core/Src/ili9341.d ./Core/Src/ili9341.o ./Core/Src/ili9341.su ./Core/Src/ili9341_font_manop.cyclo ./Core/Src/ili9341_font_manop.d ./Core/Src/ili9341_font_manop.o ./Core/Src/ili9341_font_manop.su ./Core/Src/ili9341_font_spleen.cyclo ./Core/Src/ili9341_font_spleen.d ./Core/Src/ili9341_font_spleen.o ./Core/Src/ili9341_font_spleen.su ./Core/Src/ili9341_font_terminus.cyclo ./Core/Src/ili9341_font_terminus.d ./Core/Src/ili9341_font_terminus.o ./Core/Src/ili9341_font_terminus.su ./Core/Src/ili9341_touch.cyclo ./Core/Src/ili9341_touch.d ./Core/Src/ili9341_touch.o ./Core/Src/ili9341_touch.su ./Core/Src/main.cyclo ./Core/Src/main.d ./Core/Src/main.o ./Core/Src/main.su ./Core/Src/spi.cyclo ./Core/Src/spi.d ./Core/Src/spi.o ./Core/Src/spi.su ./Core/Src/state.cyclo ./Core/Src/state.d ./Core/Src/state.o ./Core/Src/state.su ./Core/Src/stm32f7xx_hal_msp.cyclo ./Core/Src/stm32f7xx_hal_msp.d ./Core/Src/stm32f7xx_hal_msp.o ./Core/Src/stm32f7xx_hal_msp.su ./Core/Src/stm32f7xx_it.cyclo ./Core/Src/stm32f7xx_it.d ./Core/Src/stm32f7xx_it.o ./Core/Src/stm32f7xx_it.su ./Core/Src/syscalls.cyclo ./Core/Src/syscalls.d ./Core/Src/syscalls.o ./Core/Src/syscalls.su ./Core/Src/sysmem.cyclo ./Core/Src/sysmem.d ./Core/Src/sysmem.o ./Core/Src/sysmem.su ./Core/Src/system_stm32f7xx.cyclo ./Core/Src/system_stm32f7xx.d ./Core/Src/system_stm32f7xx.o ./Core/Src/system_stm32f7xx.su ./Core/Src/tim.cyclo ./Core/Src/tim.d ./Core/Src/tim.o ./Core/Src/tim.su ./Core/Src/usart.cyclo ./Core/Src/usart.d ./Core/Src/usart.o ./Core/Src/usart.su
+	-$(RM) ./Core/Src/LCD_pages.cyclo ./Core/Src/LCD_pages.d ./Core/Src/LCD_pages.o ./Core/Src/LCD_pages.su ./Core/Src/LCD_pages_data.cyclo ./Core/Src/LCD_pages_data.d ./Core/Src/LCD_pages_data.o ./Core/Src/LCD_pages_data.su ./Core/Src/dma.cyclo ./Core/Src/dma.d ./Core/Src/dma.o ./Core/Src/dma.su ./Core/Src/gpio.cyclo ./Core/Src/gpio.d ./Core/Src/gpio.o ./Core/Src/gpio.su ./Core/Src/ili9341.cyclo ./Core/Src/ili9341.d ./Core/Src/ili9341.o ./Core/Src/ili9341.su ./Core/Src/ili9341_animation.cyclo ./Core/Src/ili9341_animation.d ./Core/Src/ili9341_animation.o ./Core/Src/ili9341_animation.su ./Core/Src/ili9341_assets.cyclo ./Core/Src/ili9341_assets.d ./Core/Src/ili9341_assets.o ./Core/Src/ili9341_assets.su ./Core/Src/ili9341_band.cyclo ./Core/Src/ili9341_band.d ./Core/Src/ili9341_band.o ./Core/Src/ili9341_band.su ./Core/Src/ili9341_blend.cyclo ./Core/Src/ili9341_blend.d ./Core/Src/ili9341_blend.o ./Core/Src/ili9341_blend.su ./Core/Src/ili9341_canvas.cyclo ./Core/Src/ili9341_canvas.d ./Core/Src/ili9341_canvas.o ./Core/Src/ili9341_canvas.su ./Core/Src/ili9341_displaylist.cyclo ./Core/Src/ili9341_displaylist.d ./Core/Src/ili9341_displaylist.o ./Core/Src/ili9341_displaylist.su ./Core/Src/ili9341_dither.cyclo ./Core/Src/ili9341_dither.d ./Core/Src/ili9341_dither.o ./Core/Src/ili9341_dither.su ./Core/Src/ili9341_effect.cyclo ./Core/Src/ili9341_effect.d ./Core/Src/ili9341_effect.o ./Core/Src/ili9341_effect.su ./Core/Src/ili9341_font_manop.cyclo ./Core/Src/ili9341_font_manop.d ./Core/Src/ili9341_font_manop.o ./Core/Src/ili9341_font_manop.su ./Core/Src/ili9341_font_spleen.cyclo ./Core/Src/ili9341_font_spleen.d ./Core/Src/ili9341_font_spleen.o ./Core/Src/ili9341_font_spleen.su ./Core/Src/ili9341_font_terminus.cyclo ./Core/Src/ili9341_font_terminus.d ./Core/Src/ili9341_font_terminus.o ./Core/Src/ili9341_font_terminus.su ./Core/Src/ili9341_framebuffer.cyclo ./Core/Src/ili9341_framebuffer.d ./Core/Src/ili9341_framebuffer.o ./Core/Src/ili9341_framebuffer.su ./Core/Src/ili9341_imagecache.cyclo ./Core/Src/ili9341_imagecache.d ./Core/Src/ili9341_imagecache.o ./Core/Src/ili9341_imagecache.su ./Core/Src/ili9341_jpeg.cyclo ./Core/Src/ili9341_jpeg.d ./Core/Src/ili9341_jpeg.o ./Core/Src/ili9341_jpeg.su ./Core/Src/ili9341_page.cyclo ./Core/Src/ili9341_page.d ./Core/Src/ili9341_page.o ./Core/Src/ili9341_page.su ./Core/Src/ili9341_pagecache.cyclo ./Core/Src/ili9341_pagecache.d ./Core/Src/ili9341_pagecache.o ./Core/Src/ili9341_pagecache.su ./Core/Src/ili9341_scroll.cyclo ./Core/Src/ili9341_scroll.d ./Core/Src/ili9341_scroll.o ./Core/Src/ili9341_scroll.su ./Core/Src/ili9341_sdf.cyclo ./Core/Src/ili9341_sdf.d ./Core/Src/ili9341_sdf.o ./Core/Src/ili9341_sdf.su ./Core/Src/ili9341_sprite.cyclo ./Core/Src/ili9341_sprite.d ./Core/Src/ili9341_sprite.o ./Core/Src/ili9341_sprite.su ./Core/Src/ili9341_touch.cyclo ./Core/Src/ili9341_touch.d ./Core/Src/ili9341_touch.o ./Core/Src/ili9341_touch.su ./Core/Src/ili9341_widget.cyclo ./Core/Src/ili9341_widget.d ./Core/Src/ili9341_widget.o ./Core/Src/ili9341_widget.su ./Core/Src/main.cyclo ./Core/Src/main.d ./Core/Src/main.o ./Core/Src/main.su ./Core/Src/spi.cyclo ./Core/Src/spi.d ./Core/Src/spi.o ./Core/Src/spi.su ./Core/Src/state.cyclo ./Core/Src/state.d ./Core/Src/state.o ./Core/Src/state.su ./Core/Src/stm32f7xx_hal_msp.cyclo ./Core/Src/stm32f7xx_hal_msp.d ./Core/Src/stm32f7xx_hal_msp.o ./Core/Src/stm32f7xx_hal_msp.su ./Core/Src/stm32f7xx_it.cyclo ./Core/Src/stm32f7xx_it.d ./Core/Src/stm32f7xx_it.o ./Core/Src/stm32f7xx_it.su ./Core/Src/syscalls.cyclo ./Core/Src/syscalls.d ./Core/Src/syscalls.o ./Core/Src/syscalls.su ./Core/Src/sysmem.cyclo ./Core/Src/sysmem.d ./Core/Src/sysmem.o ./Core/Src/sysmem.su ./Core/Src/system_stm32f7xx.cyclo ./Core/Src/system_stm32f7xx.d ./Core/Src/system_stm32f7xx.o ./Core/Src/system_stm32f7xx.su ./Core/Src/tim.cyclo ./Core/Src/tim.d ./Core/Src/tim.o ./Core/Src/tim.su ./Core/Src/usart.cyclo ./Core/Src/usart.d ./Core/Src/usart.o ./Core/Src/usart.su
 
 .PHONY: clean-Core-2f-Src
 
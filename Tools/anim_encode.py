@@ -0,0 +1,156 @@
+#!/usr/bin/env python3
+"""
+Encode frames into an ILI9341_Animation, a keyframe and the rectangles changed by each following frame.
+
+Each frame is compared with the previous one (the first frame with the last one, for looping). The changed pixels are
+grouped into connected areas, and their bounding boxes are merged while one larger rectangle costs no more than two: a
+rectangle costs its pixels plus RECT_COST pixels for its entry in flash and the address window sent before it. The
+frames are played back from the output and checked before it is written.
+
+Input: frames of the same size, PNG or binary PPM (see image_encode.py).
+
+Usage: anim_encode.py <output.c> <animation name> <frame time in ms> <frame0.png> <frame1.png> ...
+Example: anim_encode.py Core/Src/LCD_coin.c LCD_Animation_Coin 80 coin0.png coin1.png coin2.png coin3.png
+"""
+
+import os
+import sys
+
+from image_encode import read_png, read_ppm, to_rgb565
+
+# Cost of one rectangle in pixels: 12 bytes in flash and 11 command bytes, CS and DMA setup on the bus
+RECT_COST = 24
+
+
+def read_frame(path):
+    data = open(path, "rb").read()
+    width, height, pixels = read_png(data) if data[:8] == b"\x89PNG\r\n\x1a\n" else read_ppm(data)
+    return width, height, [to_rgb565(pixel) for pixel in pixels]
+
+
+def changed_areas(previous, frame, width, height):
+    """Bounding boxes (x0, y0, x1, y1) of the 8-connected areas of changed pixels."""
+    parent = {}
+
+    def find(run):
+        while parent[run] != run:
+            parent[run] = parent[parent[run]]
+            run = parent[run]
+        return run
+
+    rows = []
+    for y in range(height):
+        runs, x = [], 0
+        while x < width:
+            if previous[y * width + x] == frame[y * width + x]:
+                x += 1
+                continue
+            start = x
+            while x < width and previous[y * width + x] != frame[y * width + x]:
+                x += 1
+            run = (y, start, x - 1)
+            parent[run] = run
+            runs.append(run)
+            # runs touching a run of the row above, diagonally included, are in the same area
+            for above in rows[-1] if rows else []:
+                if above[1] <= x and above[2] >= start - 1:
+                    parent[find(above)] = find(run)
+        rows.append(runs)
+
+    boxes = {}
+    for run in parent:
+        root = find(run)
+        y, x0, x1 = run
+        box = boxes.get(root, (x0, y, x1, y))
+        boxes[root] = (min(box[0], x0), min(box[1], y), max(box[2], x1), max(box[3], y))
+    return list(boxes.values())
+
+
+def cost(box):
+    return (box[2] - box[0] + 1) * (box[3] - box[1] + 1) + RECT_COST
+
+
+def union(a, b):
+    return (min(a[0], b[0]), min(a[1], b[1]), max(a[2], b[2]), max(a[3], b[3]))
+
+
+def merge_boxes(boxes):
+    """Merge the pair of boxes saving the most while a merge does not cost more."""
+    while True:
+        best, pair = -1, None
+        for i in range(len(boxes)):
+            for j in range(i + 1, len(boxes)):
+                saving = cost(boxes[i]) + cost(boxes[j]) - cost(union(boxes[i], boxes[j]))
+                if saving > best:
+                    best, pair = saving, (i, j)
+        if pair is None:
+            return sorted(boxes, key=lambda box: (box[1], box[0]))
+        i, j = pair
+        boxes[i] = union(boxes[i], boxes[j])
+        del boxes[j]
+
+
+def main():
+    if len(sys.argv) < 5:
+        sys.exit(__doc__)
+    sourcePath, name, frameTime = sys.argv[1], sys.argv[2], int(sys.argv[3])
+    framePaths = sys.argv[4:]
+
+    frames, width, height = [], None, None
+    for path in framePaths:
+        w, h, colors = read_frame(path)
+        if width is not None and (w, h) != (width, height):
+            sys.exit("{} is {}x{}, the first frame is {}x{}".format(path, w, h, width, height))
+        width, height = w, h
+        frames.append(colors)
+
+    # rectangles of frame i turn frame i - 1 into frame i, those of frame 0 turn the last frame into the keyframe
+    indexes, rects, pixels = [0], [], []
+    for i, frame in enumerate(frames):
+        previous = frames[i - 1]
+        for x0, y0, x1, y1 in merge_boxes(changed_areas(previous, frame, width, height)):
+            rects.append((x0, y0, x1 - x0 + 1, y1 - y0 + 1, len(pixels)))
+            for y in range(y0, y1 + 1):
+                pixels.extend(frame[y * width + x0:y * width + x1 + 1])
+        indexes.append(len(rects))
+
+    # play the animation back twice, through the loop
+    screen = list(frames[0])
+    for i in list(range(1, len(frames))) + list(range(len(frames))):
+        for x, y, w, h, offset in rects[indexes[i]:indexes[i + 1]]:
+            for row in range(h):
+                start = (y + row) * width + x
+                screen[start:start + w] = pixels[offset + row * w:offset + (row + 1) * w]
+        if screen != frames[i]:
+            sys.exit("frame {} does not play back".format(i))
+
+    def words(values, perLine):
+        swapped = ["0x{:04X}".format((v >> 8) | (v & 0xFF) << 8) for v in values]
+        return ",\n    ".join(", ".join(swapped[i:i + perLine]) for i in range(0, len(swapped), perLine))
+
+    with open(sourcePath, "w") as f:
+        f.write("/*\n * Generated by Tools/anim_encode.py from {}, do not edit.\n */\n".format(
+            ", ".join(os.path.basename(path) for path in framePaths)))
+        f.write('#include "ili9341_animation.h"\n\n')
+        f.write("static const uint16_t {}_Keyframe[] = {{\n    {}\n}};\n\n".format(name, words(frames[0], 12)))
+        f.write("static const uint16_t {}_Frames[] = {{{}}};\n\n".format(name, ", ".join(str(i) for i in indexes)))
+        f.write("static const ILI9341_AnimationRect {}_Rects[] = {{\n    {}\n}};\n\n".format(
+            name, ",\n    ".join("{{{}, {}, {}, {}, {}}}".format(*rect) for rect in rects) if rects else "{0}"))
+        f.write("static const uint16_t {}_Pixels[] = {{\n    {}\n}};\n\n".format(
+            name, words(pixels, 12) if pixels else "0"))
+        f.write("const ILI9341_Animation {} = {{\n".format(name))
+        f.write("    .width = {},\n    .height = {},\n    .frameTime = {},\n    .frameCount = {},\n".format(
+            width, height, frameTime, len(frames)))
+        f.write("    .keyframe = {0}_Keyframe,\n    .frames = {0}_Frames,\n    .rects = {0}_Rects,\n".format(name))
+        f.write("    .pixels = {}_Pixels\n}};\n".format(name))
+
+    full = width * height
+    print("{} frames of {}x{}: {} rectangles, {} delta pixels, {:.1f}% of full frames".format(
+        len(frames), width, height, len(rects), len(pixels), 100 * len(pixels) / (full * len(frames))))
+    for i in range(len(frames)):
+        area = sum(rect[2] * rect[3] for rect in rects[indexes[i]:indexes[i + 1]])
+        print("  frame {}: {} rectangles, {} pixels".format(i, indexes[i + 1] - indexes[i], area))
+
+
+if __name__ == "__main__":
+    main()
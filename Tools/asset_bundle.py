@@ -0,0 +1,183 @@
+#!/usr/bin/env python3
+"""
+Build an asset bundle for ILI9341_Assets_Open from a manifest of fonts, images and strings.
+
+The bundle is one block of flash: a header, an index of the assets sorted by the FNV-1a hash of their names and the
+payloads aligned to 4 bytes (see ILI9341_AssetHeader in Core/Inc/ili9341_assets.h). Font glyph tables are written in
+the layout of ILI9341_GlyphDef with absolute pointers, so the bundle only works at the address it is built for, the
+start of the ASSETS flash region of the linker script.
+
+Three files are written: a C source with the bundle as one byte array in the .assets section, so a normal build links
+it there, a header with the id of each asset, and a raw binary of the bundle that can be flashed to the ASSETS region
+alone to update the assets without rebuilding the firmware.
+
+Manifest format (JSON):
+    {
+        "base": "0x081C0000", "prefix": "LCD_ASSET_",
+        "assets": [
+            {"name": "Spleen16x32", "type": "font"},
+            {"name": "Splash", "type": "image", "file": "splash.png", "compressed": true, "dither": "ordered"},
+            {"name": "InsertCoin", "type": "string", "text": "INSERT COIN"}
+        ]
+    }
+Fonts are read from the glyph tables in Core/Src/ili9341_font_*.c, "font" gives the table name when it differs from the
+asset name. Images are PNG or binary PPM (see image_encode.py), stored raw or compressed as by ILI9341_CompressImage,
+"dither" is none (default), ordered or diffusion.
+File paths are relative to the manifest.
+
+Usage: asset_bundle.py <manifest.json> <output.c> <output.h> <output.bin> [pointer size]
+Example: asset_bundle.py assets.json Core/Src/LCD_assets.c Core/Inc/LCD_assets.h Debug/LCD_assets.bin
+"""
+
+import glob
+import json
+import os
+import re
+import struct
+import sys
+
+from image_encode import convert, encode, read_png, read_ppm
+
+MAGIC = 0x41494C49
+VERSION = 1
+TYPES = {"font": 1, "image": 2, "compressed": 3, "string": 4}
+ALIGNMENT = 4
+SOURCE_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "Core", "Src")
+
+GLYPH_RE = re.compile(
+    r"\{\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(?:NULL|\(const uint8_t\[\]\)\{([^}]*)\})"
+    r"(?:,\s*(\d+))?\},"
+)
+FONT_RE = r"const ILI9341_FontDef ILI9341_Font_{}\s*=\s*\{{\s*(\w+),\s*(\w+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),"
+
+
+def fnv1a(name):
+    value = 2166136261
+    for byte in name.encode():
+        value = ((value ^ byte) * 16777619) & 0xFFFFFFFF
+    return value
+
+
+def align(data, alignment):
+    data.extend(bytes(-len(data) % alignment))
+
+
+def load_font(name):
+    for path in sorted(glob.glob(os.path.join(SOURCE_DIR, "ili9341_font_*.c"))):
+        source = open(path).read()
+        table = re.search(r"ILI9341_Font_{}_Glyphs\[\] = \{{(.*?)\n\}};".format(name), source, re.S)
+        if table:
+            metrics = re.search(FONT_RE.format(name), source).groups()
+            glyphs = []
+            for m in GLYPH_RE.finditer(table.group(1)):
+                data = bytes(int(v, 16) for v in m.group(6).split(",")) if m.group(6) else None
+                glyphs.append([int(v) for v in m.group(1, 2, 3, 4, 5)] + [data, int(m.group(7) or 0)])
+            return [int(v, 0) for v in metrics], glyphs
+    sys.exit("font {} not found in {}".format(name, SOURCE_DIR))
+
+
+def font_payload(metrics, glyphs, address, pointerSize):
+    """ILI9341_AssetFont, the glyph table as ILI9341_GlyphDef with pointers to the bitmaps after it, the bitmaps."""
+    start, end, averageWidth, ascent, descent = metrics
+    pointer = "<I" if pointerSize == 4 else "<Q"
+    # five int8_t padded to the data pointer, the pointer, then bpp padded to the alignment of the pointer
+    recordSize = 3 * pointerSize
+
+    payload = bytearray(struct.pack("<BBhbb2x", start, end, averageWidth, ascent, descent))
+    bitmaps = bytearray()
+    bitmapsStart = len(payload) + recordSize * len(glyphs)
+    for bbX, bbY, bbW, bbH, advance, data, bpp in glyphs:
+        record = bytearray(struct.pack("<bbbbb", bbX, bbY, bbW, bbH, advance))
+        align(record, pointerSize)
+        record += struct.pack(pointer, address + bitmapsStart + len(bitmaps) if data else 0)
+        record += struct.pack("<B", bpp)
+        align(record, pointerSize)
+        payload += record
+        if data:
+            bitmaps += data
+    return payload + bitmaps
+
+
+def image_payload(path, compressed, dither):
+    data = open(path, "rb").read()
+    width, height, pixels = read_png(data) if data[:8] == b"\x89PNG\r\n\x1a\n" else read_ppm(data)
+    colors = convert(width, pixels, dither)
+    header = struct.pack("<HH", width, height)
+    if compressed:
+        return header + encode(colors)
+    # the 2 bytes of each pixel swapped, as sent to the panel
+    return header + b"".join(struct.pack(">H", color) for color in colors)
+
+
+def main():
+    if len(sys.argv) not in (5, 6):
+        sys.exit(__doc__)
+    manifestPath, sourcePath, headerPath, binaryPath = sys.argv[1:5]
+    pointerSize = int(sys.argv[5]) if len(sys.argv) == 6 else 4
+    manifest = json.load(open(manifestPath))
+    base = int(manifest["base"], 0)
+    prefix = manifest.get("prefix", "ASSET_")
+    directory = os.path.dirname(os.path.abspath(manifestPath))
+
+    assets = sorted(manifest["assets"], key=lambda asset: fnv1a(asset["name"]))
+    ids = [fnv1a(asset["name"]) for asset in assets]
+    if len(set(ids)) != len(ids):
+        sys.exit("two asset names have the same hash, rename one of them")
+
+    alignment = max(ALIGNMENT, pointerSize)
+    bundle = bytearray(16 + 16 * len(assets))
+    entries = []
+    for asset in assets:
+        align(bundle, alignment)
+        offset = len(bundle)
+        if asset["type"] == "font":
+            metrics, glyphs = load_font(asset.get("font", asset["name"]))
+            payload, kind = font_payload(metrics, glyphs, base + offset, pointerSize), "font"
+        elif asset["type"] == "image":
+            compressed = asset.get("compressed", False)
+            payload = image_payload(os.path.join(directory, asset["file"]), compressed, asset.get("dither", "none"))
+            kind = "compressed" if compressed else "image"
+        elif asset["type"] == "string":
+            payload, kind = asset["text"].encode() + b"\0", "string"
+        else:
+            sys.exit("unknown asset type {}".format(asset["type"]))
+        bundle += payload
+        entries.append((fnv1a(asset["name"]), TYPES[kind], offset, len(payload)))
+    align(bundle, alignment)
+
+    struct.pack_into("<IBBHII", bundle, 0, MAGIC, VERSION, pointerSize, len(assets), len(bundle), base)
+    for i, (id, kind, offset, size) in enumerate(entries):
+        struct.pack_into("<IHHII", bundle, 16 + 16 * i, id, kind, 0, offset, size)
+
+    with open(binaryPath, "wb") as f:
+        f.write(bundle)
+
+    name = os.path.splitext(os.path.basename(sourcePath))[0]
+    lines = [", ".join("0x{:02X}".format(b) for b in bundle[i:i + 16]) for i in range(0, len(bundle), 16)]
+    with open(sourcePath, "w") as f:
+        f.write("/*\n * Generated by Tools/asset_bundle.py from {}, do not edit.\n */\n".format(
+            os.path.basename(manifestPath)))
+        f.write("#include <stdint.h>\n\n")
+        f.write("// built for 0x{:08X}, kept by the linker script at the start of the ASSETS region\n".format(base))
+        f.write('__attribute__((section(".assets"), used, aligned({}))) const uint8_t {}_Bundle[] = {{\n'.format(
+            alignment, name))
+        f.write("    {}\n}};\n".format(",\n    ".join(lines)))
+
+    guard = "__{}_H__".format(re.sub(r"\W", "_", os.path.splitext(os.path.basename(headerPath))[0]).upper())
+    with open(headerPath, "w") as f:
+        f.write("/*\n * Generated by Tools/asset_bundle.py from {}, do not edit.\n */\n".format(
+            os.path.basename(manifestPath)))
+        f.write("#ifndef {0}\n#define {0}\n\n".format(guard))
+        f.write("// Ids of the assets, ILI9341_Assets_Hash of their names\n")
+        for asset in manifest["assets"]:
+            f.write("#define {}{} 0x{:08X}u\n".format(
+                prefix, re.sub(r"\W", "_", asset["name"]).upper(), fnv1a(asset["name"])))
+        f.write("\n#endif  // {}\n".format(guard))
+
+    print("{} assets, {} bytes at 0x{:08X}".format(len(assets), len(bundle), base))
+    for asset, (id, kind, offset, size) in zip(assets, entries):
+        print("  {:<24} {:<10} 0x{:08X} {:>8} bytes".format(asset["name"], asset["type"], id, size))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,102 @@
+#!/usr/bin/env python3
+"""
+Generate an anti-aliased (2bpp or 4bpp) ILI9341 font from an existing 1bpp font table.
+
+The source glyphs are box-filtered by an integer factor, so a 32x64 bitmap font becomes a 16x32 font whose edge
+pixels carry partial coverage. The output is a C glyph table in the same layout as Core/Src/ili9341_font_*.c.
+
+Usage: font_aa.py <source.c> <source font name> <output font name> <factor> <bpp>
+Example: font_aa.py Core/Src/ili9341_font_spleen.c Spleen32x64 Spleen16x32aa 2 4
+"""
+
+import re
+import sys
+
+GLYPH_RE = re.compile(
+    r"\{\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(?:NULL|\(const uint8_t\[\]\)\{([^}]*)\})(?:,\s*\d+)?\},"
+    r"\s*/\* (.*) \*/"
+)
+FONT_RE = r"const ILI9341_FontDef ILI9341_Font_{}\s*=\s*\{{\s*(\w+),\s*(\w+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),"
+
+
+def parse_font(source, name):
+    table = re.search(r"ILI9341_Font_{}_Glyphs\[\] = \{{(.*?)\n\}};".format(name), source, re.S)
+    if not table:
+        sys.exit("font {} not found".format(name))
+    glyphs = []
+    for m in GLYPH_RE.finditer(table.group(1)):
+        bbX, bbY, bbW, bbH, advance = (int(v) for v in m.group(1, 2, 3, 4, 5))
+        data = [int(v, 16) for v in m.group(6).split(",")] if m.group(6) else []
+        bits = [(data[i // 8] >> (7 - i % 8)) & 1 for i in range(bbW * bbH)] if data else []
+        glyphs.append((bbX, bbY, bbW, bbH, advance, bits, m.group(7)))
+    metrics = re.search(FONT_RE.format(name), source).groups()
+    return glyphs, metrics
+
+
+def downsample(glyph, factor, bpp):
+    bbX, bbY, bbW, bbH, advance, bits, comment = glyph
+    if not bits:
+        return (bbX // factor, bbY // factor, 0, 0, advance // factor, [], comment)
+
+    # pad so that the bounding box is aligned to the sampling grid (bottom-left origin)
+    padLeft = bbX % factor
+    padBottom = bbY % factor
+    newW = -(-(bbW + padLeft) // factor)
+    newH = -(-(bbH + padBottom) // factor)
+    padTop = newH * factor - bbH - padBottom
+
+    maxLevel = (1 << bpp) - 1
+    levels = []
+    for row in range(newH):
+        for col in range(newW):
+            covered = 0
+            for sy in range(factor):
+                for sx in range(factor):
+                    srcRow = row * factor + sy - padTop
+                    srcCol = col * factor + sx - padLeft
+                    if 0 <= srcRow < bbH and 0 <= srcCol < bbW:
+                        covered += bits[srcRow * bbW + srcCol]
+            levels.append((covered * maxLevel * 2 + factor * factor) // (2 * factor * factor))
+
+    return ((bbX - padLeft) // factor, (bbY - padBottom) // factor, newW, newH, advance // factor, levels, comment)
+
+
+def pack(levels, bpp):
+    data = []
+    perByte = 8 // bpp
+    for i in range(0, len(levels), perByte):
+        byte = 0
+        for j, level in enumerate(levels[i:i + perByte]):
+            byte |= level << (8 - bpp * (j + 1))
+        data.append(byte)
+    return data
+
+
+def main():
+    if len(sys.argv) != 6:
+        sys.exit(__doc__)
+    sourcePath, sourceName, outName, factor, bpp = sys.argv[1:]
+    factor = int(factor)
+    bpp = int(bpp)
+    if bpp not in (2, 4):
+        sys.exit("bpp must be 2 or 4")
+
+    glyphs, (start, end, averageWidth, ascent, descent) = parse_font(open(sourcePath).read(), sourceName)
+
+    print("static const ILI9341_GlyphDef ILI9341_Font_{}_Glyphs[] = {{".format(outName))
+    for glyph in glyphs:
+        bbX, bbY, bbW, bbH, advance, levels, comment = downsample(glyph, factor, bpp)
+        if levels:
+            data = ", ".join("0x{:02X}".format(b) for b in pack(levels, bpp))
+            print("    {{{:3d}, {:3d}, {:2d}, {:2d}, {:2d}, (const uint8_t[]){{{}}}, {}}}, /* {} */".format(
+                bbX, bbY, bbW, bbH, advance, data, bpp, comment))
+        else:
+            print("    {{{:3d}, {:3d}, {:2d}, {:2d}, {:2d}, NULL, {}}}, /* {} */".format(
+                bbX, bbY, bbW, bbH, advance, bpp, comment))
+    print("};")
+    print("const ILI9341_FontDef ILI9341_Font_{} = {{ {}, {}, {}, {}, {}, ILI9341_Font_{}_Glyphs }};".format(
+        outName, start, end, int(averageWidth) // factor, int(ascent) // factor, int(descent) // factor, outName))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,96 @@
+#!/usr/bin/env python3
+"""
+Generate a signed distance field (SDF) ILI9341 font from an existing 1bpp font table.
+
+Each glyph is sampled on a grid of <factor> x <factor> source pixels per texel. Texels store the distance to the glyph
+outline as one byte: 128 is the edge, larger values are inside, and <spread> texels map to the full half range. The
+output is a C table for ILI9341_SDFFontDef, rendered at any pixel height by Core/Src/ili9341_sdf.c.
+
+Usage: font_sdf.py <source.c> <source font name> <output font name> <factor> <spread>
+Example: font_sdf.py Core/Src/ili9341_font_spleen.c Spleen32x64 SpleenSDF 2 2
+"""
+
+import math
+import sys
+
+from font_aa import parse_font
+
+
+def square_distance(px, py, col, row):
+    dx = max(col - px, 0.0, px - (col + 1))
+    dy = max(row - py, 0.0, py - (row + 1))
+    return math.hypot(dx, dy)
+
+
+def distance_field(glyph, factor, spread):
+    bbX, bbY, bbW, bbH, advance, bits, comment = glyph
+    if not bits:
+        return (bbX // factor, bbY // factor, 0, 0, advance // factor, [], comment)
+
+    # align to the sampling grid (bottom-left origin) and pad by the spread so the field fades out
+    padLeft = bbX % factor + spread * factor
+    padBottom = bbY % factor + spread * factor
+    newW = -(-(bbW + padLeft + spread * factor) // factor)
+    newH = -(-(bbH + padBottom + spread * factor) // factor)
+    padTop = newH * factor - bbH - padBottom
+
+    def is_set(col, row):
+        return 0 <= col < bbW and 0 <= row < bbH and bits[row * bbW + col]
+
+    radius = (spread + 1) * factor
+    field = []
+    for ty in range(newH):
+        for tx in range(newW):
+            # texel center in source pixel coordinates (row 0 is the top row of the source bitmap)
+            px = (tx + 0.5) * factor - padLeft
+            py = (ty + 0.5) * factor - padTop
+            toSet = radius
+            toUnset = radius
+            for row in range(int(py) - radius, int(py) + radius + 1):
+                for col in range(int(px) - radius, int(px) + radius + 1):
+                    d = square_distance(px, py, col, row)
+                    if is_set(col, row):
+                        toSet = min(toSet, d)
+                    else:
+                        toUnset = min(toUnset, d)
+            distance = toUnset if toSet == 0 else -toSet
+            value = 128 + round(distance / factor * 127 / spread)
+            field.append(max(0, min(255, value)))
+
+    return (
+        (bbX - padLeft) // factor,
+        (bbY - padBottom) // factor,
+        newW,
+        newH,
+        advance // factor,
+        field,
+        comment,
+    )
+
+
+def main():
+    if len(sys.argv) != 6:
+        sys.exit(__doc__)
+    sourcePath, sourceName, outName, factor, spread = sys.argv[1:]
+    factor = int(factor)
+    spread = int(spread)
+
+    glyphs, (start, end, averageWidth, ascent, descent) = parse_font(open(sourcePath).read(), sourceName)
+
+    print("static const ILI9341_GlyphDef ILI9341_Font_{}_Glyphs[] = {{".format(outName))
+    for glyph in glyphs:
+        bbX, bbY, bbW, bbH, advance, field, comment = distance_field(glyph, factor, spread)
+        if field:
+            data = ", ".join("0x{:02X}".format(v) for v in field)
+            print("    {{{:3d}, {:3d}, {:2d}, {:2d}, {:2d}, (const uint8_t[]){{{}}}, 8}}, /* {} */".format(
+                bbX, bbY, bbW, bbH, advance, data, comment))
+        else:
+            print("    {{{:3d}, {:3d}, {:2d}, {:2d}, {:2d}, NULL, 8}}, /* {} */".format(
+                bbX, bbY, bbW, bbH, advance, comment))
+    print("};")
+    print("const ILI9341_SDFFontDef ILI9341_Font_{} = {{ {}, {}, {}, {}, {}, ILI9341_Font_{}_Glyphs }};".format(
+        outName, start, end, int(ascent) // factor, int(descent) // factor, spread, outName))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,254 @@
+#!/usr/bin/env python3
+"""
+Compress an image for ILI9341_DrawImageCompressed.
+
+The pixels are converted to RGB565 and encoded with the same ops as ILI9341_CompressImage (see ILI9341_CompressedImage
+in Core/Inc/ili9341.h): runs, a table of the 64 colors last seen and small differences to the previous color. Flat
+screens shrink to a few KB, photos to about half of the raw size. The output is a C source with one
+ILI9341_CompressedImage, the encoded data is decoded back and checked before it is written.
+
+Input: PNG (8 bits per channel, not interlaced, alpha is ignored) or binary PPM (P6).
+
+The colors are rounded to RGB565, or dithered to hide the banding of gradients: "ordered" with a 4x4 Bayer matrix or
+"diffusion" with Floyd-Steinberg error diffusion. Both give the same pixels as ILI9341_Dither_ConvertRow at runtime.
+Ordered dithering keeps the runs of flat areas and compresses better, diffusion looks smoother on photos.
+
+Usage: image_encode.py <image.png|image.ppm> <output.c> <image name> [none|ordered|diffusion]
+Example: image_encode.py splash.png Core/Src/LCD_splash.c LCD_Image_Splash ordered
+"""
+
+import os
+import struct
+import sys
+import zlib
+
+OP_INDEX = 0x00
+OP_DIFF = 0x40
+OP_LUMA = 0x80
+OP_RUN = 0xC0
+OP_COLOR = 0xFE
+OP_LONG_RUN = 0xFF
+MAX_RUN = 62
+MAX_LONG_RUN = 65536
+DITHERS = ("none", "ordered", "diffusion")
+# (2 * level + 1) * 255 / 32 for the levels of the 4x4 Bayer matrix, as in ILI9341_Dither_Thresholds
+BAYER = [[7, 135, 39, 167], [199, 71, 231, 103], [55, 183, 23, 151], [247, 119, 215, 87]]
+
+
+def read_ppm(data):
+    fields, offset = [], 0
+    while len(fields) < 4:
+        while data[offset:offset + 1].isspace():
+            offset += 1
+        if data[offset:offset + 1] == b"#":
+            offset = data.index(b"\n", offset)
+            continue
+        start = offset
+        while not data[offset:offset + 1].isspace():
+            offset += 1
+        fields.append(data[start:offset])
+    if fields[0] != b"P6" or int(fields[3]) != 255:
+        sys.exit("only binary PPM (P6) with 8 bits per channel is supported")
+    width, height = int(fields[1]), int(fields[2])
+    pixels = data[offset + 1:offset + 1 + width * height * 3]
+    return width, height, [tuple(pixels[i:i + 3]) for i in range(0, len(pixels), 3)]
+
+
+def paeth(a, b, c):
+    p = a + b - c
+    pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+    return a if pa <= pb and pa <= pc else b if pb <= pc else c
+
+
+def read_png(data):
+    offset, idat, palette = 8, b"", None
+    while offset < len(data):
+        length, kind = struct.unpack(">I4s", data[offset:offset + 8])
+        chunk = data[offset + 8:offset + 8 + length]
+        if kind == b"IHDR":
+            width, height, depth, colorType, _, _, interlace = struct.unpack(">IIBBBBB", chunk)
+        elif kind == b"PLTE":
+            palette = [tuple(chunk[i:i + 3]) for i in range(0, len(chunk), 3)]
+        elif kind == b"IDAT":
+            idat += chunk
+        offset += 12 + length
+    if depth != 8 or interlace:
+        sys.exit("only PNG with 8 bits per channel, not interlaced, is supported")
+
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[colorType]
+    stride = width * channels
+    raw = zlib.decompress(idat)
+    rows, previous = [], bytearray(stride)
+    for y in range(height):
+        kind = raw[y * (stride + 1)]
+        row = bytearray(raw[y * (stride + 1) + 1:(y + 1) * (stride + 1)])
+        for i in range(stride):
+            left = row[i - channels] if i >= channels else 0
+            upLeft = previous[i - channels] if i >= channels else 0
+            predictor = [0, left, previous[i], (left + previous[i]) // 2, paeth(left, previous[i], upLeft)][kind]
+            row[i] = (row[i] + predictor) & 0xFF
+        rows.append(row)
+        previous = row
+
+    pixels = []
+    for row in rows:
+        for i in range(0, stride, channels):
+            if colorType == 3:
+                pixels.append(palette[row[i]])
+            elif colorType in (0, 4):
+                pixels.append((row[i],) * 3)
+            else:
+                pixels.append(tuple(row[i:i + 3]))
+    return width, height, pixels
+
+
+def to_rgb565(pixel):
+    r, g, b = pixel
+    return ((r * 31 + 127) // 255) << 11 | ((g * 63 + 127) // 255) << 5 | (b * 31 + 127) // 255
+
+
+def divide(value, divisor):
+    """Integer division rounding toward zero, as in C."""
+    return -(-value // divisor) if value < 0 else value // divisor
+
+
+def convert(width, pixels, dither="none"):
+    """RGB565 colors of RGB888 pixels, row by row like ILI9341_Dither_ConvertRow."""
+    if dither == "none":
+        return [to_rgb565(pixel) for pixel in pixels]
+    if dither == "ordered":
+        colors = []
+        for i, (r, g, b) in enumerate(pixels):
+            t = BAYER[(i // width) & 3][(i % width) & 3]
+            colors.append((r * 31 + t) // 255 << 11 | (g * 63 + t) // 255 << 5 | (b * 31 + t) // 255)
+        return colors
+
+    # Floyd-Steinberg with the errors in 16ths, the same integer steps as ILI9341_Dither_Diffuse
+    colors, errors = [], [[0] * 3 for _ in range(width)]
+    for y in range(len(pixels) // width):
+        right, belowLeft, below = [0] * 3, [0] * 3, [0] * 3
+        for x in range(width):
+            q = [0] * 3
+            for c in range(3):
+                value = min(max(pixels[y * width + x][c] * 16 + errors[x][c] + right[c], 0), 255 * 16)
+                v = (value + 8) >> 4
+                if c == 1:
+                    q[c] = (v * 63 + 127) // 255
+                    shown = q[c] << 2 | q[c] >> 4
+                else:
+                    q[c] = (v * 31 + 127) // 255
+                    shown = q[c] << 3 | q[c] >> 2
+                error = value - shown * 16
+                right[c] = divide(error * 7, 16)
+                if x > 0:
+                    errors[x - 1][c] = belowLeft[c] + divide(error * 3, 16)
+                belowLeft[c] = below[c] + divide(error * 5, 16)
+                below[c] = divide(error, 16)
+            colors.append(q[0] << 11 | q[1] << 5 | q[2])
+        errors[width - 1] = belowLeft
+    return colors
+
+
+def hash_color(color):
+    return ((color >> 11) * 3 + ((color >> 5) & 0x3F) * 5 + (color & 0x1F) * 7) & 0x3F
+
+
+def encode(colors):
+    out, index, previous, run = bytearray(), [0] * 64, 0, 0
+
+    def flush(run):
+        if run > MAX_RUN:
+            out.extend((OP_LONG_RUN, (run - 1) >> 8, (run - 1) & 0xFF))
+        elif run > 0:
+            out.append(OP_RUN + run - 1)
+
+    for color in colors:
+        if color == previous:
+            run += 1
+            if run == MAX_LONG_RUN:
+                flush(run)
+                run = 0
+            continue
+        flush(run)
+        run = 0
+
+        h = hash_color(color)
+        dr = ((color >> 11) - (previous >> 11) + 16) % 32 - 16
+        dg = (((color >> 5) & 0x3F) - ((previous >> 5) & 0x3F) + 32) % 64 - 32
+        db = ((color & 0x1F) - (previous & 0x1F) + 16) % 32 - 16
+        half = (dg + 32) // 2 - 16
+        if index[h] == color:
+            out.append(OP_INDEX | h)
+        elif -2 <= dr <= 1 and -2 <= dg <= 1 and -2 <= db <= 1:
+            out.append(OP_DIFF | (dr + 2) << 4 | (dg + 2) << 2 | (db + 2))
+        elif -8 <= dr - half <= 7 and -8 <= db - half <= 7:
+            out.extend((OP_LUMA | (dg + 32), (dr - half + 8) << 4 | (db - half + 8)))
+        else:
+            out.extend((OP_COLOR, color >> 8, color & 0xFF))
+        index[h] = color
+        previous = color
+
+    flush(run)
+    return bytes(out)
+
+
+def decode(data, count):
+    colors, index, color, offset = [], [0] * 64, 0, 0
+    while len(colors) < count:
+        op, run = data[offset], 1
+        offset += 1
+        if op < OP_DIFF:
+            color = index[op]
+        elif op < OP_LUMA:
+            color = ((((color >> 11) + ((op >> 4) & 3) - 2) & 0x1F) << 11 |
+                     ((((color >> 5) & 0x3F) + ((op >> 2) & 3) - 2) & 0x3F) << 5 |
+                     (((color & 0x1F) + (op & 3) - 2) & 0x1F))
+        elif op < OP_RUN:
+            nxt = data[offset]
+            offset += 1
+            dg, half = (op & 0x3F) - 32, (op & 0x3F) // 2 - 16
+            color = ((((color >> 11) + half + (nxt >> 4) - 8) & 0x1F) << 11 |
+                     ((((color >> 5) & 0x3F) + dg) & 0x3F) << 5 |
+                     (((color & 0x1F) + half + (nxt & 0x0F) - 8) & 0x1F))
+        elif op < OP_COLOR:
+            run = op - OP_RUN + 1
+        elif op == OP_COLOR:
+            color = data[offset] << 8 | data[offset + 1]
+            offset += 2
+        else:
+            run = (data[offset] << 8 | data[offset + 1]) + 1
+            offset += 2
+        if op < OP_RUN or op == OP_COLOR:
+            index[hash_color(color)] = color
+        colors.extend([color] * run)
+    return colors
+
+
+def main():
+    if len(sys.argv) not in (4, 5) or (len(sys.argv) == 5 and sys.argv[4] not in DITHERS):
+        sys.exit(__doc__)
+    imagePath, sourcePath, name = sys.argv[1:4]
+    dither = sys.argv[4] if len(sys.argv) == 5 else "none"
+    data = open(imagePath, "rb").read()
+    width, height, pixels = read_png(data) if data[:8] == b"\x89PNG\r\n\x1a\n" else read_ppm(data)
+
+    colors = convert(width, pixels, dither)
+    encoded = encode(colors)
+    if decode(encoded, len(colors)) != colors:
+        sys.exit("encoded image does not decode back")
+
+    lines = [", ".join("0x{:02X}".format(b) for b in encoded[i:i + 16]) for i in range(0, len(encoded), 16)]
+    with open(sourcePath, "w") as f:
+        f.write("/*\n * Generated by Tools/image_encode.py from {}, do not edit.\n */\n".format(
+            os.path.basename(imagePath)))
+        f.write('#include "ili9341.h"\n\n')
+        f.write("static const uint8_t {}_Data[] = {{\n    {}\n}};\n\n".format(name, ",\n    ".join(lines)))
+        f.write("const ILI9341_CompressedImage {} = {{{}, {}, {}, {}_Data}};\n".format(
+            name, width, height, len(encoded), name))
+
+    raw = width * height * 2
+    print("{}x{}: {} bytes, raw {} bytes ({:.1f}%)".format(width, height, len(encoded), raw, 100 * len(encoded) / raw))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,70 @@
+#!/usr/bin/env python3
+"""
+Embed a JPEG file for ILI9341_Jpeg_Open.
+
+The file is copied as it is into a C byte array, it is decoded on the board MCU by MCU (see ILI9341_Jpeg in
+Core/Inc/ili9341_jpeg.h). Only baseline JPEG is supported: the frame type, the precision, the components and their
+sampling factors are checked here so an unsupported file fails at build time and not on the display.
+
+Usage: jpeg_embed.py <image.jpg> <output.c> <array name>
+Example: jpeg_embed.py prize.jpg Core/Src/LCD_prize.c LCD_Jpeg_Prize
+"""
+
+import os
+import struct
+import sys
+
+SOF_BASELINE = (0xC0, 0xC1)
+SOF_UNSUPPORTED = (0xC2, 0xC3, 0xC5, 0xC6, 0xC7, 0xC9, 0xCA, 0xCB, 0xCD, 0xCE, 0xCF)
+
+
+def read_frame(data):
+    if data[:2] != b"\xFF\xD8":
+        sys.exit("not a JPEG file")
+    offset = 2
+    while offset + 4 <= len(data):
+        if data[offset] != 0xFF:
+            sys.exit("corrupt marker at offset {}".format(offset))
+        marker = data[offset + 1]
+        if marker == 0xFF:
+            offset += 1
+            continue
+        length = struct.unpack(">H", data[offset + 2:offset + 4])[0]
+        segment = data[offset + 4:offset + 2 + length]
+        if marker in SOF_UNSUPPORTED:
+            sys.exit("only baseline JPEG is supported, save the image without progressive encoding")
+        if marker in SOF_BASELINE:
+            precision, height, width, count = struct.unpack(">BHHB", segment[:6])
+            sampling = [(segment[7 + 3 * i] >> 4, segment[7 + 3 * i] & 0x0F) for i in range(count)]
+            if precision != 8 or count not in (1, 3):
+                sys.exit("only 8-bit grayscale and YCbCr JPEG is supported")
+            if count == 3 and any(h > 2 or v > 2 for h, v in sampling):
+                sys.exit("only chroma subsampling up to 2x2 is supported")
+            return width, height, sampling
+        offset += 2 + length
+    sys.exit("no frame header found")
+
+
+def main():
+    if len(sys.argv) != 4:
+        sys.exit(__doc__)
+    imagePath, sourcePath, name = sys.argv[1:]
+    data = open(imagePath, "rb").read()
+    width, height, sampling = read_frame(data)
+
+    lines = [", ".join("0x{:02X}".format(b) for b in data[i:i + 16]) for i in range(0, len(data), 16)]
+    with open(sourcePath, "w") as f:
+        f.write("/*\n * Generated by Tools/jpeg_embed.py from {}, do not edit.\n */\n".format(
+            os.path.basename(imagePath)))
+        f.write("#include <stddef.h>\n#include <stdint.h>\n\n")
+        f.write("// {}x{} baseline JPEG\n".format(width, height))
+        f.write("const uint8_t {}[] = {{\n    {}\n}};\n".format(name, ",\n    ".join(lines)))
+        f.write("const size_t {}_Size = sizeof({});\n".format(name, name))
+
+    print("{}x{}, sampling {}: {} bytes, raw {} bytes ({:.1f}%)".format(
+        width, height, "x".join(str(s) for s in sampling[0]), len(data), width * height * 2,
+        100 * len(data) / (width * height * 2)))
+
+
+if __name__ == "__main__":
+    main()
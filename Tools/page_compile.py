@@ -0,0 +1,194 @@
+#!/usr/bin/env python3
+"""
+Compile page descriptions into pre-baked ILI9341 page op tables.
+
+Every static text is laid out here: each visible glyph becomes one op with its final coordinates and its index in the
+glyph table of the font, so drawing a page at runtime only walks an array in flash. Values shown on a page are fields,
+boxes filled at runtime with ILI9341_Widget_InitField.
+
+Description format (JSON):
+    {
+        "width": 320, "height": 240,
+        "pages": [{
+            "name": "Idle", "background": "WHITE",
+            "elements": [
+                {"type": "text", "text": "INSERT COIN", "font": "Spleen16x32", "color": "BLACK", "align": "center",
+                 "y": 120},
+                {"type": "field", "name": "CoinsLeft", "font": "Spleen16x32", "color": "RED", "align": "center",
+                 "y": 150, "suffix": " Bath Remaining"},
+                {"type": "rect", "x": 0, "y": 0, "w": 320, "h": 4, "color": "0x001F"},
+                {"type": "image", "x": 10, "y": 10, "w": 24, "h": 24, "data": "logoPixels"}
+            ]
+        }]
+    }
+Texts and fields are placed by baseline (y) and either "align": "left" | "center" | "right" inside the box given by
+"x" and "width" (the whole page by default). Colors are ILI9341_COLOR_* names or RGB565 numbers. Images are names of
+C arrays in RGB565 format with the 2 bytes swapped.
+
+Usage: page_compile.py <pages.json> <output.c> <output.h>
+Example: page_compile.py Tools/LCD_pages.json Core/Src/LCD_pages_data.c Core/Inc/LCD_pages_data.h
+"""
+
+import glob
+import json
+import os
+import re
+import sys
+
+from font_aa import parse_font
+
+FALLBACK_CODEPOINT = 0x7F
+SOURCE_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "Core", "Src")
+
+fonts = {}
+
+
+def load_font(name):
+    if name not in fonts:
+        for path in sorted(glob.glob(os.path.join(SOURCE_DIR, "ili9341_font_*.c"))):
+            source = open(path).read()
+            if "ILI9341_Font_{}_Glyphs[]".format(name) in source:
+                glyphs, (start, end, averageWidth, ascent, descent) = parse_font(source, name)
+                fonts[name] = {
+                    "glyphs": glyphs,
+                    "start": int(start, 0),
+                    "end": int(end, 0),
+                    "ascent": int(ascent),
+                    "descent": int(descent),
+                }
+                break
+        else:
+            sys.exit("font {} not found".format(name))
+    return fonts[name]
+
+
+def glyph_index(font, c):
+    code = ord(c)
+    if code < font["start"] or code > font["end"]:
+        code = FALLBACK_CODEPOINT
+    return code - font["start"]
+
+
+def measure(text, font):
+    """Same as ILI9341_MeasureString without scale and tracking, returns (x, width)"""
+    left, right, x = None, None, 0
+    for c in text:
+        bbX, bbY, bbW, bbH, advance = font["glyphs"][glyph_index(font, c)][:5]
+        if bbW > 0:
+            left = x + bbX if left is None else min(left, x + bbX)
+            right = x + bbX + bbW if right is None else max(right, x + bbX + bbW)
+        x += advance
+    return (left, right - left) if left is not None else (0, 0)
+
+
+def color(value):
+    if isinstance(value, int):
+        return "0x{:04X}".format(value)
+    if re.match(r"^(0x[0-9a-fA-F]+|\d+)$", value):
+        return "0x{:04X}".format(int(value, 0))
+    return "ILI9341_COLOR_{}".format(value.upper())
+
+
+def align_name(element):
+    return "ILI9341_ALIGN_{}".format(element.get("align", "left").upper())
+
+
+def box(element, width):
+    return element.get("x", 0), element.get("width", width - element.get("x", 0))
+
+
+def snake(name):
+    return re.sub(r"(?<=[a-z0-9])(?=[A-Z])", "_", name).upper()
+
+
+def compile_page(page, width, height):
+    background = color(page.get("background", "WHITE"))
+    ops = ["{{ILI9341_PAGE_OP_FILL, 0, 0, 0, {}, {}, {}, {}, NULL}}".format(width, height, background, background)]
+    fields = []
+
+    for element in page["elements"]:
+        kind = element["type"]
+        if kind == "rect":
+            ops.append("{{ILI9341_PAGE_OP_FILL, 0, {}, {}, {}, {}, {}, {}, NULL}}".format(
+                element["x"], element["y"], element["w"], element["h"], color(element["color"]), background))
+        elif kind == "image":
+            ops.append("{{ILI9341_PAGE_OP_IMAGE, 0, {}, {}, {}, {}, 0, 0, {}}}".format(
+                element["x"], element["y"], element["w"], element["h"], element["data"]))
+        elif kind == "text":
+            font = load_font(element["font"])
+            boxX, boxWidth = box(element, width)
+            boundsX, boundsWidth = measure(element["text"], font)
+            align = element.get("align", "left")
+            x = boxX - boundsX
+            if align == "center":
+                x += (boxWidth - boundsWidth) // 2
+            elif align == "right":
+                x += boxWidth - boundsWidth
+            for c in element["text"]:
+                index = glyph_index(font, c)
+                bbX, bbY, bbW, bbH, advance = font["glyphs"][index][:5]
+                # glyphs without pixels draw nothing, not even their background
+                if bbW > 0 and bbH > 0:
+                    ops.append("{{ILI9341_PAGE_OP_GLYPH, {}, {}, {}, 0, 0, {}, {}, &ILI9341_Font_{}}}".format(
+                        index, x, element["y"], color(element["color"]), background, element["font"]))
+                x += advance
+        elif kind == "field":
+            font = load_font(element["font"])
+            boxX, boxWidth = box(element, width)
+            suffix = '"{}"'.format(element["suffix"]) if "suffix" in element else "NULL"
+            fields.append((element["name"], "{{{}, {}, {}, {}, &ILI9341_Font_{}, {}, {}, {}, {}}}".format(
+                boxX, element["y"] - font["ascent"] + 1, boxWidth, font["ascent"] + font["descent"], element["font"],
+                color(element["color"]), background, align_name(element), suffix)))
+        else:
+            sys.exit("unknown element type {}".format(kind))
+
+    return ops, fields
+
+
+def main():
+    if len(sys.argv) != 4:
+        sys.exit(__doc__)
+    descriptionPath, sourcePath, headerPath = sys.argv[1:]
+    description = json.load(open(descriptionPath))
+    width, height = description["width"], description["height"]
+    header = os.path.basename(headerPath)
+    guard = "INC_{}_".format(re.sub(r"\W", "_", header).upper())
+    notice = "/*\n * Generated by Tools/page_compile.py from {}, do not edit.\n */\n".format(
+        os.path.basename(descriptionPath))
+
+    source = [notice, '#include "{}"\n'.format(header)]
+    declarations = [notice, "#ifndef {}\n#define {}\n".format(guard, guard), '#include "ili9341_page.h"\n']
+
+    images = sorted({e["data"] for p in description["pages"] for e in p["elements"] if e["type"] == "image"})
+    if images:
+        declarations.append("\n".join("extern const uint16_t {}[];".format(image) for image in images) + "\n")
+
+    for page in description["pages"]:
+        name = page["name"]
+        ops, fields = compile_page(page, width, height)
+
+        source.append("static const ILI9341_PageOp LCD_Page_{}_Ops[] = {{".format(name))
+        source.append(",\n".join("    " + op for op in ops))
+        source.append("};\n")
+        if fields:
+            source.append("static const ILI9341_PageField LCD_Page_{}_Fields[] = {{".format(name))
+            source.append(",\n".join("    " + field for _, field in fields))
+            source.append("};\n")
+        source.append("const ILI9341_Page LCD_Page_{} = {{{}, {}, LCD_Page_{}_Ops, {}, {}, {}}};\n".format(
+            name, width, height, name, len(ops), "LCD_Page_{}_Fields".format(name) if fields else "NULL",
+            len(fields)))
+
+        for index, (fieldName, _) in enumerate(fields):
+            declarations.append("#define LCD_FIELD_{}_{} {}".format(snake(name), snake(fieldName), index))
+        declarations.append("extern const ILI9341_Page LCD_Page_{};\n".format(name))
+
+    declarations.append("#endif /* {} */".format(guard))
+
+    with open(sourcePath, "w") as f:
+        f.write("\n".join(source))
+    with open(headerPath, "w") as f:
+        f.write("\n".join(declarations) + "\n")
+
+
+if __name__ == "__main__":
+    main()
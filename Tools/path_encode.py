@@ -0,0 +1,162 @@
+#!/usr/bin/env python3
+"""
+Encode the outlines of an SVG icon as path bytecode for ILI9341_FillPath.
+
+The paths of the SVG are converted to the ops of ILI9341_Path (see Core/Inc/ili9341.h): a byte per op, then its int16
+coordinates MSB first. Lines and quadratic curves are kept as they are, which is enough for arrows, coins and claws
+drawn with straight edges and arcs, the icon is then filled at any size from a few hundred bytes. The output is a C
+source with one ILI9341_Path.
+
+Input: an SVG with a viewBox and path elements using M, L, H, V, Q, T and Z, absolute or relative. Cubic curves and
+arcs are not supported, convert them to quadratic curves in the editor. Fill colors and transforms are ignored, all the
+paths are one shape, filled with the rule given to ILI9341_FillPath. All points, control points included, must be inside
+the viewBox, which is the bounds of the path for clipping and redrawing.
+
+The coordinates are multiplied by the units per SVG unit and rounded, 1 by default. With 16 units per SVG unit, a path
+drawn at 16 times less than the scale of ILI9341_FillPath keeps 1/16 of the SVG unit of precision.
+
+Usage: path_encode.py <icon.svg> <output.c> <path name> [units per SVG unit]
+Example: path_encode.py coin.svg Core/Src/LCD_icon_coin.c LCD_Icon_Coin 4
+"""
+
+import os
+import re
+import sys
+import xml.etree.ElementTree as ElementTree
+
+OP_END = 0
+OP_MOVE = 1
+OP_LINE = 2
+OP_QUAD = 3
+OP_CLOSE = 4
+COORDINATES = {OP_END: 0, OP_MOVE: 2, OP_LINE: 2, OP_QUAD: 4, OP_CLOSE: 0}
+
+
+def tokenize(d):
+    for command, arguments in re.findall(r"([A-Za-z])([^A-Za-z]*)", d):
+        numbers = [float(n) for n in re.findall(r"[-+]?(?:\d+\.?\d*|\.\d+)(?:[eE][-+]?\d+)?", arguments)]
+        yield command, numbers
+
+
+def parse(d):
+    """Convert path data to a list of (op, points) in SVG units, with absolute coordinates."""
+    ops = []
+    current = start = control = (0.0, 0.0)
+    previous = None
+
+    for command, numbers in tokenize(d):
+        upper = command.upper()
+        relative = command.islower()
+        sizes = {"M": 2, "L": 2, "H": 1, "V": 1, "Q": 4, "T": 2, "Z": 0}
+        if upper not in sizes:
+            sys.exit("unsupported path command {}, only M, L, H, V, Q, T and Z are".format(command))
+        size = sizes[upper]
+        if size == 0:
+            numbers = []
+        elif not numbers or len(numbers) % size != 0:
+            sys.exit("command {} needs a multiple of {} numbers".format(command, size))
+
+        groups = [numbers[i:i + size] for i in range(0, len(numbers), size)] if size else [[]]
+        for index, group in enumerate(groups):
+            base = current if relative else (0.0, 0.0)
+            if upper == "M" and index == 0:
+                current = start = (base[0] + group[0], base[1] + group[1])
+                ops.append((OP_MOVE, [current]))
+            elif upper in "ML":
+                current = (base[0] + group[0], base[1] + group[1])
+                ops.append((OP_LINE, [current]))
+            elif upper == "H":
+                current = (base[0] + group[0] if relative else group[0], current[1])
+                ops.append((OP_LINE, [current]))
+            elif upper == "V":
+                current = (current[0], base[1] + group[0] if relative else group[0])
+                ops.append((OP_LINE, [current]))
+            elif upper in "QT":
+                if upper == "Q":
+                    control = (base[0] + group[0], base[1] + group[1])
+                    end = (base[0] + group[2], base[1] + group[3])
+                else:
+                    # the control point mirrors the previous one, or is the current point after other commands
+                    control = (2 * current[0] - control[0], 2 * current[1] - control[1]) if previous in "QT" \
+                        else current
+                    end = (base[0] + group[0], base[1] + group[1])
+                current = end
+                ops.append((OP_QUAD, [control, end]))
+            else:
+                current = start
+                ops.append((OP_CLOSE, []))
+            previous = upper
+
+    return ops
+
+
+def encode(ops, units, origin, size):
+    data = bytearray()
+    for op, points in ops:
+        data.append(op)
+        for x, y in points:
+            point = [round((x - origin[0]) * units), round((y - origin[1]) * units)]
+            # the box is the bounds of the path when it is drawn, a curve stays within its points
+            if not all(0 <= point[i] <= size[i] for i in range(2)):
+                sys.exit("point ({:g}, {:g}) is outside the viewBox, enlarge it".format(x, y))
+            for value in point:
+                if value > 32767:
+                    sys.exit("coordinate {} does not fit in int16, use less units per SVG unit".format(value))
+                data += value.to_bytes(2, "big")
+    data.append(OP_END)
+    return bytes(data)
+
+
+def decode(data):
+    ops, offset = [], 0
+    while data[offset] != OP_END:
+        op = data[offset]
+        count = COORDINATES[op]
+        values = [int.from_bytes(data[offset + 1 + 2 * i:offset + 3 + 2 * i], "big", signed=True) for i in range(count)]
+        ops.append((op, values))
+        offset += 1 + 2 * count
+    return ops
+
+
+def main():
+    if len(sys.argv) not in (4, 5):
+        sys.exit(__doc__)
+    svgPath, sourcePath, name = sys.argv[1:4]
+    units = float(sys.argv[4]) if len(sys.argv) == 5 else 1.0
+
+    root = ElementTree.parse(svgPath).getroot()
+    viewBox = root.get("viewBox")
+    if not viewBox:
+        sys.exit("the SVG has no viewBox")
+    minX, minY, width, height = [float(v) for v in viewBox.replace(",", " ").split()]
+
+    ops = []
+    for element in root.iter():
+        if element.tag.split("}")[-1] == "path" and element.get("d"):
+            ops += parse(element.get("d"))
+    if not ops:
+        sys.exit("the SVG has no paths")
+
+    pathWidth, pathHeight = round(width * units), round(height * units)
+    if not 0 < pathWidth <= 65535 or not 0 < pathHeight <= 65535:
+        sys.exit("the viewBox is {}x{} units, it must be 1 to 65535, use less units per SVG unit".format(
+            pathWidth, pathHeight))
+
+    data = encode(ops, units, (minX, minY), (pathWidth, pathHeight))
+    if len(decode(data)) != len(ops):
+        sys.exit("encoded path does not decode back")
+
+    lines = [", ".join("0x{:02X}".format(b) for b in data[i:i + 16]) for i in range(0, len(data), 16)]
+    with open(sourcePath, "w") as f:
+        f.write("/*\n * Generated by Tools/path_encode.py from {}, do not edit.\n */\n".format(
+            os.path.basename(svgPath)))
+        f.write('#include "ili9341.h"\n\n')
+        f.write("static const uint8_t {}_Data[] = {{\n    {}\n}};\n\n".format(name, ",\n    ".join(lines)))
+        f.write("const ILI9341_Path {} = {{{}, {}, {}, {}_Data}};\n".format(
+            name, pathWidth, pathHeight, len(data), name))
+
+    print("{}x{} units, {} ops: {} bytes".format(pathWidth, pathHeight, len(ops), len(data)))
+
+
+if __name__ == "__main__":
+    main()